@@ -93,6 +93,12 @@ void Engine::PerformGets()
     m_Engine->PerformGets();
 }
 
+void Engine::PerformCollectiveGets()
+{
+    helper::CheckForNullptr(m_Engine, "in call to Engine::PerformCollectiveGets");
+    m_Engine->PerformCollectiveGets();
+}
+
 void Engine::LockWriterDefinitions()
 {
     helper::CheckForNullptr(m_Engine, "in call to Engine::LockWriterDefinitions");
@@ -452,6 +452,13 @@ public:
     /** Perform all Get calls in Deferred mode up to this point */
     void PerformGets();
 
+    /** Perform all Get calls in Deferred mode up to this point, together
+     * with the other ranks of the communicator the engine was opened with.
+     * It is a collective call. With BP5, data needed by more than one rank
+     * is read from the file once and sent to the ranks that need it;
+     * other engines do PerformGets. */
+    void PerformCollectiveGets();
+
     /**
      * Ends current step, by default calls PerformsPut/Get internally
      * For most engines, this is an MPI collective function.
@@ -115,6 +115,12 @@ Selection &Selection::SetAccuracy(double error, double norm, bool relative)
     return SetAccuracy(Accuracy{error, norm, relative});
 }
 
+Selection &Selection::SetLevelOfDetail(size_t level)
+{
+    m_Impl->m_Selection.SetLevelOfDetail(level);
+    return *this;
+}
+
 void Selection::Clear() { m_Impl->m_Selection.Clear(); }
 
 //============================================================================
@@ -164,6 +170,13 @@ Selection Selection::WithAccuracy(double error, double norm, bool relative) cons
     return WithAccuracy(Accuracy{error, norm, relative});
 }
 
+Selection Selection::WithLevelOfDetail(size_t level) const
+{
+    Selection sel;
+    sel.m_Impl->m_Selection = m_Impl->m_Selection.WithLevelOfDetail(level);
+    return sel;
+}
+
 std::string Selection::ToString() const { return m_Impl->m_Selection.ToString(); }
 
 const core::Selection &Selection::GetCoreSelection() const { return m_Impl->m_Selection; }
@@ -80,6 +80,13 @@ public:
     Selection &SetAccuracy(const Accuracy &accuracy);
     Selection &SetAccuracy(double error, double norm = L2_norm, bool relative = false);
 
+    /**
+     * Read coarse level of detail `level` (every 2^level-th element in each
+     * dimension) written with the BP5 LevelsOfDetail parameter. Start and
+     * count stay in full resolution coordinates. 0 reads the full data.
+     */
+    Selection &SetLevelOfDetail(size_t level);
+
     /** Reset to default state */
     void Clear();
 
@@ -98,6 +105,8 @@ public:
     Selection WithAccuracy(const Accuracy &accuracy) const;
     Selection WithAccuracy(double error, double norm = L2_norm, bool relative = false) const;
 
+    Selection WithLevelOfDetail(size_t level) const;
+
     /** Human-readable string representation */
     std::string ToString() const;
 
@@ -14,6 +14,7 @@
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosFunctions.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "py11types.h"
@@ -261,6 +262,114 @@ std::string Engine::Get(Variable variable, const Mode launch)
     }
     return string;
 }
+pybind11::array Engine::GetView(Variable variable)
+{
+    helper::CheckForNullptr(m_Engine, "for engine, in call to Engine::GetView");
+    helper::CheckForNullptr(variable.m_VariableBase,
+                            "for variable, in call to Engine::GetView");
+
+    const adios2::DataType type = helper::GetDataTypeFromString(variable.Type());
+
+    if (type == adios2::DataType::Struct)
+    {
+        // not supported
+    }
+#define declare_type(T)                                                                            \
+    else if (type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        return GetViewCommon(*dynamic_cast<core::Variable<T> *>(variable.m_VariableBase));         \
+    }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
+
+    throw std::invalid_argument("ERROR: in variable " + variable.Name() + " of type " +
+                                variable.Type() +
+                                ", type is not supported by numpy, in call to GetView\n");
+}
+
+template <class T>
+pybind11::array Engine::GetViewCommon(core::Variable<T> &variable)
+{
+    // Inline keeps the writer's blocks in memory, a selection that is exactly
+    // one of them is handed out as is
+    if (m_Engine->m_EngineType == "InlineReader")
+    {
+        if (const auto *block = InlineSelectedBlock(variable))
+        {
+            const Dims shape = block->Count.empty() ? Dims{1} : block->Count;
+            // the buffer is owned by the engine, the capsule only anchors the
+            // numpy base object and must not free it
+            pybind11::capsule owner(block->Data, [](void *) {});
+            pybind11::array_t<T> view(shape, block->Data, owner);
+            view.attr("flags").attr("writeable") = false;
+            return std::move(view);
+        }
+    }
+
+    Dims shape = variable.Count();
+    const size_t selectionSize = variable.SelectionSize();
+    if (shape.empty())
+    {
+        if (selectionSize > 1)
+        {
+            shape = {selectionSize};
+        }
+    }
+    else
+    {
+        const size_t sizePerStep = helper::GetTotalSize(shape);
+        if (sizePerStep > 0)
+        {
+            shape[0] *= selectionSize / sizePerStep;
+        }
+    }
+
+    // numpy-owned, the engine reads directly into it. Zeroed first as parts
+    // of the selection no block covers are not written
+    pybind11::array_t<T> array(shape);
+    std::fill_n(array.mutable_data(), array.size(), T());
+    m_Engine->Get(variable, array.mutable_data(), Mode::Sync);
+    return std::move(array);
+}
+
+template <class T>
+const typename core::Variable<T>::BPInfo *
+Engine::InlineSelectedBlock(const core::Variable<T> &variable) const
+{
+    if (variable.m_ShapeID == ShapeID::GlobalValue ||
+        variable.m_ShapeID == ShapeID::LocalValue || !variable.m_MemoryCount.empty() ||
+        variable.m_StepsCount > 1)
+    {
+        return nullptr;
+    }
+    const typename core::Variable<T>::BPInfo *block = nullptr;
+    if (variable.m_SelectionType == SelectionType::WriteBlock ||
+        variable.m_ShapeID == ShapeID::LocalArray)
+    {
+        if (variable.m_BlockID < variable.m_BlocksInfo.size())
+        {
+            block = &variable.m_BlocksInfo[variable.m_BlockID];
+        }
+    }
+    else
+    {
+        for (const auto &info : variable.m_BlocksInfo)
+        {
+            if (info.Start == variable.m_Start && info.Count == variable.m_Count)
+            {
+                block = &info;
+                break;
+            }
+        }
+    }
+    // a block Put with a memory selection is not contiguous
+    if (block == nullptr || block->IsValue || !block->MemoryCount.empty())
+    {
+        return nullptr;
+    }
+    return block;
+}
+
 void Engine::PerformGets()
 {
     helper::CheckForNullptr(m_Engine, "in call to Engine::PerformGets");
@@ -70,6 +70,15 @@ public:
     void Get(Variable variable, std::uintptr_t array, const Mode launch);
     std::string Get(Variable variable, const Mode launch = Mode::Deferred);
 
+    /**
+     * Returns a numpy array for the current selection without an extra copy.
+     * With Inline, a selection that is exactly one writer block is returned
+     * as a read-only view on the engine buffer, valid until EndStep. Other
+     * selections and engines get a numpy-owned zeroed buffer filled in Sync
+     * mode, letting the engine read straight into it.
+     */
+    pybind11::array GetView(Variable variable);
+
     void PerformGets();
 
     void EndStep();
@@ -98,6 +107,15 @@ public:
 private:
     Engine(core::Engine *engine);
     core::Engine *m_Engine = nullptr;
+
+    template <class T>
+    pybind11::array GetViewCommon(core::Variable<T> &variable);
+
+    /** the Inline block the selection of variable is exactly, nullptr if
+     * it is none or only part of one */
+    template <class T>
+    const typename core::Variable<T>::BPInfo *
+    InlineSelectedBlock(const core::Variable<T> &variable) const;
 };
 
 } // end namespace py11
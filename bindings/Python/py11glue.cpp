@@ -559,6 +559,10 @@ PYBIND11_MODULE(ADIOS2_PYTHON_MODULE_NAME, m)
                  adios2::py11::Engine::Get,
              pybind11::arg("variable"), pybind11::arg("pointer"), pybind11::arg("launch"))
 
+        // the view must not outlive the engine that owns its memory
+        .def("GetView", &adios2::py11::Engine::GetView, pybind11::arg("variable"),
+             pybind11::keep_alive<0, 1>())
+
         .def("PerformGets", &adios2::py11::Engine::PerformGets)
 
         .def("EndStep", &adios2::py11::Engine::EndStep)
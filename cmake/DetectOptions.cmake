@@ -544,6 +544,21 @@ if(ADIOS2_USE_SST AND NOT WIN32)
     set(ADIOS2_SST_HAVE_UCX TRUE)
     set(ADIOS2_HAVE_UCX TRUE)
   endif()
+
+  # POSIX shared memory, for node local data exchange
+  include(CheckSymbolExists)
+  CHECK_SYMBOL_EXISTS(shm_open "sys/mman.h" HAVE_shm_open)
+  if(NOT HAVE_shm_open)
+    set(CMAKE_REQUIRED_LIBRARIES rt)
+    CHECK_SYMBOL_EXISTS(shm_open "sys/mman.h" HAVE_shm_open_rt)
+    unset(CMAKE_REQUIRED_LIBRARIES)
+    if(HAVE_shm_open_rt)
+      set(ADIOS2_SST_SHM_NEEDS_RT TRUE)
+    endif()
+  endif()
+  if(HAVE_shm_open OR HAVE_shm_open_rt)
+    set(ADIOS2_SST_HAVE_SHM TRUE)
+  endif()
 endif()
 
 # DAOS
@@ -173,6 +173,23 @@ class Engine:
                 return None
         return self.impl.Get(variable.impl, mode)
 
+    def get_view(self, variable):
+        """
+        Gets the content of a variable without an intermediate copy
+
+        Parameters
+            variable
+                adios2.Variable object, with its selection already set
+
+        Returns
+            numpy array with the data of the current selection. With Inline,
+            a selection that is exactly one writer block is a read-only view
+            of the engine buffer that is only valid until end_step(). Other
+            selections and engines read directly into a newly allocated array,
+            where parts no block covers are zero.
+        """
+        return self.impl.GetView(variable.impl)
+
     def perform_gets(self):
         """Perform the gets calls"""
         self.impl.PerformGets()
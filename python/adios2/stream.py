@@ -699,6 +699,51 @@ class Stream:
 
         return self.read(variable, start, count, block_id, step_selection, defer_read=defer_read)
 
+    @singledispatchmethod
+    def read_view(self, variable: Variable, start=[], count=[], block_id=None, step_selection=None):
+        """
+        Read a variable without an extra copy, always in Sync mode.
+
+        Parameters
+            variable
+                adios2.Variable object to be read
+
+            start, count, block_id, step_selection
+                same as in read()
+
+        Returns
+            array
+                resulting array from selection. For engines that own the data
+                (Inline) this is a read-only view that is only valid until the
+                end of the current step.
+        """
+        variable = self._set_variable_settings(variable, start, count, block_id, step_selection)
+        if variable.type() == "string":
+            return self._engine.get(variable)
+        return self._engine.get_view(variable)
+
+    @read_view.register(str)
+    def _(self, name: str, start=[], count=[], block_id=None, step_selection=None):
+        """
+        Read a variable without an extra copy, always in Sync mode.
+
+        Parameters
+            name
+                variable to be read
+
+            start, count, block_id, step_selection
+                same as in read()
+
+        Returns
+            array
+                resulting array from selection
+        """
+        variable = self._io.inquire_variable(name)
+        if not variable:
+            raise ValueError()
+
+        return self.read_view(variable, start, count, block_id, step_selection)
+
     def read_complete(self):
         """
         Complete reading all deferred read requests.
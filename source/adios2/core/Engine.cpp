@@ -86,6 +86,7 @@ void Engine::EndStep() { ThrowUp("EndStep"); }
 void Engine::PerformPuts() { ThrowUp("PerformPuts"); }
 void Engine::PerformGets() { ThrowUp("PerformGets"); }
 void Engine::PerformDataWrite() { return; }
+void Engine::PerformCollectiveGets() { PerformGets(); }
 
 void Engine::Close(const int transportIndex)
 {
@@ -409,6 +409,12 @@ public:
      * PerformGets, BeginStep or Open */
     virtual void PerformGets();
 
+    /** Collective over the engine's communicator: executes the deferred
+     * Gets of all ranks together, so that data needed by several ranks is
+     * read once and exchanged. Engines without a collective read path do
+     * PerformGets */
+    virtual void PerformCollectiveGets();
+
     /** Write array data to disk.  This may relieve memory pressure by clearing
      * ADIOS buffers.  It is a collective call. */
     virtual void PerformDataWrite();
@@ -17,6 +17,7 @@
 #include <utility> // std::pair
 
 #include "adios2/common/ADIOSMacros.h"
+#include "adios2/core/Selection.h"
 
 #include "adios2/engine/bp3/BP3Reader.h"
 #include "adios2/engine/bp3/BP3Writer.h"
@@ -185,6 +186,19 @@ struct ThrowError
     std::string Err;
 };
 
+// a companion holding a coarse level, marked by the writer on its full variable
+bool IsLevelOfDetailCompanion(IO &io, const std::string &name)
+{
+    std::string variableName;
+    size_t level = 0;
+    if (!ParseLevelOfDetailName(name, variableName, level))
+    {
+        return false;
+    }
+    auto *written = io.InquireAttribute<uint32_t>(LevelsOfDetailAttribute, variableName);
+    return written != nullptr && level <= written->m_DataSingleValue;
+}
+
 } // end anonymous namespace
 
 IO::MakeEngineFunc IO::NoEngine(std::string e) { return ThrowError{e}; }
@@ -428,6 +442,10 @@ std::map<std::string, Params> IO::GetAvailableVariables(const std::set<std::stri
         if (type == DataType::Struct)
         {
         }
+        else if (IsLevelOfDetailCompanion(*this, variableName))
+        {
+            // coarse levels of detail are read through their full variable
+        }
 #define declare_template_instantiation(T)                                                          \
     else if (type == helper::GetDataType<T>())                                                     \
     {                                                                                              \
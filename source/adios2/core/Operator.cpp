@@ -91,6 +91,12 @@ size_t Operator::GetEstimatedSize(const size_t ElemCount, const size_t ElemSize,
 
 void Operator::AddExtraParameters(const Params &params) {}
 
+bool Operator::HasAccuracyLevels() const { return false; }
+
+std::vector<std::pair<double, size_t>> Operator::GetAccuracyLevels() const { return {}; }
+
+bool Operator::IsInverseThreadSafe() const noexcept { return false; }
+
 size_t Operator::Operate(const char *dataIn, const Dims &blockStart, const Dims &blockCount,
                          const DataType type, char *bufferOut)
 {
@@ -72,6 +72,26 @@ public:
 
     virtual void AddExtraParameters(const Params &params);
 
+    /**
+     * True if a prefix of the Operate output can be inverted at a lower accuracy,
+     * i.e. the operator describes its output with GetAccuracyLevels
+     */
+    virtual bool HasAccuracyLevels() const;
+
+    /**
+     * Prefixes of the last Operate output that are enough for a given accuracy
+     * @return pairs of (absolute Linf error bound, number of bytes from the start
+     * of the output), from the coarsest to the finest. Empty if the whole output
+     * is always needed.
+     */
+    virtual std::vector<std::pair<double, size_t>> GetAccuracyLevels() const;
+
+    /**
+     * True if InverseOperate may run concurrently on separate instances of this
+     * operator, i.e. the underlying library keeps no global decoding state
+     */
+    virtual bool IsInverseThreadSafe() const noexcept;
+
     /**
      * @param dataIn
      * @param blockStart
@@ -135,6 +135,12 @@ Selection &Selection::SetAccuracy(double error, double norm, bool relative)
     return *this;
 }
 
+Selection &Selection::SetLevelOfDetail(size_t level)
+{
+    m_LevelOfDetail = level;
+    return *this;
+}
+
 void Selection::Clear()
 {
     m_Type = SelectionType::All;
@@ -148,6 +154,7 @@ void Selection::Clear()
     m_MemoryCount.clear();
     m_HasMemory = false;
     m_Accuracy = {0.0, 0.0, false};
+    m_LevelOfDetail = 0;
 }
 
 //============================================================================
@@ -197,6 +204,13 @@ Selection Selection::WithAccuracy(double error, double norm, bool relative) cons
     return WithAccuracy(Accuracy{error, norm, relative});
 }
 
+Selection Selection::WithLevelOfDetail(size_t level) const
+{
+    Selection sel = *this;
+    sel.SetLevelOfDetail(level);
+    return sel;
+}
+
 std::string Selection::ToString() const
 {
     std::ostringstream os;
@@ -269,6 +283,10 @@ std::string Selection::ToString() const
         os << ", accuracy={" << m_Accuracy.error << ", " << m_Accuracy.norm << ", "
            << (m_Accuracy.relative ? "relative" : "absolute") << "}";
     }
+    if (m_LevelOfDetail)
+    {
+        os << ", level of detail " << m_LevelOfDetail;
+    }
 
     os << ")";
     return os.str();
@@ -307,5 +325,38 @@ Selection InferSelection(const VariableBase &variable)
     return sel;
 }
 
+std::string LevelOfDetailName(const std::string &name, size_t level)
+{
+    return name + "__lod" + std::to_string(level);
+}
+
+bool ParseLevelOfDetailName(const std::string &name, std::string &variableName, size_t &level)
+{
+    const size_t pos = name.rfind("__lod");
+    if (pos == std::string::npos || pos == 0 || pos + 5 == name.size() ||
+        name.size() - pos > 7 ||
+        name.find_first_not_of("0123456789", pos + 5) != std::string::npos)
+    {
+        return false;
+    }
+    variableName = name.substr(0, pos);
+    level = std::stoul(name.substr(pos + 5));
+    return true;
+}
+
+Box<Dims> LevelOfDetailBox(const Dims &start, const Dims &count, size_t level)
+{
+    const size_t factor = static_cast<size_t>(1) << level;
+    Box<Dims> box{Dims(start.size()), Dims(start.size())};
+    for (size_t d = 0; d < start.size(); ++d)
+    {
+        const size_t first = (start[d] + factor - 1) / factor;
+        const size_t end = (start[d] + count[d] + factor - 1) / factor;
+        box.first[d] = first;
+        box.second[d] = end - first;
+    }
+    return box;
+}
+
 } // end namespace core
 } // end namespace adios2
@@ -81,6 +81,15 @@ public:
     Selection &SetAccuracy(const Accuracy &accuracy);
     Selection &SetAccuracy(double error, double norm = L2_norm, bool relative = false);
 
+    /**
+     * Read a coarse level of detail written by the BP5 LevelsOfDetail
+     * parameter instead of the full resolution data. Level k keeps every
+     * 2^k-th element in each dimension; start and count stay in full
+     * resolution coordinates, see LevelOfDetailBox.
+     * @param level 0 is the full resolution
+     */
+    Selection &SetLevelOfDetail(size_t level);
+
     /** Reset to default state */
     void Clear();
 
@@ -99,6 +108,8 @@ public:
     Selection WithAccuracy(const Accuracy &accuracy) const;
     Selection WithAccuracy(double error, double norm = L2_norm, bool relative = false) const;
 
+    Selection WithLevelOfDetail(size_t level) const;
+
     //========================================================================
     // Accessors
     //========================================================================
@@ -121,6 +132,8 @@ public:
 
     const Accuracy &GetAccuracy() const noexcept { return m_Accuracy; }
 
+    size_t GetLevelOfDetail() const noexcept { return m_LevelOfDetail; }
+
     /** Human-readable string representation */
     std::string ToString() const;
 
@@ -136,6 +149,7 @@ private:
     Dims m_MemoryCount;
     bool m_HasMemory = false;
     Accuracy m_Accuracy = {0.0, 0.0, false};
+    size_t m_LevelOfDetail = 0;
 };
 
 /**
@@ -145,6 +159,28 @@ private:
  */
 Selection InferSelection(const VariableBase &variable);
 
+/** Name of the hidden companion variable holding coarse level `level` of `name` */
+std::string LevelOfDetailName(const std::string &name, size_t level);
+
+/**
+ * Splits a name made by LevelOfDetailName into the full variable and level.
+ * Other variables may use the same pattern, the writer marks its companions
+ * with the LevelsOfDetailAttribute of the full variable.
+ * @return false if `name` does not have the pattern
+ */
+bool ParseLevelOfDetailName(const std::string &name, std::string &variableName, size_t &level);
+
+/** Variable attribute the writer sets to the number of levels it wrote */
+constexpr const char *LevelsOfDetailAttribute = "LevelsOfDetailWritten";
+
+/**
+ * Maps a full resolution box to the elements of coarse level `level`.
+ * Coarse element i stands for full resolution element i * 2^level, so the
+ * box holds the coarse elements whose full resolution index is inside it.
+ * @return start and count in coarse coordinates, count may be 0
+ */
+Box<Dims> LevelOfDetailBox(const Dims &start, const Dims &count, size_t level);
+
 } // end namespace core
 } // end namespace adios2
 
@@ -110,6 +110,19 @@ size_t Variable<T>::SelectionSize(const Selection &selection) const
     const size_t stepStart = selection.GetStepStart();
     const SelectionType selType = selection.GetSelectionType();
 
+    if (selection.GetLevelOfDetail() > 0 && m_ShapeID == ShapeID::GlobalArray)
+    {
+        Dims start(m_Shape.size(), 0);
+        Dims count = m_Shape;
+        if (selType == SelectionType::BoundingBox)
+        {
+            start = selection.GetStart();
+            count = selection.GetCount();
+        }
+        const auto box = LevelOfDetailBox(start, count, selection.GetLevelOfDetail());
+        return helper::GetTotalSize(box.second) * stepCount;
+    }
+
     if (selType == SelectionType::BoundingBox)
     {
         return helper::GetTotalSize(selection.GetCount()) * stepCount;
@@ -199,6 +199,11 @@ void BP4Writer::InitParameters()
                                  "in call to BP4::Open to write");
     m_WriteToBB = !(m_BP4Serializer.m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_BP4Serializer.m_Parameters.BurstBufferDrain;
+    if (m_DrainBB)
+    {
+        m_FileDrainer.SetThreads(m_BP4Serializer.m_Parameters.BurstBufferDrainThreads);
+        m_FileDrainer.SetBandwidthLimit(m_BP4Serializer.m_Parameters.BurstBufferDrainBandwidth);
+    }
 }
 
 void BP4Writer::InitTransports()
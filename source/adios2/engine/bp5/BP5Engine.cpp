@@ -47,11 +47,11 @@ BP5Engine::GetBPMetaMetadataFileNames(const std::vector<std::string> &names) con
     return metaMetadataFileNames;
 }
 
-std::string BP5Engine::GetBPMetadataFileName(const std::string &name) const noexcept
+std::string BP5Engine::GetBPMetadataFileName(const std::string &name,
+                                             const size_t index) const noexcept
 {
     const std::string bpName = helper::RemoveTrailingSlash(name);
-    const size_t index = 0; // global metadata file is generated by rank 0
-    /* the name of the metadata file is "md.0" */
+    /* the name of the metadata file is "md.0", partitions add md.1, ... */
     const std::string bpMetaDataRankName(bpName + PathSeparator + "md." + std::to_string(index));
     return bpMetaDataRankName;
 }
@@ -12,7 +12,7 @@
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosComm.h"
-#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
+#include "adios2/toolkit/burstbuffer/FileDrainerMultiThread.h"
 #include "adios2/toolkit/format/bp5/BP5Serializer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 #include <cstdint>
@@ -63,8 +63,9 @@ public:
         uint8_t bpMinorVersion;
         uint8_t activeFlag;
         char columnMajor;     // y or n
-        uint8_t flattenSteps; // writer requests all steps flattened to one on read
-        char unused2[22];     // init to zero
+        uint8_t flattenSteps;  // writer requests all steps flattened to one on read
+        uint8_t metadataDelta; // metadata blocks are tagged keyframes and deltas
+        char unused2[21];      // init to zero
     };
     static constexpr size_t m_IndexHeaderSize = sizeof(BP5IndexTableHeader);
     static constexpr size_t m_EndianFlagPosition = offsetof(BP5IndexTableHeader, isLittleEndian);
@@ -74,6 +75,8 @@ public:
     static constexpr size_t m_ActiveFlagPosition = offsetof(BP5IndexTableHeader, activeFlag);
     static constexpr size_t m_ColumnMajorFlagPosition = offsetof(BP5IndexTableHeader, columnMajor);
     static constexpr size_t m_FlattenStepsPosition = offsetof(BP5IndexTableHeader, flattenSteps);
+    static constexpr size_t m_MetadataDeltaPosition =
+        offsetof(BP5IndexTableHeader, metadataDelta);
     static constexpr size_t m_VersionTagPosition = offsetof(BP5IndexTableHeader, VersionTag);
     static constexpr size_t m_VersionTagLength = sizeof(BP5IndexTableHeader().VersionTag);
     static constexpr size_t m_HeaderTailPadding = sizeof(BP5IndexTableHeader().unused2);
@@ -85,6 +88,8 @@ public:
     {
         StepRecord = 's',
         WriterMapRecord = 'w',
+        /** where each metadata file holds its part of the next step */
+        MetadataPartitionRecord = 'p',
     };
 
     std::vector<std::string> GetBPSubStreamNames(const std::vector<std::string> &names,
@@ -94,7 +99,10 @@ public:
     GetBPMetadataFileNames(const std::vector<std::string> &names) const noexcept;
     std::vector<std::string>
     GetBPMetaMetadataFileNames(const std::vector<std::string> &names) const noexcept;
-    std::string GetBPMetadataFileName(const std::string &name) const noexcept;
+    /** md.<index>, partition index of the metadata, 0 unless the writer
+     * used NumMetadataFiles */
+    std::string GetBPMetadataFileName(const std::string &name,
+                                      const size_t index = 0) const noexcept;
     std::string GetBPMetaMetadataFileName(const std::string &name) const noexcept;
     std::vector<std::string>
     GetBPMetadataIndexFileNames(const std::vector<std::string> &names) const noexcept;
@@ -141,6 +149,8 @@ public:
     MACRO(StreamReader, Bool, bool, false)                                                         \
     MACRO(BurstBufferDrain, Bool, bool, true)                                                      \
     MACRO(BurstBufferPath, String, std::string, "")                                                \
+    MACRO(BurstBufferDrainThreads, UInt, unsigned int, 1)                                          \
+    MACRO(BurstBufferDrainBandwidth, SizeBytes, size_t, 0)                                         \
     MACRO(NodeLocal, Bool, bool, false)                                                            \
     MACRO(verbose, Int, int, 0)                                                                    \
     MACRO(NumAggregators, UInt, unsigned int, 0)                                                   \
@@ -163,8 +173,10 @@ public:
     MACRO(SelectSteps, String, std::string, "")                                                    \
     MACRO(ReaderShortCircuitReads, Bool, bool, false)                                              \
     MACRO(StatsLevel, UInt, unsigned int, 1)                                                       \
+    MACRO(StatsThreads, UInt, unsigned int, 1)                                                     \
     MACRO(Threads, UInt, unsigned int, 0)                                                          \
     MACRO(MetadataThreads, UInt, unsigned int, 8)                                                  \
+    MACRO(NodeSharedMetadata, Bool, bool, false)                                                   \
     MACRO(UseOneTimeAttributes, Bool, bool, true)                                                  \
     MACRO(UseSelectiveMetadataAggregation, Bool, bool, true)                                       \
     MACRO(OneLevelGatherRanksLimit, Int, int, 6000)                                                \
@@ -174,7 +186,16 @@ public:
     MACRO(RemoteHost, String, std::string, "")                                                     \
     MACRO(UUID, String, std::string, "")                                                           \
     MACRO(TarInfo, String, std::string, "")                                                        \
-    MACRO(MaxOpenFilesAtOnce, UInt, unsigned int, UINT_MAX)
+    MACRO(MaxOpenFilesAtOnce, UInt, unsigned int, UINT_MAX)                                        \
+    MACRO(OpenAheadFiles, UInt, unsigned int, 0)                                                   \
+    MACRO(ReadCoalesceGap, SizeBytes, size_t, 0)                                                   \
+    MACRO(ProfileTraceRecords, UInt, unsigned int, 0)                                              \
+    MACRO(LevelsOfDetail, UInt, unsigned int, 0)                                                   \
+    MACRO(LevelOfDetailMethod, String, std::string, "average")                                     \
+    MACRO(DecompressThreads, UInt, unsigned int, 0)                                                \
+    MACRO(PrefixCacheSize, SizeBytes, size_t, 64 * 1024 * 1024)                                    \
+    MACRO(MetadataDeltaKeyframe, UInt, unsigned int, 0)                                            \
+    MACRO(NumMetadataFiles, UInt, unsigned int, 1)
 
     struct BP5Params
     {
@@ -6,15 +6,23 @@
  *
  */
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <errno.h>
+#include <future>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <tuple>
+#include <unordered_map>
 
 #include "adios2/helper/adiosMath.h" // SetWithinLimit
+#include "adios2/helper/adiosPartitioner.h"
 #include "adios2/toolkit/remote/EVPathRemote.h"
 #include "adios2/toolkit/remote/XrootdHttpRemote.h"
 #include "adios2/toolkit/remote/XrootdRemote.h"
@@ -79,7 +87,7 @@ void BP5Reader::DestructorClose(bool Verbose) noexcept
 
 void BP5Reader::GetMetadata(char **md, size_t *size)
 {
-    uint64_t sizes[3] = {m_Metadata.Size(), m_MetaMetadata.m_Buffer.size(),
+    uint64_t sizes[3] = {MetadataSize(), m_MetaMetadata.m_Buffer.size(),
                          m_MetadataIndex.m_Buffer.size()};
 
     /* BP5 modifies the metadata block in memory during processing
@@ -91,7 +99,18 @@ void BP5Reader::GetMetadata(char **md, size_t *size)
         std::string metadataFile(GetBPMetadataFileName(m_Name));
         m_MDFile = m_DataFiles->Acquire(metadataFile, m_dataIsRemote);
     }
-    m_MDFile->Read(mdbuf.data(), sizes[0], 0);
+    if (std::any_of(m_MetadataIndexTable.begin(), m_MetadataIndexTable.end(),
+                    [](const std::pair<const uint64_t, std::vector<uint64_t>> &e) {
+                        return e.second.size() > 5;
+                    }))
+    {
+        // assembled from the md.<k> files as the index has it
+        ReadMetadataPartitions(mdbuf.data(), Now(), Seconds(0.0));
+    }
+    else
+    {
+        m_MDFile->Read(mdbuf.data(), sizes[0], 0);
+    }
 
     size_t mdsize = sizes[0] + sizes[1] + sizes[2] + 3 * sizeof(uint64_t);
     *md = (char *)malloc(mdsize);
@@ -153,6 +172,8 @@ void BP5Reader::ProcessMetadataFromMemory(const char *md)
                                                         (m_OpenMode == Mode::ReadRandomAccess),
                                                         false, m_Minifooter.IsLittleEndian);
         m_BP5Deserializer->m_Engine = this;
+        m_BP5Deserializer->m_DecompressThreads = m_Parameters.DecompressThreads;
+        m_BP5Deserializer->m_PrefixCacheSize = m_Parameters.PrefixCacheSize;
     }
 
     if (m_StepsCount > stepsBefore)
@@ -181,8 +202,19 @@ void BP5Reader::InstallMetadataForTimestep(size_t Step)
     {
         // variable metadata for timestep
         size_t ThisMDSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
-        char *ThisMD = m_Metadata.Data() + MDPosition;
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisMD = MetadataData() + MDPosition;
+        MDPosition += ThisMDSize;
+        // blocks are decoded in place, not in the read only shared window
+        if (m_MetadataDelta)
+        {
+            ThisMD = m_BP5Deserializer->ExpandMetadata(ThisMD, ThisMDSize, WriterRank,
+                                                       m_SharedMetadata != nullptr);
+        }
+        else if (m_SharedMetadata)
+        {
+            ThisMD = m_BP5Deserializer->PrivateMetadataCopy(ThisMD, ThisMDSize);
+        }
         if ((m_OpenMode == Mode::ReadRandomAccess) || (m_FlattenSteps))
         {
             m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, WriterRank, Step);
@@ -191,15 +223,20 @@ void BP5Reader::InstallMetadataForTimestep(size_t Step)
         {
             m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, WriterRank);
         }
-        MDPosition += ThisMDSize;
     }
     for (size_t WriterRank = 0; WriterRank < WriterCount; WriterRank++)
     {
         // attribute metadata for timestep
         size_t ThisADSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
-        char *ThisAD = m_Metadata.Data() + MDPosition;
-        if (ThisADSize > 0)
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisAD = MetadataData() + MDPosition;
+        if (ThisADSize > 0 && m_SharedMetadata)
+        {
+            // the attributes are copied out when installed, a temporary copy
+            std::vector<char> AttributeCopy(ThisAD, ThisAD + ThisADSize);
+            m_BP5Deserializer->InstallAttributeData(AttributeCopy.data(), ThisADSize);
+        }
+        else if (ThisADSize > 0)
             m_BP5Deserializer->InstallAttributeData(ThisAD, ThisADSize);
         MDPosition += ThisADSize;
     }
@@ -213,7 +250,7 @@ void BP5Reader::ParallelInstallMetadataForTimestep(size_t Step)
     size_t nextRank = 0;
     std::mutex mutexRankMetadata;
     std::vector<size_t> MDsize_vec(WriterCount);
-    std::vector<size_t> MDpos_vec(WriterCount);
+    std::vector<char *> MD_vec(WriterCount);
     std::vector<void *> PreppedBuffer_vec(WriterCount);
     std::vector<FFSTypeHandle> FFSFormat_vec(WriterCount);
 
@@ -237,8 +274,10 @@ void BP5Reader::ParallelInstallMetadataForTimestep(size_t Step)
                 break;
             }
             size_t ThisMDSize = MDsize_vec[rank];
-            char *ThisMD = m_Metadata.Data() + MDpos_vec[rank];
+            char *ThisMD = MD_vec[rank];
             FFSTypeHandle FFSFormat = FFSFormat_vec[rank];
+            profiling::TraceGuard trace(m_JSONProfiler.Tracer(), m_TraceInstallMetadata,
+                                        ThisMDSize);
             void *PreppedBuffer =
                 m_BP5Deserializer->MetadataBufferPrep(ThisMD, ThisMDSize, rank, FFSFormat);
             {
@@ -258,12 +297,23 @@ void BP5Reader::ParallelInstallMetadataForTimestep(size_t Step)
     {
         // variable metadata for timestep
         size_t ThisMDSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisMD = MetadataData() + MDPosition;
+        MDPosition += ThisMDSize;
+        // blocks are decoded in place, not in the read only shared window
+        if (m_MetadataDelta)
+        {
+            // deltas build on the previous record of the same rank, in order
+            ThisMD = m_BP5Deserializer->ExpandMetadata(ThisMD, ThisMDSize, WriterRank,
+                                                       m_SharedMetadata != nullptr);
+        }
+        else if (m_SharedMetadata)
+        {
+            ThisMD = m_BP5Deserializer->PrivateMetadataCopy(ThisMD, ThisMDSize);
+        }
         MDsize_vec[WriterRank] = ThisMDSize;
-        MDpos_vec[WriterRank] = MDPosition;
-        char *ThisMD = m_Metadata.Data() + MDPosition;
+        MD_vec[WriterRank] = ThisMD;
         FFSFormat_vec[WriterRank] = m_BP5Deserializer->BufferMetaMetaPrep(ThisMD);
-        MDPosition += ThisMDSize;
     }
 
     {
@@ -301,9 +351,15 @@ void BP5Reader::ParallelInstallMetadataForTimestep(size_t Step)
     {
         // attribute metadata for timestep
         size_t ThisADSize =
-            helper::ReadValue<uint64_t>(m_Metadata.Data(), Position, m_Minifooter.IsLittleEndian);
-        char *ThisAD = m_Metadata.Data() + MDPosition;
-        if (ThisADSize > 0)
+            helper::ReadValue<uint64_t>(MetadataData(), Position, m_Minifooter.IsLittleEndian);
+        char *ThisAD = MetadataData() + MDPosition;
+        if (ThisADSize > 0 && m_SharedMetadata)
+        {
+            // the attributes are copied out when installed, a temporary copy
+            std::vector<char> AttributeCopy(ThisAD, ThisAD + ThisADSize);
+            m_BP5Deserializer->InstallAttributeData(AttributeCopy.data(), ThisADSize);
+        }
+        else if (ThisADSize > 0)
             m_BP5Deserializer->InstallAttributeData(ThisAD, ThisADSize);
         MDPosition += ThisADSize;
     }
@@ -447,13 +503,23 @@ double BP5Reader::ReadData(PoolableFile *DataFile, const size_t WriterRank, cons
     /*
      * Warning: this function is called by multiple threads
      */
-    size_t FlushCount = m_MetadataIndexTable[Timestep][2];
-    size_t DataPosPos = m_MetadataIndexTable[Timestep][3];
+    TP startRead = NOW();
+    DataFile->Read(Destination, Length, DataFilePosition(WriterRank, Timestep, StartOffset));
+    TP endRead = NOW();
+    double timeRead = DURATION(startRead, endRead);
+    return timeRead;
+}
+
+size_t BP5Reader::DataFilePosition(const size_t WriterRank, const size_t Timestep,
+                                   const size_t StartOffset) const
+{
+    const auto &ptrs = m_MetadataIndexTable.at(Timestep);
+    size_t FlushCount = ptrs[2];
+    size_t DataPosPos = ptrs[3];
 
     /* Each block is in exactly one flush. The StartOffset was calculated
        as if all the flushes were in a single contiguous block in file.
     */
-    TP startRead = NOW();
     size_t InfoStartPos = DataPosPos + (WriterRank * (2 * FlushCount + 1) * sizeof(uint64_t));
     size_t SumDataSize = 0; // count in contiguous space
     for (size_t flush = 0; flush < FlushCount; flush++)
@@ -466,23 +532,14 @@ double BP5Reader::ReadData(PoolableFile *DataFile, const size_t WriterRank, cons
         if (StartOffset < SumDataSize + ThisDataSize)
         {
             // discount offsets of skipped flushes
-            size_t Offset = StartOffset - SumDataSize;
-            DataFile->Read(Destination, Length, ThisDataPos + Offset);
-            TP endRead = NOW();
-            double timeRead = DURATION(startRead, endRead);
-            return timeRead;
+            return ThisDataPos + StartOffset - SumDataSize;
         }
         SumDataSize += ThisDataSize;
     }
 
     size_t ThisDataPos = helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, InfoStartPos,
                                                      m_Minifooter.IsLittleEndian);
-    size_t Offset = StartOffset - SumDataSize;
-    DataFile->Read(Destination, Length, ThisDataPos + Offset);
-
-    TP endRead = NOW();
-    double timeRead = DURATION(startRead, endRead);
-    return timeRead;
+    return ThisDataPos + StartOffset - SumDataSize;
 }
 
 void BP5Reader::PerformGets()
@@ -871,6 +928,7 @@ void BP5Reader::PerformRemoteGets()
             {
                 break;
             }
+            profiling::TraceGuard trace(m_JSONProfiler.Tracer(), m_TraceRemoteGet);
             m_Remote->WaitForGet(handles[reqidx]);
             // std::cout << "BP5Reader::PerformRemoteGets: thread " << threadID
             //           << " done with response " << reqidx << std::endl;
@@ -908,59 +966,284 @@ void BP5Reader::PerformRemoteGets()
     }
 }
 
-void BP5Reader::PerformLocalGets()
+void BP5Reader::CheckWriterActiveOnce()
 {
-    auto lf_CompareReqSubfile =
-        [&](const adios2::format::BP5Deserializer::ReadRequest &r1,
-            const adios2::format::BP5Deserializer::ReadRequest &r2) -> bool {
-        return (m_WriterMap[m_WriterMapIndex[r1.Timestep]].RankToSubfile[r1.WriterRank] <
-                m_WriterMap[m_WriterMapIndex[r2.Timestep]].RankToSubfile[r2.WriterRank]);
-    };
-
-    if (!m_InitialWriterActiveCheckDone)
+    if (m_InitialWriterActiveCheckDone)
     {
-        CheckWriterActive();
-        m_InitialWriterActiveCheckDone = true;
-        if (!m_WriterIsActive)
-        {
-            Params transportParameters;
-            transportParameters["FailOnEOF"] = "true";
-            m_DataFiles->SetParameters(transportParameters);
-            if (m_MDIndexFile)
-                m_MDIndexFile->SetParameters(transportParameters);
-            if (m_MDFile)
-                m_MDFile->SetParameters(transportParameters);
-            if (m_MetaMetadataFile)
-                m_MetaMetadataFile->SetParameters(transportParameters);
-        }
+        return;
+    }
+    CheckWriterActive();
+    m_InitialWriterActiveCheckDone = true;
+    if (!m_WriterIsActive)
+    {
+        Params transportParameters;
+        transportParameters["FailOnEOF"] = "true";
+        m_DataFiles->SetParameters(transportParameters);
+        if (m_MDIndexFile)
+            m_MDIndexFile->SetParameters(transportParameters);
+        if (m_MDFile)
+            m_MDFile->SetParameters(transportParameters);
+        if (m_MetaMetadataFile)
+            m_MetaMetadataFile->SetParameters(transportParameters);
     }
+}
+
+void BP5Reader::PerformLocalGets()
+{
+    CheckWriterActiveOnce();
     // TP start = NOW();
     PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGets");
-    m_JSONProfiler.Start("DataRead");
+    m_JSONProfiler.Start(m_TraceDataRead);
     size_t maxReadSize;
 
     // TP startGenerate = NOW();
     auto ReadRequests = m_BP5Deserializer->GenerateReadRequests(false, &maxReadSize);
     size_t nRequest = ReadRequests.size();
+    // a single reading thread can hand the other threads to large copies
+    const bool parallelFinalize =
+        (m_Threads > 1 && nRequest > 1) || m_Parameters.DecompressThreads > 0;
+    m_BP5Deserializer->m_CopyThreads = parallelFinalize ? 1 : std::max<size_t>(m_Threads, 1);
     // TP endGenerate = NOW();
     // double generateTime = DURATION(startGenerate, endGenerate);
 
-    size_t nextRequest = 0;
+    // with DecompressThreads, operated blocks are read into buffers of their
+    // own and decompressed by a pool of threads while the next ones are read
+    struct DecompressTask
+    {
+        adios2::format::BP5Deserializer::ReadRequest Read;
+        std::vector<char> Data;
+    };
+    const size_t nDecompress = m_Parameters.DecompressThreads;
+    std::deque<DecompressTask> decompressQueue;
+    std::vector<std::vector<char>> decompressInputs; // recycled read buffers
+    std::mutex mutexDecompress;
+    std::condition_variable decompressQueued;   // a task was queued or reading is done
+    std::condition_variable decompressStarted;  // a task was taken from the queue
+    bool readingDone = false;
+    std::exception_ptr decompressError;
+
+    auto lf_Decompressor = [&]() {
+        while (true)
+        {
+            DecompressTask task;
+            {
+                std::unique_lock<std::mutex> lock(mutexDecompress);
+                decompressQueued.wait(lock,
+                                      [&]() { return !decompressQueue.empty() || readingDone; });
+                if (decompressQueue.empty())
+                {
+                    return;
+                }
+                task = std::move(decompressQueue.front());
+                decompressQueue.pop_front();
+                if (decompressError)
+                {
+                    // the deserializer dropped its pending requests
+                    continue;
+                }
+            }
+            decompressStarted.notify_one();
+            try
+            {
+                m_BP5Deserializer->FinalizeGet(task.Read, false);
+            }
+            catch (...)
+            {
+                {
+                    std::lock_guard<std::mutex> lockGuard(mutexDecompress);
+                    decompressError = std::current_exception();
+                }
+                decompressStarted.notify_all();
+            }
+            std::lock_guard<std::mutex> lockGuard(mutexDecompress);
+            decompressInputs.push_back(std::move(task.Data));
+        }
+    };
+
+    auto lf_DecompressInput = [&](const size_t size) -> std::vector<char> {
+        std::vector<char> input;
+        {
+            std::lock_guard<std::mutex> lockGuard(mutexDecompress);
+            if (!decompressInputs.empty())
+            {
+                input = std::move(decompressInputs.back());
+                decompressInputs.pop_back();
+            }
+        }
+        input.resize(size);
+        return input;
+    };
+
+    // at most two blocks per thread wait for decompression, then reading stalls
+    auto lf_QueueDecompress = [&](const adios2::format::BP5Deserializer::ReadRequest &Read,
+                                  std::vector<char> &&input) {
+        {
+            std::unique_lock<std::mutex> lock(mutexDecompress);
+            decompressStarted.wait(lock, [&]() {
+                return decompressQueue.size() < 2 * nDecompress || decompressError;
+            });
+            decompressQueue.push_back({Read, std::move(input)});
+            decompressQueue.back().Read.DestinationAddr = decompressQueue.back().Data.data();
+        }
+        decompressQueued.notify_one();
+    };
+
+    auto lf_DecompressFailed = [&]() -> bool {
+        std::lock_guard<std::mutex> lockGuard(mutexDecompress);
+        return static_cast<bool>(decompressError);
+    };
+
+    std::vector<std::future<void>> decompressors;
+    struct DecompressorsGuard
+    {
+        std::mutex &Mutex;
+        std::condition_variable &Queued;
+        bool &Done;
+        std::vector<std::future<void>> &Futures;
+        void Join()
+        {
+            {
+                std::lock_guard<std::mutex> lockGuard(Mutex);
+                Done = true;
+            }
+            Queued.notify_all();
+            for (auto &f : Futures)
+            {
+                if (f.valid())
+                {
+                    f.get();
+                }
+            }
+        }
+        ~DecompressorsGuard() { Join(); }
+    } decompressorsGuard{mutexDecompress, decompressQueued, readingDone, decompressors};
+    for (size_t i = 0; i < nDecompress && nRequest > 0; ++i)
+    {
+        decompressors.push_back(std::async(std::launch::async, lf_Decompressor));
+    }
+
+    // requests in the order of their subfiles and of their data in them,
+    // those close to each other are read together in groups
+    std::vector<size_t> filePositions;
+    const std::vector<ReadGroup> groups =
+        CoalesceReads(ReadRequests, filePositions, nDecompress > 0);
+    const size_t nGroup = groups.size();
+
+    size_t nextGroup = 0;
     std::mutex mutexReadRequests;
 
-    auto lf_GetNextRequest = [&]() -> size_t {
+    auto lf_GetNextGroup = [&]() -> size_t {
         std::lock_guard<std::mutex> lockGuard(mutexReadRequests);
-        size_t reqidx = MaxSizeT;
-        if (nextRequest < nRequest)
+        size_t groupidx = MaxSizeT;
+        if (nextGroup < nGroup)
         {
-            reqidx = nextRequest;
-            ++nextRequest;
+            groupidx = nextGroup;
+            ++nextGroup;
+            m_JSONProfiler.AddBytes(m_TraceDataReadBytes,
+                                    groups[groupidx].FileEnd - groups[groupidx].FileStart);
         }
-        if (reqidx <= nRequest)
+        return groupidx;
+    };
+
+    // subfiles in the order the read loop will reach them, to open the next
+    // OpenAheadFiles ones in the background while reading the current one
+    std::vector<size_t> subfileOrder;
+    std::unordered_map<size_t, size_t> subfilePosition;
+    auto lf_PlanOpenAhead = [&]() {
+        if (m_Parameters.OpenAheadFiles == 0)
         {
-            m_JSONProfiler.AddBytes("dataread", ReadRequests[reqidx].ReadLength);
+            return;
         }
-        return reqidx;
+        for (const auto &group : groups)
+        {
+            if (subfilePosition.emplace(group.Subfile, subfileOrder.size()).second)
+            {
+                subfileOrder.push_back(group.Subfile);
+            }
+        }
+    };
+
+    auto lf_OpenAhead = [&](const size_t SubfileNum) {
+        auto it = subfilePosition.find(SubfileNum);
+        if (it == subfilePosition.end())
+        {
+            return;
+        }
+        std::vector<std::string> names;
+        for (size_t i = it->second + 1;
+             i < subfileOrder.size() && names.size() < m_Parameters.OpenAheadFiles; ++i)
+        {
+            names.push_back(
+                GetBPSubStreamName(m_Name, subfileOrder[i], m_Minifooter.HasSubFiles, true));
+        }
+        m_DataFiles->OpenAhead(names);
+    };
+
+    /* reads the requests of a group and finalizes them, buf is scratch space
+     * of maxReadSize and groupBuf grows to the largest group read */
+    auto lf_ReadGroup = [&](const ReadGroup &group, PoolableFile *DataFile, std::vector<char> &buf,
+                            std::vector<char> &groupBuf) -> double {
+        if (group.Count == 1)
+        {
+            auto &Req = ReadRequests[group.First];
+            std::vector<char> input;
+            char *Destination = Req.DestinationAddr;
+            const bool deferred =
+                nDecompress && !Destination && m_BP5Deserializer->NeedsDecompression(Req);
+            if (deferred)
+            {
+                input = lf_DecompressInput(Req.ReadLength);
+                Destination = input.data();
+            }
+            else if (!Destination)
+            {
+                Req.DestinationAddr = Destination = buf.data();
+            }
+            profiling::TraceGuard trace(m_JSONProfiler.Tracer(), m_TraceReadRequest,
+                                        Req.ReadLength);
+            double timeRead = ReadData(DataFile, Req.WriterRank, Req.Timestep, Req.StartOffset,
+                                       Req.ReadLength, Destination);
+            if (deferred)
+            {
+                lf_QueueDecompress(Req, std::move(input));
+            }
+            else
+            {
+                m_BP5Deserializer->FinalizeGet(Req, false);
+            }
+            return timeRead;
+        }
+
+        // one read for the group, then each request takes its part of it
+        const size_t span = group.FileEnd - group.FileStart;
+        if (groupBuf.size() < span)
+        {
+            groupBuf.resize(span);
+        }
+        double timeRead = 0.0;
+        {
+            profiling::TraceGuard trace(m_JSONProfiler.Tracer(), m_TraceReadRequest, span);
+            TP startRead = NOW();
+            DataFile->Read(groupBuf.data(), span, group.FileStart);
+            TP endRead = NOW();
+            timeRead = DURATION(startRead, endRead);
+        }
+        for (size_t i = group.First; i < group.First + group.Count; ++i)
+        {
+            auto &Req = ReadRequests[i];
+            char *part = groupBuf.data() + (filePositions[i] - group.FileStart);
+            if (Req.DestinationAddr)
+            {
+                // application memory or a buffer of the request's own
+                std::memcpy(Req.DestinationAddr, part, Req.ReadLength);
+            }
+            else
+            {
+                Req.DestinationAddr = part;
+            }
+            m_BP5Deserializer->FinalizeGet(Req, false);
+        }
+        return timeRead;
     };
 
     auto lf_Reader = [&](const int FileManagerID,
@@ -970,24 +1253,20 @@ void BP5Reader::PerformLocalGets()
         double subfileTotal = 0.0;
         size_t nReads = 0;
         std::vector<char> buf(maxReadSize);
+        std::vector<char> groupBuf;
 
         std::unique_ptr<PoolableFile> DataFile = nullptr;
         size_t LastSubfileNum = -1;
         while (true)
         {
             double timeSubfile = 0.0;
-            const auto reqidx = lf_GetNextRequest();
-            if (reqidx > nRequest)
+            const auto groupidx = lf_GetNextGroup();
+            if (groupidx >= nGroup || (nDecompress && lf_DecompressFailed()))
             {
                 break;
             }
-            auto &Req = ReadRequests[reqidx];
-            if (!Req.DestinationAddr)
-            {
-                Req.DestinationAddr = buf.data();
-            }
-            size_t SubfileNum = static_cast<size_t>(
-                m_WriterMap[m_WriterMapIndex[Req.Timestep]].RankToSubfile[Req.WriterRank]);
+            const auto &group = groups[groupidx];
+            size_t SubfileNum = group.Subfile;
 
             // if we're on the same subfile, DataFile is already valid
             // (We're Acquiring the datafile here rather than in ReadData to increase reuse in case
@@ -997,34 +1276,29 @@ void BP5Reader::PerformLocalGets()
                 TP startSubfile = NOW();
                 const std::string subFileName =
                     GetBPSubStreamName(m_Name, SubfileNum, m_Minifooter.HasSubFiles, true);
+                lf_OpenAhead(SubfileNum);
                 DataFile = m_DataFiles->Acquire(subFileName);
+                LastSubfileNum = SubfileNum;
 
                 TP endSubfile = NOW();
                 timeSubfile += DURATION(startSubfile, endSubfile);
             }
-            double timeRead = ReadData(DataFile.get(), Req.WriterRank, Req.Timestep,
-                                       Req.StartOffset, Req.ReadLength, Req.DestinationAddr);
-
-            TP startCopy = NOW();
-            m_BP5Deserializer->FinalizeGet(Req, false);
-            TP endCopy = NOW();
+            TP startGroup = NOW();
+            double timeRead = lf_ReadGroup(group, DataFile.get(), buf, groupBuf);
+            TP endGroup = NOW();
             subfileTotal += timeSubfile;
             readTotal += timeRead;
-            copyTotal += DURATION(startCopy, endCopy);
-            ++nReads;
+            copyTotal += DURATION(startGroup, endGroup) - timeRead;
+            nReads += group.Count;
         }
         return std::make_tuple(subfileTotal, readTotal, copyTotal, nReads);
     };
 
     // TP startRead = NOW();
-    // double sortTime = 0.0;
-    if (m_Threads > 1 && nRequest > 1)
+    lf_PlanOpenAhead();
+    if (m_Threads > 1 && nGroup > 1)
     {
-        // TP startSort = NOW();
-        std::sort(ReadRequests.begin(), ReadRequests.end(), lf_CompareReqSubfile);
-        // TP endSort = NOW();
-        // sortTime = DURATION(startSort, endSort);
-        size_t nThreads = (m_Threads < nRequest ? m_Threads : nRequest);
+        size_t nThreads = (m_Threads < nGroup ? m_Threads : nGroup);
 
         size_t maxOpenFiles = helper::SetWithinLimit(
             (size_t)m_Parameters.MaxOpenFilesAtOnce / nThreads, (size_t)1, MaxSizeT);
@@ -1058,47 +1332,439 @@ void BP5Reader::PerformLocalGets()
     }
     else
     {
-        std::vector<char> buf(maxReadSize);
-        std::unique_ptr<PoolableFile> DataFile = nullptr;
-        size_t LastSubfileNum = -1;
-        for (auto &Req : ReadRequests)
+        lf_Reader(0, m_Parameters.MaxOpenFilesAtOnce);
+    }
+    decompressorsGuard.Join();
+    if (decompressError)
+    {
+        std::rethrow_exception(decompressError);
+    }
+    m_BP5Deserializer->FinalizeDerivedGets(ReadRequests);
+    m_BP5Deserializer->ClearGetState();
+    m_JSONProfiler.Stop(m_TraceDataRead);
+    /*TP end = NOW();
+    double t1 = DURATION(start, end);
+    double t2 = DURATION(startRead, end);
+    std::cout << " -> PerformGets() total = " << t1 << "s, Read loop = " << t2
+              << "s, sort = " << sortTime << "s, generate = " << generateTime
+              << ", nRequests = " << nRequest << std::endl;*/
+}
+
+std::vector<BP5Reader::ReadGroup>
+BP5Reader::CoalesceReads(std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests,
+                         std::vector<size_t> &FilePositions, const bool deferDecompression)
+{
+    const size_t nRequest = ReadRequests.size();
+    std::vector<size_t> subfiles(nRequest), positions(nRequest), order(nRequest);
+    for (size_t i = 0; i < nRequest; ++i)
+    {
+        const auto &Req = ReadRequests[i];
+        subfiles[i] = static_cast<size_t>(
+            m_WriterMap[m_WriterMapIndex[Req.Timestep]].RankToSubfile[Req.WriterRank]);
+        positions[i] = DataFilePosition(Req.WriterRank, Req.Timestep, Req.StartOffset);
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+        return std::tie(subfiles[a], positions[a]) < std::tie(subfiles[b], positions[b]);
+    });
+
+    std::vector<format::BP5Deserializer::ReadRequest> sorted;
+    sorted.reserve(nRequest);
+    FilePositions.resize(nRequest);
+    std::vector<ReadGroup> groups;
+    bool lastAlone = true;
+    for (size_t i = 0; i < nRequest; ++i)
+    {
+        const size_t r = order[i];
+        sorted.push_back(ReadRequests[r]);
+        FilePositions[i] = positions[r];
+        const auto &Req = sorted.back();
+        const size_t end = positions[r] + Req.ReadLength;
+        // blocks decompressed on the thread pool are read into buffers of
+        // their own, large reads gain nothing from a copy
+        const bool alone =
+            (deferDecompression && !Req.DestinationAddr &&
+             m_BP5Deserializer->NeedsDecompression(Req)) ||
+            Req.ReadLength >= CoalescedReadMaxSize;
+        if (!alone && !lastAlone && groups.back().Subfile == subfiles[r] &&
+            positions[r] <= groups.back().FileEnd + m_Parameters.ReadCoalesceGap &&
+            std::max(end, groups.back().FileEnd) - groups.back().FileStart <= CoalescedReadMaxSize)
+        {
+            groups.back().Count++;
+            groups.back().FileEnd = std::max(end, groups.back().FileEnd);
+        }
+        else
+        {
+            groups.push_back({i, 1, subfiles[r], positions[r], end});
+        }
+        lastAlone = alone;
+    }
+    ReadRequests.swap(sorted);
+    return groups;
+}
+
+size_t BP5Reader::DataFlushOf(const size_t WriterRank, const size_t Timestep,
+                              const size_t Offset) const
+{
+    const auto &ptrs = m_MetadataIndexTable.at(Timestep);
+    const size_t FlushCount = ptrs[2];
+    size_t InfoStartPos = ptrs[3] + (WriterRank * (2 * FlushCount + 1) * sizeof(uint64_t));
+    size_t SumDataSize = 0;
+    for (size_t flush = 0; flush < FlushCount; flush++)
+    {
+        helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, InfoStartPos,
+                                    m_Minifooter.IsLittleEndian);
+        SumDataSize += helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, InfoStartPos,
+                                                   m_Minifooter.IsLittleEndian);
+        if (Offset < SumDataSize)
         {
-            if (!Req.DestinationAddr)
+            return flush;
+        }
+    }
+    return FlushCount;
+}
+
+namespace
+{
+/* bytes [Start, End) of a writer's data in a step, as requested by a rank */
+struct CollectiveRange
+{
+    uint64_t Timestep;
+    uint64_t WriterRank;
+    uint64_t Start;
+    uint64_t End;
+    int Rank;
+    size_t Request; // index in the read requests of Rank
+};
+
+/* bytes [Start, End) read by Owner for the ranges [First, Last) touching it */
+struct CollectiveChunk
+{
+    uint64_t Start;
+    uint64_t End;
+    size_t First;
+    size_t Last;
+    int Owner;
+};
+
+constexpr int CollectiveGetsTag = 5346;
+}
+
+void BP5Reader::PerformCollectiveGets()
+{
+    if (m_Comm.Size() < 2 || m_dataIsRemote)
+    {
+        PerformGets();
+        return;
+    }
+    PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformCollectiveGets");
+    CheckWriterActiveOnce();
+    m_JSONProfiler.Start(m_TraceDataRead);
+    const int rank = m_Comm.Rank();
+    const int nRanks = m_Comm.Size();
+
+    size_t maxReadSize;
+    auto ReadRequests = m_BP5Deserializer->GenerateReadRequests(true, &maxReadSize);
+
+    // every rank learns what all ranks read and makes the same plan
+    std::vector<uint64_t> mine;
+    mine.reserve(4 * ReadRequests.size());
+    for (const auto &Req : ReadRequests)
+    {
+        mine.push_back(static_cast<uint64_t>(Req.Timestep));
+        mine.push_back(static_cast<uint64_t>(Req.WriterRank));
+        mine.push_back(static_cast<uint64_t>(Req.StartOffset));
+        mine.push_back(static_cast<uint64_t>(Req.ReadLength));
+    }
+    const std::vector<size_t> counts = m_Comm.AllGatherValues(mine.size());
+    std::vector<size_t> displs(nRanks, 0);
+    for (int r = 1; r < nRanks; ++r)
+    {
+        displs[r] = displs[r - 1] + counts[r - 1];
+    }
+    std::vector<uint64_t> all(displs.back() + counts.back());
+    if (!all.empty())
+    {
+        m_Comm.Allgatherv(mine.data(), mine.size(), all.data(), counts.data(), displs.data(),
+                          "BP5Reader::PerformCollectiveGets");
+    }
+
+    std::vector<CollectiveRange> ranges;
+    uint64_t totalBytes = 0;
+    for (int r = 0; r < nRanks; ++r)
+    {
+        for (size_t i = 0; i < counts[r] / 4; ++i)
+        {
+            const uint64_t *v = &all[displs[r] + 4 * i];
+            if (v[3] > 0)
+            {
+                ranges.push_back({v[0], v[1], v[2], v[2] + v[3], r, i});
+                totalBytes += v[3];
+            }
+        }
+    }
+    std::sort(ranges.begin(), ranges.end(),
+              [](const CollectiveRange &a, const CollectiveRange &b) {
+                  return std::tie(a.Timestep, a.WriterRank, a.Start, a.Rank, a.Request) <
+                         std::tie(b.Timestep, b.WriterRank, b.Start, b.Rank, b.Request);
+              });
+
+    // overlapping or adjacent ranges in one flush make a group. A group only
+    // one rank asked for is read by that rank as usual, the others are cut
+    // into chunks of about an even share of the bytes per rank
+    const uint64_t chunkLimit =
+        std::max<uint64_t>(totalBytes / nRanks + 1, static_cast<uint64_t>(4) * 1024 * 1024);
+    std::vector<CollectiveChunk> chunks;
+    std::vector<uint64_t> ownLoad(nRanks, 0);
+    std::vector<size_t> ownReads;
+    for (size_t first = 0; first < ranges.size();)
+    {
+        const CollectiveRange &head = ranges[first];
+        uint64_t end = head.End;
+        bool shared = false;
+        size_t last = first + 1;
+        for (; last < ranges.size(); ++last)
+        {
+            const CollectiveRange &r = ranges[last];
+            if (r.Timestep != head.Timestep || r.WriterRank != head.WriterRank || r.Start > end)
+            {
+                break;
+            }
+            if (r.Start == end && DataFlushOf(head.WriterRank, head.Timestep, end - 1) !=
+                                      DataFlushOf(head.WriterRank, head.Timestep, end))
+            {
+                break;
+            }
+            shared |= (r.Rank != head.Rank);
+            end = std::max(end, r.End);
+        }
+        if (!shared)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                ownLoad[head.Rank] += ranges[i].End - ranges[i].Start;
+                if (head.Rank == rank)
+                {
+                    ownReads.push_back(ranges[i].Request);
+                }
+            }
+        }
+        else
+        {
+            for (uint64_t start = head.Start; start < end; start += chunkLimit)
             {
-                Req.DestinationAddr = buf.data();
+                chunks.push_back({start, std::min(end, start + chunkLimit), first, last, -1});
             }
-            m_JSONProfiler.AddBytes("dataread", Req.ReadLength);
-            size_t SubfileNum = static_cast<size_t>(
-                m_WriterMap[m_WriterMapIndex[Req.Timestep]].RankToSubfile[Req.WriterRank]);
+        }
+        first = last;
+    }
 
-            // if we're on the same subfile, DataFile is already valid
-            // (We're Acquiring the datafile here rather than in ReadData to increase reuse in case
-            // multiple consecutive requests target the same subfile
+    // pieces of range i in chunk c
+    auto lf_Piece = [&](const CollectiveChunk &c, const size_t i, uint64_t &start,
+                        uint64_t &end) -> bool {
+        start = std::max(c.Start, ranges[i].Start);
+        end = std::min(c.End, ranges[i].End);
+        return start < end;
+    };
+
+    // the chunks are balanced over the ranks, then each partition goes to the
+    // rank that wants most of it, or else to the one reading least on its own
+    if (!chunks.empty())
+    {
+        std::vector<uint64_t> chunkSizes;
+        chunkSizes.reserve(chunks.size());
+        for (const auto &c : chunks)
+        {
+            chunkSizes.push_back(c.End - c.Start);
+        }
+        helper::Partitioning partitioning = helper::PartitionRanks(chunkSizes, nRanks);
+        std::vector<size_t> order(partitioning.m_Partitions.size());
+        for (size_t p = 0; p < order.size(); ++p)
+        {
+            order[p] = p;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+            return partitioning.m_Sizes[a] > partitioning.m_Sizes[b];
+        });
+        std::set<std::pair<uint64_t, int>> idle;
+        for (int r = 0; r < nRanks; ++r)
+        {
+            idle.emplace(ownLoad[r], r);
+        }
+        for (const size_t p : order)
+        {
+            if (partitioning.m_Partitions[p].empty())
+            {
+                continue;
+            }
+            std::map<int, uint64_t> wanted;
+            for (const size_t ci : partitioning.m_Partitions[p])
+            {
+                for (size_t i = chunks[ci].First; i < chunks[ci].Last; ++i)
+                {
+                    uint64_t start, end;
+                    if (lf_Piece(chunks[ci], i, start, end))
+                    {
+                        wanted[ranges[i].Rank] += end - start;
+                    }
+                }
+            }
+            int owner = idle.begin()->second;
+            uint64_t most = 0;
+            for (const auto &w : wanted)
+            {
+                if (w.second > most && idle.count({ownLoad[w.first], w.first}))
+                {
+                    owner = w.first;
+                    most = w.second;
+                }
+            }
+            idle.erase({ownLoad[owner], owner});
+            for (const size_t ci : partitioning.m_Partitions[p])
+            {
+                chunks[ci].Owner = owner;
+            }
+        }
+    }
+
+    // receive the pieces others read for this rank straight into place
+    std::vector<helper::Comm::Req> transfers;
+    for (const auto &c : chunks)
+    {
+        if (c.Owner == rank)
+        {
+            continue;
+        }
+        for (size_t i = c.First; i < c.Last; ++i)
+        {
+            uint64_t start, end;
+            if (ranges[i].Rank == rank && lf_Piece(c, i, start, end))
+            {
+                char *dest =
+                    ReadRequests[ranges[i].Request].DestinationAddr + (start - ranges[i].Start);
+                transfers.push_back(m_Comm.Irecv(dest, end - start, c.Owner, CollectiveGetsTag,
+                                                 "BP5Reader::PerformCollectiveGets"));
+            }
+        }
+    }
+
+    struct CollectiveRead
+    {
+        size_t Timestep;
+        size_t WriterRank;
+        size_t Start;
+        size_t Length;
+        char *Destination;
+    };
+    std::vector<CollectiveRead> reads;
+    for (const size_t i : ownReads)
+    {
+        const auto &Req = ReadRequests[i];
+        reads.push_back(
+            {Req.Timestep, Req.WriterRank, Req.StartOffset, Req.ReadLength, Req.DestinationAddr});
+    }
+    std::vector<std::vector<char>> chunkData(chunks.size());
+    for (size_t ci = 0; ci < chunks.size(); ++ci)
+    {
+        const auto &c = chunks[ci];
+        if (c.Owner == rank)
+        {
+            chunkData[ci].resize(c.End - c.Start);
+            reads.push_back({ranges[c.First].Timestep, ranges[c.First].WriterRank, c.Start,
+                             c.End - c.Start, chunkData[ci].data()});
+        }
+    }
+    auto lf_Subfile = [&](const CollectiveRead &r) -> size_t {
+        return static_cast<size_t>(
+            m_WriterMap[m_WriterMapIndex[r.Timestep]].RankToSubfile[r.WriterRank]);
+    };
+    std::sort(reads.begin(), reads.end(), [&](const CollectiveRead &a, const CollectiveRead &b) {
+        return std::make_tuple(lf_Subfile(a), a.Timestep, a.WriterRank, a.Start) <
+               std::make_tuple(lf_Subfile(b), b.Timestep, b.WriterRank, b.Start);
+    });
+
+    size_t nextRead = 0;
+    std::mutex mutexReads;
+    auto lf_Reader = [&]() {
+        std::unique_ptr<PoolableFile> DataFile = nullptr;
+        size_t LastSubfileNum = MaxSizeT;
+        while (true)
+        {
+            size_t idx;
+            {
+                std::lock_guard<std::mutex> lockGuard(mutexReads);
+                if (nextRead >= reads.size())
+                {
+                    return;
+                }
+                idx = nextRead++;
+                m_JSONProfiler.AddBytes(m_TraceDataReadBytes, reads[idx].Length);
+            }
+            const CollectiveRead &r = reads[idx];
+            const size_t SubfileNum = lf_Subfile(r);
             if (SubfileNum != LastSubfileNum)
             {
-                TP startSubfile = NOW();
-                const std::string subFileName =
-                    GetBPSubStreamName(m_Name, SubfileNum, m_Minifooter.HasSubFiles, true);
-                DataFile = m_DataFiles->Acquire(subFileName);
+                DataFile = m_DataFiles->Acquire(
+                    GetBPSubStreamName(m_Name, SubfileNum, m_Minifooter.HasSubFiles, true));
+                LastSubfileNum = SubfileNum;
+            }
+            profiling::TraceGuard trace(m_JSONProfiler.Tracer(), m_TraceReadRequest, r.Length);
+            ReadData(DataFile.get(), r.WriterRank, r.Timestep, r.Start, r.Length, r.Destination);
+        }
+    };
+    const size_t nThreads = std::max<size_t>(1, std::min<size_t>(m_Threads, reads.size()));
+    std::vector<std::future<void>> futures;
+    for (size_t tid = 1; tid < nThreads; ++tid)
+    {
+        futures.push_back(std::async(std::launch::async, lf_Reader));
+    }
+    lf_Reader();
+    for (auto &f : futures)
+    {
+        f.get();
+    }
 
-                TP endSubfile = NOW();
-                double timeSubfile = DURATION(startSubfile, endSubfile);
-                (void)timeSubfile;
+    // hand out the chunks this rank read
+    for (size_t ci = 0; ci < chunks.size(); ++ci)
+    {
+        const auto &c = chunks[ci];
+        if (c.Owner != rank)
+        {
+            continue;
+        }
+        for (size_t i = c.First; i < c.Last; ++i)
+        {
+            uint64_t start, end;
+            if (!lf_Piece(c, i, start, end))
+            {
+                continue;
+            }
+            const char *src = chunkData[ci].data() + (start - c.Start);
+            if (ranges[i].Rank == rank)
+            {
+                memcpy(ReadRequests[ranges[i].Request].DestinationAddr + (start - ranges[i].Start),
+                       src, end - start);
+            }
+            else
+            {
+                transfers.push_back(m_Comm.Isend(src, end - start, ranges[i].Rank,
+                                                 CollectiveGetsTag,
+                                                 "BP5Reader::PerformCollectiveGets"));
             }
-            ReadData(DataFile.get(), Req.WriterRank, Req.Timestep, Req.StartOffset, Req.ReadLength,
-                     Req.DestinationAddr);
-            m_BP5Deserializer->FinalizeGet(Req, false);
         }
     }
+    for (auto &t : transfers)
+    {
+        t.Wait("BP5Reader::PerformCollectiveGets");
+    }
+
+    for (const auto &Req : ReadRequests)
+    {
+        m_BP5Deserializer->FinalizeGet(Req, true);
+    }
     m_BP5Deserializer->FinalizeDerivedGets(ReadRequests);
     m_BP5Deserializer->ClearGetState();
-    m_JSONProfiler.Stop("DataRead");
-    /*TP end = NOW();
-    double t1 = DURATION(start, end);
-    double t2 = DURATION(startRead, end);
-    std::cout << " -> PerformGets() total = " << t1 << "s, Read loop = " << t2
-              << "s, sort = " << sortTime << "s, generate = " << generateTime
-              << ", nRequests = " << nRequest << std::endl;*/
+    m_JSONProfiler.Stop(m_TraceDataRead);
 }
 
 // PRIVATE
@@ -1257,9 +1923,22 @@ void BP5Reader::InitParameters()
     }
 
     m_Threads = m_Parameters.Threads;
+    if (m_Threads == 0 || m_Parameters.NodeSharedMetadata)
+    {
+        m_NodeComm = m_Comm.GroupByShm("creating per-node comm at BP5 Open(read)");
+    }
+    if (m_Parameters.NodeSharedMetadata)
+    {
+        // rank 0 is the first rank of its node, so it is a node leader too
+        m_NodeLeaderComm = m_Comm.Split(m_NodeComm.Rank() == 0 ? 0 : 1, m_Comm.Rank(),
+                                        "creating node leaders comm at BP5 Open(read)");
+        // nothing to share if every node has a single rank
+        int nodeSize = m_NodeComm.Size(), maxNodeSize = 0;
+        m_Comm.Allreduce(&nodeSize, &maxNodeSize, 1, helper::Comm::Op::Max);
+        m_ShareMetadata = (maxNodeSize > 1);
+    }
     if (m_Threads == 0)
     {
-        helper::Comm m_NodeComm = m_Comm.GroupByShm("creating per-node comm at BP5 Open(read)");
         unsigned int NodeSize = static_cast<unsigned int>(m_NodeComm.Size());
         unsigned int NodeThreadSize = helper::NumHardwareThreadsPerNode();
         if (NodeThreadSize > 0)
@@ -1289,6 +1968,20 @@ void BP5Reader::InitParameters()
         }
         m_Threads = (unsigned int)m_Parameters.MaxOpenFilesAtOnce;
     }
+
+    m_TraceDataRead = m_JSONProfiler.Intern("DataRead");
+    m_TraceDataReadBytes = m_JSONProfiler.Intern("dataread");
+    m_TraceMetaDataRead = m_JSONProfiler.Intern("MetaDataRead");
+    m_TraceMetaDataReadBytes = m_JSONProfiler.Intern("metadataread");
+    m_TraceMetaMetaDataRead = m_JSONProfiler.Intern("MetaMetaDataRead");
+    m_TraceMetaMetaDataReadBytes = m_JSONProfiler.Intern("metametadataread");
+    m_TraceReadRequest = m_JSONProfiler.Intern("ReadRequest");
+    m_TraceInstallMetadata = m_JSONProfiler.Intern("InstallMetadata");
+    m_TraceRemoteGet = m_JSONProfiler.Intern("RemoteGet");
+    if (m_Parameters.ProfileTraceRecords > 0)
+    {
+        m_JSONProfiler.EnableTrace(m_Parameters.ProfileTraceRecords);
+    }
 }
 
 bool BP5Reader::SleepOrQuit(const TimePoint &timeoutInstant, const Seconds &pollSeconds)
@@ -1515,6 +2208,174 @@ void BP5Reader::InstallMetaMetaData(format::BufferSTL buffer)
     m_MetaMetaDataFileAlreadyProcessedSize = Position;
 }
 
+void BP5Reader::ReadMetadataPartitions(char *metadata, const TimePoint &timeoutInstant,
+                                       const Seconds &pollSeconds)
+{
+    struct Piece
+    {
+        uint64_t FileOffset;
+        uint64_t Size;
+        char *Destination;
+    };
+    // what to read from each md.<k> to assemble the steps
+    std::map<size_t, std::vector<Piece>> pieces;
+    for (const auto &entry : m_MetadataIndexTable)
+    {
+        const std::vector<uint64_t> &ptrs = entry.second;
+        char *step = metadata + ptrs[0];
+        if (ptrs.size() <= 5)
+        {
+            // the step is in md.0 as it is
+            pieces[0].push_back({ptrs[4], ptrs[1], step});
+            continue;
+        }
+        const uint64_t WriterCount = m_WriterMap[m_WriterMapIndex[entry.first]].WriterCount;
+        const size_t nPartitions = static_cast<size_t>(ptrs[5]);
+        const uint64_t attributeBytes = ptrs[6];
+        const uint64_t *partition = ptrs.data() + 7;
+        if (ptrs.size() != 7 + 3 * nPartitions || attributeBytes < 8 * WriterCount)
+        {
+            helper::Throw<std::runtime_error>("Engine", "BP5Reader", "ReadMetadataPartitions",
+                                              "invalid metadata partition record in " +
+                                                  m_Name + " for step " +
+                                                  std::to_string(entry.first));
+        }
+
+        // sizes of the metadata blocks of each partition's writers
+        std::vector<uint64_t> sizesBytes(nPartitions);
+        std::vector<uint64_t> blocksBytes(nPartitions);
+        uint64_t allBlocksBytes = 0;
+        for (size_t k = 0; k < nPartitions; ++k)
+        {
+            const uint64_t first = partition[3 * k];
+            const uint64_t next = (k + 1 < nPartitions) ? partition[3 * k + 3] : WriterCount;
+            const uint64_t size = partition[3 * k + 2];
+            sizesBytes[k] = sizeof(uint64_t) * (next - first);
+            const uint64_t others = sizesBytes[k] + (k == 0 ? attributeBytes : 0);
+            if (next < first || next > WriterCount || size < others)
+            {
+                helper::Throw<std::runtime_error>("Engine", "BP5Reader",
+                                                  "ReadMetadataPartitions",
+                                                  "invalid metadata partition " +
+                                                      std::to_string(k) + " in " + m_Name +
+                                                      " for step " + std::to_string(entry.first));
+            }
+            blocksBytes[k] = size - others;
+            allBlocksBytes += blocksBytes[k];
+        }
+
+        // the total size, the metadata sizes and the attribute sizes of all
+        // writers, their metadata blocks, their attribute blocks
+        const uint64_t total = ptrs[1] - sizeof(uint64_t);
+        std::memcpy(step, &total, sizeof(uint64_t));
+        char *blocks = step + sizeof(uint64_t) * (1 + 2 * WriterCount);
+        for (size_t k = 0; k < nPartitions; ++k)
+        {
+            const uint64_t first = partition[3 * k];
+            const uint64_t pos = partition[3 * k + 1];
+            pieces[k].push_back({pos, sizesBytes[k], step + sizeof(uint64_t) * (1 + first)});
+            pieces[k].push_back({pos + sizesBytes[k], blocksBytes[k], blocks});
+            blocks += blocksBytes[k];
+            if (k == 0)
+            {
+                const uint64_t attributePos = pos + sizesBytes[0] + blocksBytes[0];
+                const uint64_t attributeSizesBytes = sizeof(uint64_t) * WriterCount;
+                pieces[0].push_back({attributePos, attributeSizesBytes,
+                                     step + sizeof(uint64_t) * (1 + WriterCount)});
+                pieces[0].push_back({attributePos + attributeSizesBytes,
+                                     attributeBytes - attributeSizesBytes,
+                                     step + sizeof(uint64_t) * (1 + 2 * WriterCount) +
+                                         allBlocksBytes});
+            }
+        }
+    }
+
+    std::vector<std::pair<const size_t, std::vector<Piece>> *> files;
+    for (auto &p : pieces)
+    {
+        files.push_back(&p);
+    }
+    std::mutex mutexNextFile;
+    size_t nextFile = 0;
+
+    // each file is read by one thread, the pieces do not overlap in memory
+    auto lf_ReadFiles = [&]() -> bool {
+        while (true)
+        {
+            size_t f;
+            {
+                std::lock_guard<std::mutex> lockGuard(mutexNextFile);
+                if (nextFile >= files.size())
+                {
+                    break;
+                }
+                f = nextFile++;
+            }
+            const size_t partition = files[f]->first;
+            const std::vector<Piece> &filePieces = files[f]->second;
+            std::unique_ptr<PoolableFile> acquired;
+            PoolableFile *file = m_MDFile.get();
+            if (partition > 0)
+            {
+                acquired =
+                    m_DataFiles->Acquire(GetBPMetadataFileName(m_Name, partition), m_dataIsRemote);
+                file = acquired.get();
+            }
+
+            uint64_t expectedMinFileSize = 0;
+            for (const auto &piece : filePieces)
+            {
+                expectedMinFileSize =
+                    std::max(expectedMinFileSize, piece.FileOffset + piece.Size);
+            }
+            size_t actualFileSize = 0;
+            do
+            {
+                actualFileSize = file->GetSize();
+                if (actualFileSize >= expectedMinFileSize)
+                {
+                    break;
+                }
+            } while (SleepOrQuit(timeoutInstant, pollSeconds));
+            if (actualFileSize < expectedMinFileSize)
+            {
+                helper::Throw<std::ios_base::failure>(
+                    "Engine", "BP5Reader", "ReadMetadataPartitions",
+                    "File " + m_Name + " was found with an index file but md." +
+                        std::to_string(partition) + " has not contained enough data " +
+                        "within the specified timeout. metadata size = " +
+                        std::to_string(actualFileSize) +
+                        " expected size = " + std::to_string(expectedMinFileSize));
+            }
+            for (const auto &piece : filePieces)
+            {
+                if (piece.Size)
+                {
+                    file->Read(piece.Destination, piece.Size, piece.FileOffset);
+                }
+            }
+        }
+        return true;
+    };
+
+    const size_t nThreads =
+        std::min(files.size(), static_cast<size_t>(std::max(m_Parameters.MetadataThreads, 1U)));
+    if (nThreads <= 1)
+    {
+        lf_ReadFiles();
+        return;
+    }
+    std::vector<std::future<bool>> futures(nThreads);
+    for (size_t tid = 0; tid < nThreads; ++tid)
+    {
+        futures[tid] = std::async(std::launch::async, lf_ReadFiles);
+    }
+    for (auto &f : futures)
+    {
+        f.get();
+    }
+}
+
 void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pollSeconds,
                              const Seconds &timeoutSeconds)
 {
@@ -1598,6 +2459,8 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                 m_WriterIsRowMajor, m_ReaderIsRowMajor, (m_OpenMode != Mode::Read),
                 (m_FlattenSteps), m_Minifooter.IsLittleEndian);
             m_BP5Deserializer->m_Engine = this;
+            m_BP5Deserializer->m_DecompressThreads = m_Parameters.DecompressThreads;
+            m_BP5Deserializer->m_PrefixCacheSize = m_Parameters.PrefixCacheSize;
         }
     }
     if (m_StepsCount > stepsBefore)
@@ -1613,51 +2476,67 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                 fileFilteredSize += p.second;
             }
 
-            /* Read metadata file into memory but first make sure
-             * it has the content that the index table refers to */
-            auto p = m_FilteredMetadataInfo.back();
-            uint64_t expectedMinFileSize = p.first + p.second;
-            size_t actualFileSize = 0;
-            do
-            {
-                actualFileSize = m_MDFile->GetSize();
-                if (actualFileSize >= expectedMinFileSize)
-                {
-                    break;
-                }
-            } while (SleepOrQuit(timeoutInstant, pollSeconds));
-
-            if (actualFileSize >= expectedMinFileSize)
+            if (std::any_of(m_MetadataIndexTable.begin(), m_MetadataIndexTable.end(),
+                            [](const std::pair<const uint64_t, std::vector<uint64_t>> &e) {
+                                return e.second.size() > 5;
+                            }))
             {
-                m_JSONProfiler.Start("MetaDataRead");
+                /* The writer used NumMetadataFiles, assemble the steps */
+                m_JSONProfiler.Start(m_TraceMetaDataRead);
                 m_Metadata.Resize(fileFilteredSize, "allocating metadata buffer, "
                                                     "in call to BP5Reader Open");
-                size_t mempos = 0;
-                for (auto p : m_FilteredMetadataInfo)
-                {
-                    m_JSONProfiler.AddBytes("metadataread", p.second);
-                    m_MDFile->Read(m_Metadata.Data() + mempos, p.second, p.first);
-                    mempos += p.second;
-                }
-                m_MDFileAlreadyReadSize = expectedMinFileSize;
-                m_JSONProfiler.Stop("MetaDataRead");
+                m_JSONProfiler.AddBytes(m_TraceMetaDataReadBytes, fileFilteredSize);
+                ReadMetadataPartitions(m_Metadata.Data(), timeoutInstant, pollSeconds);
+                m_JSONProfiler.Stop(m_TraceMetaDataRead);
             }
             else
             {
-                helper::Throw<std::ios_base::failure>(
-                    "Engine", "BP5Reader", "UpdateBuffer",
-                    "File " + m_Name +
-                        " was found with an index file but md.0 "
-                        "has not contained enough data within "
-                        "the specified timeout of " +
-                        std::to_string(timeoutSeconds.count()) +
-                        " seconds. index size = " + std::to_string(newIdxSize) +
-                        " metadata size = " + std::to_string(actualFileSize) +
-                        " expected size = " + std::to_string(expectedMinFileSize) +
-                        ". One reason could be if the reader finds old "
-                        "data "
-                        "while "
-                        "the writer is creating the new files.");
+                /* Read metadata file into memory but first make sure
+                 * it has the content that the index table refers to */
+                auto p = m_FilteredMetadataInfo.back();
+                uint64_t expectedMinFileSize = p.first + p.second;
+                size_t actualFileSize = 0;
+                do
+                {
+                    actualFileSize = m_MDFile->GetSize();
+                    if (actualFileSize >= expectedMinFileSize)
+                    {
+                        break;
+                    }
+                } while (SleepOrQuit(timeoutInstant, pollSeconds));
+
+                if (actualFileSize >= expectedMinFileSize)
+                {
+                    m_JSONProfiler.Start(m_TraceMetaDataRead);
+                    m_Metadata.Resize(fileFilteredSize, "allocating metadata buffer, "
+                                                        "in call to BP5Reader Open");
+                    size_t mempos = 0;
+                    for (auto p : m_FilteredMetadataInfo)
+                    {
+                        m_JSONProfiler.AddBytes(m_TraceMetaDataReadBytes, p.second);
+                        m_MDFile->Read(m_Metadata.Data() + mempos, p.second, p.first);
+                        mempos += p.second;
+                    }
+                    m_MDFileAlreadyReadSize = expectedMinFileSize;
+                    m_JSONProfiler.Stop(m_TraceMetaDataRead);
+                }
+                else
+                {
+                    helper::Throw<std::ios_base::failure>(
+                        "Engine", "BP5Reader", "UpdateBuffer",
+                        "File " + m_Name +
+                            " was found with an index file but md.0 "
+                            "has not contained enough data within "
+                            "the specified timeout of " +
+                            std::to_string(timeoutSeconds.count()) +
+                            " seconds. index size = " + std::to_string(newIdxSize) +
+                            " metadata size = " + std::to_string(actualFileSize) +
+                            " expected size = " + std::to_string(expectedMinFileSize) +
+                            ". One reason could be if the reader finds old "
+                            "data "
+                            "while "
+                            "the writer is creating the new files.");
+                }
             }
 
             /* Read new meta-meta-data into memory and append to existing one in
@@ -1670,8 +2549,8 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                 {
                     const size_t newMMDSize =
                         metametadataFileSize - m_MetaMetaDataFileAlreadyReadSize;
-                    m_JSONProfiler.Start("MetaMetaDataRead");
-                    m_JSONProfiler.AddBytes("metametadataread", newMMDSize);
+                    m_JSONProfiler.Start(m_TraceMetaMetaDataRead);
+                    m_JSONProfiler.AddBytes(m_TraceMetaMetaDataReadBytes, newMMDSize);
                     m_MetaMetadata.Resize(metametadataFileSize,
                                           "(re)allocating meta-meta-data buffer, "
                                           "in call to BP5Reader Open");
@@ -1679,7 +2558,7 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                                                  m_MetaMetaDataFileAlreadyReadSize,
                                              newMMDSize, m_MetaMetaDataFileAlreadyReadSize);
                     m_MetaMetaDataFileAlreadyReadSize += newMMDSize;
-                    m_JSONProfiler.Stop("MetaMetaDataRead");
+                    m_JSONProfiler.Stop(m_TraceMetaMetaDataRead);
                 }
             }
         }
@@ -1689,14 +2568,21 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
 
         InstallMetaMetaData(m_MetaMetadata);
 
-        size_t inputSize = m_Comm.BroadcastValue(m_Metadata.Size(), 0);
-
-        if (m_Comm.Rank() != 0)
+        if (m_ShareMetadata)
         {
-            m_Metadata.Resize(inputSize, "metadata broadcast");
+            ShareMetadataOnNode();
         }
+        else
+        {
+            size_t inputSize = m_Comm.BroadcastValue(m_Metadata.Size(), 0);
 
-        m_Comm.Bcast(m_Metadata.Data(), inputSize, 0);
+            if (m_Comm.Rank() != 0)
+            {
+                m_Metadata.Resize(inputSize, "metadata broadcast");
+            }
+
+            m_Comm.Bcast(m_Metadata.Data(), inputSize, 0);
+        }
 
         if ((m_OpenMode == Mode::ReadRandomAccess) || m_FlattenSteps)
         {
@@ -1713,6 +2599,17 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
                     InstallMetadataForTimestep(Step);
                 }
             }
+            // every step is in private records now, the window would only
+            // add a copy per node
+            FreeSharedMetadata();
+        }
+        if (m_Parameters.verbose > 0)
+        {
+            std::cout << "BP5Reader::UpdateBuffer: rank " << m_Comm.Rank() << " holds "
+                      << m_Metadata.Size() << " bytes of metadata and "
+                      << m_BP5Deserializer->PrivateMetadataSize()
+                      << " bytes of private records, its node shares "
+                      << (m_SharedMetadata ? m_SharedMetadataSize : 0) << " bytes" << std::endl;
         }
     }
 
@@ -1748,6 +2645,68 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pol
     }
 }
 
+char *BP5Reader::MetadataData()
+{
+    return m_SharedMetadata ? m_SharedMetadata : m_Metadata.Data();
+}
+
+size_t BP5Reader::MetadataSize() const
+{
+    return m_ShareMetadata ? m_SharedMetadataSize : m_Metadata.Size();
+}
+
+void BP5Reader::ShareMetadataOnNode()
+{
+    const bool leader = (m_NodeComm.Rank() == 0);
+    size_t inputSize = 0;
+    if (leader)
+    {
+        // only the first rank of each node gets the metadata from rank 0
+        inputSize = m_NodeLeaderComm.BroadcastValue(m_Metadata.Size(), 0);
+        if (m_Comm.Rank() != 0)
+        {
+            m_Metadata.Resize(inputSize, "metadata broadcast to node leaders");
+        }
+        m_NodeLeaderComm.Bcast(m_Metadata.Data(), inputSize, 0);
+    }
+
+    // the metadata read before is replaced, as m_Metadata would be
+    FreeSharedMetadata();
+    char *ptr = nullptr;
+    if (leader)
+    {
+        m_SharedMetadataWin = m_NodeComm.Win_allocate_shared(inputSize, 1, &ptr,
+                                                             "allocating node shared metadata");
+    }
+    else
+    {
+        m_SharedMetadataWin =
+            m_NodeComm.Win_allocate_shared(0, 1, &ptr, "allocating node shared metadata");
+        int disp_unit;
+        m_NodeComm.Win_shared_query(m_SharedMetadataWin, 0, &inputSize, &disp_unit, &ptr,
+                                    "finding node shared metadata");
+    }
+    m_SharedMetadataWinAllocated = true;
+    if (leader && inputSize > 0)
+    {
+        std::memcpy(ptr, m_Metadata.Data(), inputSize);
+    }
+    m_Metadata.Delete();
+    m_NodeComm.Barrier("node shared metadata is ready");
+    m_SharedMetadata = (inputSize > 0 ? ptr : nullptr);
+    m_SharedMetadataSize = inputSize;
+}
+
+void BP5Reader::FreeSharedMetadata()
+{
+    if (m_SharedMetadataWinAllocated)
+    {
+        m_NodeComm.Win_free(m_SharedMetadataWin, "freeing node shared metadata");
+        m_SharedMetadataWinAllocated = false;
+    }
+    m_SharedMetadata = nullptr;
+}
+
 size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t absoluteStartPos,
                                      const bool hasHeader)
 {
@@ -1809,6 +2768,18 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
             helper::ReadValue<uint8_t>(buffer, position, m_Minifooter.IsLittleEndian);
         m_FlattenSteps = (flatten_val != 0);
 
+        position = m_MetadataDeltaPosition;
+        m_MetadataDelta =
+            helper::ReadValue<uint8_t>(buffer, position, m_Minifooter.IsLittleEndian) != 0;
+        if (m_MetadataDelta && !m_Parameters.SelectSteps.empty())
+        {
+            // a delta needs the metadata of the step before it
+            helper::Throw<std::invalid_argument>(
+                "Engine", "BP5Reader", "ParseMetadataIndex",
+                "SelectSteps cannot be used on " + m_Name +
+                    ", its metadata was written with MetadataDeltaKeyframe");
+        }
+
         if (m_Parameters.IgnoreFlattenSteps)
             m_FlattenSteps = false;
 
@@ -1832,6 +2803,8 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
     uint64_t minfo_size = 0;
     int n = 0;    // a loop counter for current run4
     int nrec = 0; // number of records in current run
+    // MetadataPartition record of the next step
+    std::vector<uint64_t> partitions;
 
     while (position < buffer.size() && metadataSizeToRead < maxMetadataSizeInMemory)
     {
@@ -1854,6 +2827,24 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
             position = savedPosition;
             break;
         }
+        if (recordID == IndexRecord::MetadataPartitionRecord)
+        {
+            /* Parse it only together with its step record */
+            size_t next = position + recordLength;
+            bool complete = (next + recordHeaderSize <= buffer.size());
+            if (complete)
+            {
+                next += sizeof(unsigned char);
+                const uint64_t nextLength =
+                    helper::ReadValue<uint64_t>(buffer, next, m_Minifooter.IsLittleEndian);
+                complete = (next + nextLength <= buffer.size());
+            }
+            if (!complete)
+            {
+                position = savedPosition;
+                break;
+            }
+        }
 
         const size_t dbgRecordStartPosition = position;
 
@@ -1880,6 +2871,16 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
             m_LastWriterCount = s.WriterCount;
             break;
         }
+        case IndexRecord::MetadataPartitionRecord: {
+            // partition count, attribute bytes, then first rank, position
+            // and size in md.<k> of each partition
+            partitions.resize(recordLength / sizeof(uint64_t));
+            for (auto &v : partitions)
+            {
+                v = helper::ReadValue<uint64_t>(buffer, position, m_Minifooter.IsLittleEndian);
+            }
+            break;
+        }
         case IndexRecord::StepRecord: {
             std::vector<uint64_t> ptrs;
             const uint64_t MetadataPos =
@@ -1906,6 +2907,8 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
                 ptrs.push_back(position);
                 // absolute pos in file before read
                 ptrs.push_back(MetadataPos);
+                // the step is assembled from the md.<k> files
+                ptrs.insert(ptrs.end(), partitions.begin(), partitions.end());
                 m_MetadataIndexTable[m_StepsCount] = ptrs;
 #ifdef DUMPDATALOCINFO
                 for (uint64_t i = 0; i < m_WriterCount; i++)
@@ -1942,6 +2945,7 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL, const size_t
 
             // skip over the writer -> data file offset records
             position += sizeof(uint64_t) * m_LastWriterCount * ((2 * FlushCount) + 1);
+            partitions.clear();
             ++m_AbsStepsInFile;
             ++n;
             break;
@@ -2127,6 +3131,7 @@ void BP5Reader::DoClose(const int transportIndex)
         m_MDIndexFile->Close();
     if (m_MetaMetadataFile)
         m_MetaMetadataFile->Close();
+    FreeSharedMetadata();
 }
 
 #if defined(_WIN32)
@@ -2168,15 +3173,35 @@ void BP5Reader::FlushProfiler()
 
     const std::vector<char> profilingJSON(m_JSONProfiler.AggregateProfilingJSON(LineJSON));
 
+    std::string bpBaseName = adios2sys::SystemTools::GetFilenameName(m_Name);
+    auto PID = getpid();
+    // all ranks name their trace after the PID of rank 0
+    const uint64_t PID0 = m_Comm.BroadcastValue(static_cast<uint64_t>(PID));
+    std::stringstream PIDstr;
+    PIDstr << std::hex << PID0;
+
+    if (m_JSONProfiler.IsTraceEnabled())
+    {
+        const std::vector<char> trace(m_JSONProfiler.GetRankTrace());
+        const std::string traceFileName = "/tmp/" + bpBaseName + "_" + PIDstr.str() +
+                                          "_profiling." + std::to_string(m_RankMPI) + ".trace";
+        transport::FileFStream traceStream(m_Comm);
+        try
+        {
+            (void)remove(traceFileName.c_str());
+            traceStream.Open(traceFileName, Mode::Write);
+            traceStream.Write(trace.data(), trace.size());
+            traceStream.Close();
+        }
+        catch (...)
+        { // do nothing
+        }
+    }
+
     if (m_RankMPI == 0)
     {
         std::string profileFileName;
         transport::FileFStream profilingJSONStream(m_Comm);
-        std::string bpBaseName = adios2sys::SystemTools::GetFilenameName(m_Name);
-
-        auto PID = getpid();
-        std::stringstream PIDstr;
-        PIDstr << std::hex << PID;
         // write profile json in /tmp
         profileFileName = "/tmp/" + bpBaseName + "_" + PIDstr.str() + "_profiling.json";
 
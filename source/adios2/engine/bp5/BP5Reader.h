@@ -61,6 +61,11 @@ public:
 
     void PerformGets() final;
 
+    /** Two-phase read: the ranks share their read requests, data wanted by
+     * more than one rank is read in chunks, each by one rank, and sent to
+     * the others. Data only one rank wants is read by that rank. */
+    void PerformCollectiveGets() final;
+
     MinVarInfo *MinBlocksInfo(const VariableBase &, const size_t Step) const;
     MinVarInfo *MinBlocksInfo(const VariableBase &, const size_t Step, const size_t WriterID,
                               const size_t BlockID) const;
@@ -112,6 +117,16 @@ private:
 
     bool m_WriterIsActive = true;
     adios2::profiling::JSONProfiler m_JSONProfiler;
+    /** interned profiler/trace events of the per-step read paths */
+    profiling::TraceEventID m_TraceDataRead = 0;
+    profiling::TraceEventID m_TraceDataReadBytes = 0;
+    profiling::TraceEventID m_TraceMetaDataRead = 0;
+    profiling::TraceEventID m_TraceMetaDataReadBytes = 0;
+    profiling::TraceEventID m_TraceMetaMetaDataRead = 0;
+    profiling::TraceEventID m_TraceMetaMetaDataReadBytes = 0;
+    profiling::TraceEventID m_TraceReadRequest = 0;
+    profiling::TraceEventID m_TraceInstallMetadata = 0;
+    profiling::TraceEventID m_TraceRemoteGet = 0;
 
     /* KVCache for remote data */
     kvcache::KVCacheCommon m_KVCache;
@@ -173,6 +188,12 @@ private:
     void UpdateBuffer(const TimePoint &timeoutInstant, const Seconds &pollSeconds,
                       const Seconds &timeoutSeconds);
 
+    /** Reads the steps of m_MetadataIndexTable into metadata, assembling
+     * those written with NumMetadataFiles from the md.<k> files, with up to
+     * MetadataThreads threads reading different files */
+    void ReadMetadataPartitions(char *metadata, const TimePoint &timeoutInstant,
+                                const Seconds &pollSeconds);
+
     bool ReadActiveFlag(std::vector<char> &buffer);
 
     /* Parse metadata.
@@ -253,11 +274,33 @@ private:
     bool m_ReaderIsRowMajor = true;
     bool m_WriterIsRowMajor = true;
     bool m_FlattenSteps = false; // set to true of writer requested all steps be flattened into 1
+    bool m_MetadataDelta = false; // writer tagged its metadata blocks as keyframes and deltas
 
     format::BufferSTL m_MetadataIndex;
     format::BufferSTL m_MetaMetadata;
     format::BufferMalloc m_Metadata;
 
+    /* NodeSharedMetadata: the metadata of UpdateBuffer goes from rank 0 to
+     * one rank per node, which puts it in a window shared read only with the
+     * other ranks of the node, instead of into m_Metadata */
+    bool m_ShareMetadata = false;
+    helper::Comm m_NodeLeaderComm;
+    helper::Comm::Win m_SharedMetadataWin;
+    bool m_SharedMetadataWinAllocated = false;
+    char *m_SharedMetadata = nullptr;
+    /** size of the metadata last shared, kept after random access frees the
+     * window */
+    size_t m_SharedMetadataSize = 0;
+
+    /** the metadata read so far, wherever it is kept */
+    char *MetadataData();
+    size_t MetadataSize() const;
+
+    /** distributes the metadata rank 0 has in m_Metadata into the shared
+     * window of each node, collective */
+    void ShareMetadataOnNode();
+    void FreeSharedMetadata();
+
     void InstallMetaMetaData(format::BufferSTL MetaMetadata);
     void InstallMetadataForTimestep(size_t Step);
     void ParallelInstallMetadataForTimestep(size_t Step);
@@ -279,6 +322,43 @@ private:
 
     void PerformLocalGets();
 
+    /** Requests read with a single read of bytes [FileStart, FileEnd) of a
+     * subfile, ReadRequests[First, First + Count) */
+    struct ReadGroup
+    {
+        size_t First;
+        size_t Count;
+        size_t Subfile;
+        size_t FileStart;
+        size_t FileEnd;
+    };
+
+    /** a group is never larger than this */
+    static constexpr size_t CoalescedReadMaxSize = 4 * 1024 * 1024;
+
+    /** Orders the requests by subfile and position in it, and groups the
+     * ones that touch or are at most ReadCoalesceGap bytes apart, no matter
+     * which step or writer they are from. FilePositions gets the position of
+     * each request. With deferDecompression, blocks that are decompressed on
+     * the thread pool stay alone */
+    std::vector<ReadGroup>
+    CoalesceReads(std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests,
+                  std::vector<size_t> &FilePositions, const bool deferDecompression);
+
+    /** Position in its subfile of byte StartOffset of the data of WriterRank
+     * in Timestep */
+    size_t DataFilePosition(const size_t WriterRank, const size_t Timestep,
+                            const size_t StartOffset) const;
+
+    /** Index of the flush of WriterRank's data in Timestep that holds byte
+     * Offset, counted as in ReadData */
+    size_t DataFlushOf(const size_t WriterRank, const size_t Timestep,
+                       const size_t Offset) const;
+
+    /** On the first read, checks if the writer is still active and if it
+     * is not, makes reads past the end of file fail */
+    void CheckWriterActiveOnce();
+
     void PerformRemoteGets();
 
     void PerformRemoteGetsWithKVCache();
@@ -286,7 +366,8 @@ private:
     void DestructorClose(bool Verbose) noexcept;
 
     /* Communicator connecting ranks on each Compute Node.
-       Only used to calculate the number of threads available for reading */
+       Used to calculate the number of threads available for reading and to
+       share the metadata on the node */
     helper::Comm m_NodeComm;
     helper::Comm singleComm;
     unsigned int m_Threads;
@@ -135,7 +135,7 @@ helper::RankPartition BP5Writer::GetPartitionInfo(const uint64_t rankDataSize, c
 
 StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
 {
-    profiling::ProfilerGuard bs(m_Profiler, "BS");
+    profiling::ProfilerGuard bs(m_Profiler, m_ProfID.BS);
     if (m_BetweenStepPairs)
     {
         helper::Throw<std::logic_error>("Engine", "BP5Writer", "BeginStep",
@@ -181,7 +181,7 @@ StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
         TimePoint wait_start = Now();
         if (m_WriteFuture.valid())
         {
-            profiling::ProfilerGuard g(m_Profiler, "BS_WaitOnAsync");
+            profiling::ProfilerGuard g(m_Profiler, m_ProfID.BSWaitOnAsync);
 
             m_WriteFuture.get();
             m_Comm.Barrier();
@@ -225,7 +225,7 @@ size_t BP5Writer::CurrentStep() const { return m_WriterStep; }
 void BP5Writer::PerformPuts()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Writer::PerformPuts");
-    profiling::ProfilerGuard g(m_Profiler, "PP");
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.PP);
 
     m_BP5Serializer.PerformPuts(m_Parameters.AsyncWrite || m_Parameters.DirectIO);
     return;
@@ -234,8 +234,7 @@ void BP5Writer::PerformPuts()
 void BP5Writer::WriteMetaMetadata(
     const std::vector<format::BP5Base::MetaMetaInfoBlock> MetaMetaBlocks)
 {
-    std::string mm_str = "WriteMmD";
-    profiling::ProfilerGuard g(m_Profiler, mm_str);
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMmD);
 
     for (auto &b : MetaMetaBlocks)
     {
@@ -251,7 +250,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks
                                   const std::vector<core::iovec> &AttributeBlocks)
 {
     // this function is called by TwoLevelAggregationMetadata
-    profiling::ProfilerGuard g(m_Profiler, "WriteMD");
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMD);
 
     uint64_t MDataTotalSize = 0;
     uint64_t MetaDataSize = 0;
@@ -276,7 +275,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks
     m_MetadataFile->Write((char *)AttrSizeVector.data(), sizeof(uint64_t) * AttrSizeVector.size());
     MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
     {
-        profiling::ProfilerGuard g(m_Profiler, "WriteMD_Blocks");
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMDBlocks);
         for (auto &b : MetaDataBlocks)
         {
             if (!b.iov_base)
@@ -304,7 +303,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<char> &ContigMetaData,
                                   const std::vector<core::iovec> &AttributeBlocks)
 {
     // this function is called by SelectiveAggregationMetadata
-    profiling::ProfilerGuard g(m_Profiler, "WriteMD");
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMD);
     size_t MDataTotalSize = std::accumulate(SizeVector.begin(), SizeVector.end(), size_t(0));
     uint64_t MetaDataSize = 0;
     std::vector<uint64_t> AttrSizeVector;
@@ -332,7 +331,7 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<char> &ContigMetaData,
     m_MetadataFile->Write((char *)AttrSizeVector.data(), sizeof(uint64_t) * AttrSizeVector.size());
     MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
     {
-        profiling::ProfilerGuard g(m_Profiler, "WriteMD_Blocks");
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMDBlocks);
         m_MetadataFile->Write(ContigMetaData.data(), ContigMetaData.size());
     }
 
@@ -352,6 +351,48 @@ uint64_t BP5Writer::WriteMetadata(const std::vector<char> &ContigMetaData,
     return MetaDataSize;
 }
 
+uint64_t BP5Writer::WriteMetadataPartition(const std::vector<char> &ContigMetaData,
+                                           const std::vector<size_t> &SizeVector,
+                                           const std::vector<core::iovec> &AttributeBlocks)
+{
+    // this function is called by PartitionedAggregationMetadata
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMD);
+    uint64_t MetaDataSize = 0;
+
+    m_MetadataFile->Write((char *)SizeVector.data(), sizeof(uint64_t) * SizeVector.size());
+    MetaDataSize += sizeof(uint64_t) * SizeVector.size();
+    {
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteMDBlocks);
+        m_MetadataFile->Write(ContigMetaData.data(), ContigMetaData.size());
+    }
+    MetaDataSize += ContigMetaData.size();
+
+    if (m_Comm.Rank() == 0)
+    {
+        // the attributes of all writers go with partition 0
+        std::vector<uint64_t> AttrSizeVector(m_Comm.Size(), 0);
+        for (size_t a = 0; a < AttributeBlocks.size() && a < AttrSizeVector.size(); a++)
+        {
+            AttrSizeVector[a] = AttributeBlocks[a].iov_len;
+        }
+        m_MetadataFile->Write((char *)AttrSizeVector.data(),
+                              sizeof(uint64_t) * AttrSizeVector.size());
+        MetaDataSize += sizeof(uint64_t) * AttrSizeVector.size();
+        for (auto &b : AttributeBlocks)
+        {
+            if (!b.iov_base)
+                continue;
+            m_MetadataFile->Write((char *)b.iov_base, b.iov_len);
+            MetaDataSize += b.iov_len;
+        }
+    }
+
+    m_MetadataFile->Flush();
+
+    m_MetaDataPos += MetaDataSize;
+    return MetaDataSize;
+}
+
 void BP5Writer::AsyncWriteDataCleanup()
 {
     if (m_Parameters.AsyncWrite)
@@ -374,8 +415,7 @@ void BP5Writer::AsyncWriteDataCleanup()
 
 void BP5Writer::WriteData(format::BufferV *Data)
 {
-    std::string wd_str = "WriteData";
-    profiling::ProfilerGuard g(m_Profiler, wd_str);
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.WriteData);
 
     if (m_Parameters.verbose > 1)
     {
@@ -554,6 +594,11 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos, uint64_t MetaDataSi
         // WriterMap record
         bufsize += 1 + (4 + m_Comm.Size()) * sizeof(uint64_t);
     }
+    if (!m_MetadataPartitionRecord.empty())
+    {
+        // MetadataPartition record
+        bufsize += 1 + (1 + m_MetadataPartitionRecord.size()) * sizeof(uint64_t);
+    }
 
     std::vector<char> buf(bufsize);
     size_t pos = 0;
@@ -588,6 +633,17 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos, uint64_t MetaDataSi
         m_WriterSubfileMap.clear();
     }
 
+    // MetadataPartition record, it belongs to the Step record after it
+    if (!m_MetadataPartitionRecord.empty())
+    {
+        record = MetadataPartitionRecord;
+        helper::CopyToBuffer(buf, pos, &record, 1); // record type
+        d = m_MetadataPartitionRecord.size() * sizeof(uint64_t);
+        helper::CopyToBuffer(buf, pos, &d, 1); // record length
+        helper::CopyToBuffer(buf, pos, m_MetadataPartitionRecord.data(),
+                             m_MetadataPartitionRecord.size());
+    }
+
     // Step record
     record = StepRecord;
 #ifdef DUMPDATALOCINFO
@@ -795,8 +851,7 @@ void BP5Writer::ComputeDerivedVariables()
 
 void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo)
 {
-    std::string agg_str = "ES_MDAgg";
-    profiling::ProfilerGuard g(m_Profiler, agg_str);
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAgg);
 
     std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
     std::vector<uint64_t> DataSizes;
@@ -812,16 +867,12 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
     MetaEncodeSize.push_back(AlignedMetadataSize);
 
     {
-        std::string aggInfo_str = agg_str + "_AggInfo";
-        m_Profiler.AddTimerWatch(aggInfo_str);
-        profiling::ProfilerGuard aggInfoGuard(m_Profiler, aggInfo_str);
+        profiling::ProfilerGuard aggInfoGuard(m_Profiler, m_ProfID.MDAggInfo);
         BP5Helper::BP5AggregateInformation(m_Comm, m_Profiler, UniqueMetaMetaBlocks,
                                            AttributeBlocks, MetaEncodeSize, m_WriterDataPos);
     }
 
-    std::string gwm_str = agg_str + "_GatherWriteMeta";
-    m_Profiler.AddTimerWatch(gwm_str);
-    profiling::ProfilerGuard gwmGuard(m_Profiler, gwm_str);
+    profiling::ProfilerGuard gwmGuard(m_Profiler, m_ProfID.MDAggGatherWriteMeta);
 
     if (m_Comm.Rank() == 0)
     {
@@ -849,9 +900,7 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
             C /= 8;
 
         {
-            std::string gmb_str = gwm_str + "_MDBlocks";
-            m_Profiler.AddTimerWatch(gmb_str);
-            profiling::ProfilerGuard g(m_Profiler, gmb_str);
+            profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAggMDBlocks);
 
             if (m_Comm.Size() > m_Parameters.OneLevelGatherRanksLimit)
             {
@@ -898,17 +947,14 @@ void BP5Writer::SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo
 
 void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo)
 {
-    std::string agg_str = "ES_MDAgg";
-    profiling::ProfilerGuard g(m_Profiler, agg_str);
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAgg);
 
     /*
      * Two-step metadata aggregation
      */
     std::vector<char> MetaBuffer;
     {
-        std::string level1_str = agg_str + "_lv1";
-        m_Profiler.AddTimerWatch(level1_str);
-        profiling::ProfilerGuard g(m_Profiler, level1_str);
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAggLv1);
 
         core::iovec m{TSInfo.MetaEncodeBuffer->Data(), TSInfo.MetaEncodeBuffer->m_FixedSize};
         core::iovec a{nullptr, 0};
@@ -919,13 +965,16 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
         MetaBuffer = m_BP5Serializer.CopyMetadataToContiguous(
             TSInfo.NewMetaMetaBlocks, {m}, {a}, {m_ThisTimestepDataSize}, {m_StartDataPos});
 
-        std::string meta1_gather_str =
-            level1_str + "_" + std::to_string(m_AggregatorMetadata.m_Comm.Size());
-        m_Profiler.AddTimerWatch(meta1_gather_str, true);
+        if (m_ProfID.Meta1GatherSize != m_AggregatorMetadata.m_Comm.Size())
+        {
+            m_ProfID.Meta1GatherSize = m_AggregatorMetadata.m_Comm.Size();
+            m_ProfID.Meta1Gather = m_Profiler.AddTimerWatch(
+                "ES_MDAgg_lv1_" + std::to_string(m_ProfID.Meta1GatherSize), true);
+        }
 
         if (m_AggregatorMetadata.m_Comm.Size() > 1)
         { // level 1
-            m_Profiler.Start(meta1_gather_str);
+            m_Profiler.Start(m_ProfID.Meta1Gather);
             size_t LocalSize = MetaBuffer.size();
             std::vector<size_t> RecvCounts = m_AggregatorMetadata.m_Comm.GatherValues(LocalSize, 0);
             std::vector<char> RecvBuffer;
@@ -939,7 +988,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
             m_AggregatorMetadata.m_Comm.GathervArrays(MetaBuffer.data(), LocalSize,
                                                       RecvCounts.data(), RecvCounts.size(),
                                                       RecvBuffer.data(), 0);
-            m_Profiler.Stop(meta1_gather_str);
+            m_Profiler.Stop(m_ProfID.Meta1Gather);
             if (m_AggregatorMetadata.m_Comm.Rank() == 0)
             {
                 std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
@@ -960,9 +1009,7 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
 
     {
         // level 2
-        std::string level2_str = agg_str + "_lv2";
-        m_Profiler.AddTimerWatch(level2_str);
-        profiling::ProfilerGuard g(m_Profiler, level2_str);
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAggLv2);
 
         if (m_AggregatorMetadata.m_Comm.Rank() == 0)
         {
@@ -974,13 +1021,15 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
             std::vector<char> *buf;
             std::vector<size_t> RecvCounts;
             size_t LocalSize = MetaBuffer.size();
-            std::string meta2_gather_str =
-                level2_str + "_" + std::to_string(m_CommMetadataAggregators.Size());
-            m_Profiler.AddTimerWatch(meta2_gather_str, true);
+            if (m_ProfID.Meta2GatherSize != m_CommMetadataAggregators.Size())
+            {
+                m_ProfID.Meta2GatherSize = m_CommMetadataAggregators.Size();
+                m_ProfID.Meta2Gather = m_Profiler.AddTimerWatch(
+                    "ES_MDAgg_lv2_" + std::to_string(m_ProfID.Meta2GatherSize), true);
+            }
             if (m_CommMetadataAggregators.Size() > 1)
             {
-                profiling::ProfilerGuard g(m_Profiler, meta2_gather_str);
-                m_Profiler.Start(meta2_gather_str);
+                profiling::ProfilerGuard g(m_Profiler, m_ProfID.Meta2Gather);
                 RecvCounts = m_CommMetadataAggregators.GatherValues(LocalSize, 0);
                 if (m_CommMetadataAggregators.Rank() == 0)
                 {
@@ -1026,6 +1075,162 @@ void BP5Writer::TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo
     }
 }
 
+void BP5Writer::InitMetadataPartitions()
+{
+    // contiguous ranks, partition k starts at rank ceil(k * nproc / partitions)
+    const size_t nproc = static_cast<size_t>(m_Comm.Size());
+    const size_t rank = static_cast<size_t>(m_Comm.Rank());
+    const size_t partition = rank * m_MetadataPartitions / nproc;
+    m_CommMetadataPartition = m_Comm.Split(static_cast<int>(partition), m_Comm.Rank(),
+                                           "creating metadata partitions");
+    const int color = (m_CommMetadataPartition.Rank() == 0) ? 0 : 1;
+    m_CommMetadataPartitionLeaders =
+        m_Comm.Split(color, m_Comm.Rank(), "creating chain of metadata partition leaders");
+    if (m_CommMetadataPartition.Rank() == 0 && partition > 0)
+    {
+        OpenMetadataPartition(partition);
+    }
+    m_MetadataPartitionsReady = true;
+}
+
+void BP5Writer::OpenMetadataPartition(const size_t partition)
+{
+    if (!m_MetadataFile)
+    {
+        Params transportParameters = m_IO.m_TransportsParameters[0];
+        transportParameters["DirectIO"] = "false";
+        m_MetadataFile = m_TransportFactory.OpenFileTransport(
+            GetBPMetadataFileName(m_Name, partition), m_OpenMode, transportParameters, true,
+            false, m_CommMetadataPartition);
+    }
+    if (m_OpenMode != Mode::Append)
+    {
+        return;
+    }
+    const size_t pos = (partition < m_AppendPartitionPos.size()) ? m_AppendPartitionPos[partition]
+                                                                : MaxSizeT;
+    if (pos < MaxSizeT)
+    {
+        m_MetaDataPos = pos;
+        m_MetadataFile->Truncate(m_MetaDataPos);
+        m_MetadataFile->Seek(m_MetaDataPos);
+    }
+    else
+    {
+        m_MetaDataPos = m_MetadataFile->GetSize();
+        m_MetadataFile->SeekToEnd();
+    }
+}
+
+void BP5Writer::PartitionedAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo)
+{
+    profiling::ProfilerGuard g(m_Profiler, m_ProfID.MDAgg);
+
+    if (!m_MetadataPartitionsReady)
+    {
+        InitMetadataPartitions();
+    }
+
+    std::vector<format::BP5Base::MetaMetaInfoBlock> UniqueMetaMetaBlocks;
+    std::vector<core::iovec> AttributeBlocks;
+    std::vector<size_t> MetaEncodeSize;
+    m_WriterDataPos.resize(0);
+    m_WriterDataPos.push_back(m_StartDataPos);
+    UniqueMetaMetaBlocks = TSInfo.NewMetaMetaBlocks;
+    if (TSInfo.AttributeEncodeBuffer)
+        AttributeBlocks.push_back(
+            {TSInfo.AttributeEncodeBuffer->Data(), TSInfo.AttributeEncodeBuffer->m_FixedSize});
+    size_t AlignedMetadataSize = (TSInfo.MetaEncodeBuffer->m_FixedSize + 7) & ~0x7;
+    MetaEncodeSize.push_back(AlignedMetadataSize);
+
+    {
+        // meta-metadata, attributes and data positions still go to rank 0,
+        // only the metadata blocks are partitioned
+        profiling::ProfilerGuard aggInfoGuard(m_Profiler, m_ProfID.MDAggInfo);
+        BP5Helper::BP5AggregateInformation(m_Comm, m_Profiler, UniqueMetaMetaBlocks,
+                                           AttributeBlocks, MetaEncodeSize, m_WriterDataPos);
+    }
+
+    profiling::ProfilerGuard gwmGuard(m_Profiler, m_ProfID.MDAggGatherWriteMeta);
+
+    if (m_Comm.Rank() == 0)
+    {
+        if (m_Parameters.verbose > 2)
+        {
+            std::cout << "Performing partitioned metadata aggregation to " << m_MetadataPartitions
+                      << " files" << std::endl;
+        }
+        assert(m_WriterDataPos.size() == static_cast<size_t>(m_Comm.Size()));
+        WriteMetaMetadata(UniqueMetaMetaBlocks);
+        for (auto &mm : UniqueMetaMetaBlocks)
+        {
+            free((void *)mm.MetaMetaInfo);
+            free((void *)mm.MetaMetaID);
+        }
+    }
+
+    std::vector<size_t> PartitionSizes = m_CommMetadataPartition.GatherValues(
+        AlignedMetadataSize, 0);
+    if (m_CommMetadataPartition.Rank() != 0)
+    {
+        m_CommMetadataPartition.GathervArrays((uint64_t *)TSInfo.MetaEncodeBuffer->Data(),
+                                              AlignedMetadataSize / 8, nullptr, 0,
+                                              (uint64_t *)nullptr, 0);
+        return;
+    }
+
+    std::vector<char> ContigMetadata(
+        std::accumulate(PartitionSizes.begin(), PartitionSizes.end(), size_t(0)));
+    auto AlignedCounts = PartitionSizes;
+    for (auto &C : AlignedCounts)
+        C /= 8;
+    m_CommMetadataPartition.GathervArrays(
+        (uint64_t *)TSInfo.MetaEncodeBuffer->Data(), AlignedMetadataSize / 8,
+        AlignedCounts.data(), AlignedCounts.size(), (uint64_t *)ContigMetadata.data(), 0);
+
+    uint64_t PartitionInfo[2] = {m_MetaDataPos, 0};
+    PartitionInfo[1] = WriteMetadataPartition(ContigMetadata, PartitionSizes, AttributeBlocks);
+
+    std::vector<uint64_t> AllPartitionInfo;
+    if (m_Comm.Rank() == 0)
+    {
+        for (auto &a : AttributeBlocks)
+            free((void *)a.iov_base);
+        AllPartitionInfo.resize(2 * m_MetadataPartitions);
+    }
+    m_CommMetadataPartitionLeaders.GatherArrays(PartitionInfo, 2, AllPartitionInfo.data(), 0);
+    if (m_Comm.Rank() != 0)
+    {
+        return;
+    }
+
+    // Readers assemble the step as if it was written to md.0: a total size,
+    // then what the partitions hold, so the index keeps its positions in that
+    const size_t nproc = static_cast<size_t>(m_Comm.Size());
+    m_MetadataPartitionRecord.clear();
+    m_MetadataPartitionRecord.push_back(m_MetadataPartitions);
+    // bytes of attribute sizes and blocks at the end of partition 0
+    m_MetadataPartitionRecord.push_back(PartitionInfo[1] -
+                                        PartitionSizes.size() * sizeof(uint64_t) -
+                                        ContigMetadata.size());
+    uint64_t StepSize = sizeof(uint64_t);
+    for (size_t k = 0; k < m_MetadataPartitions; ++k)
+    {
+        m_MetadataPartitionRecord.push_back((k * nproc + m_MetadataPartitions - 1) /
+                                            m_MetadataPartitions);
+        m_MetadataPartitionRecord.push_back(AllPartitionInfo[2 * k]);
+        m_MetadataPartitionRecord.push_back(AllPartitionInfo[2 * k + 1]);
+        StepSize += AllPartitionInfo[2 * k + 1];
+    }
+    m_LatestMetaDataPos = m_LogicalMetaDataPos;
+    m_LatestMetaDataSize = StepSize;
+    m_LogicalMetaDataPos += StepSize;
+    if (!m_Parameters.AsyncWrite)
+    {
+        WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize);
+    }
+}
+
 void BP5Writer::EndStep()
 {
     if (m_Parameters.verbose > 1)
@@ -1035,15 +1240,15 @@ void BP5Writer::EndStep()
 
 #ifdef ADIOS2_HAVE_DERIVED_VARIABLE
     {
-        profiling::ProfilerGuard g(m_Profiler, "ES_DeriveVars");
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.ESDeriveVars);
         ComputeDerivedVariables();
     }
 #endif
     m_BetweenStepPairs = false;
     PERFSTUBS_SCOPED_TIMER("BP5Writer::EndStep");
-    m_Profiler.Start("ES");
+    m_Profiler.Start(m_ProfID.ES);
 
-    m_Profiler.Start("ES_CloseTS");
+    m_Profiler.Start(m_ProfID.ESCloseTS);
     MarshalAttributes();
 
     // true: advances step
@@ -1054,9 +1259,9 @@ void BP5Writer::EndStep()
      * AttributeEncodeBuffer and the data encode Vector */
 
     m_ThisTimestepDataSize += TSInfo.DataBuffer->Size();
-    m_Profiler.Stop("ES_CloseTS");
+    m_Profiler.Stop(m_ProfID.ESCloseTS);
 
-    m_Profiler.Start("ES_WriteData");
+    m_Profiler.Start(m_ProfID.ESWriteData);
     // TSInfo destructor would delete the DataBuffer so we need to save it
     // for async IO and let the writer free it up when not needed anymore
     m_AsyncWriteLock.lock();
@@ -1067,9 +1272,13 @@ void BP5Writer::EndStep()
     WriteData(TSInfo.DataBuffer);
     TSInfo.DataBuffer = NULL;
 
-    m_Profiler.Stop("ES_WriteData");
+    m_Profiler.Stop(m_ProfID.ESWriteData);
 
-    if (m_Parameters.UseSelectiveMetadataAggregation)
+    if (m_MetadataPartitions > 1)
+    {
+        PartitionedAggregationMetadata(TSInfo);
+    }
+    else if (m_Parameters.UseSelectiveMetadataAggregation)
     {
         SelectiveAggregationMetadata(TSInfo);
     }
@@ -1101,15 +1310,11 @@ void BP5Writer::EndStep()
 
     if (m_Parameters.AggregationType == (int)AggregationType::DataSizeBased)
     {
-        std::string dsb_tag_str = "ES_DSB";
-        m_Profiler.AddTimerWatch(dsb_tag_str);
-        profiling::ProfilerGuard g(m_Profiler, dsb_tag_str);
+        profiling::ProfilerGuard g(m_Profiler, m_ProfID.ESDSB);
 
         if (m_Aggregator->m_Comm.Rank() == 0)
         {
-            std::string ag_str = "ES_DSB_AllGather";
-            m_Profiler.AddTimerWatch(ag_str);
-            profiling::ProfilerGuard g(m_Profiler, ag_str);
+            profiling::ProfilerGuard g(m_Profiler, m_ProfID.ESDSBAllGather);
             // Need all aggregator chains rank 0 processes to know the m_DataPos
             // of each substream
             std::vector<uint64_t> subStreamPos = m_CommAggregators.AllGatherValues(m_DataPos);
@@ -1123,12 +1328,10 @@ void BP5Writer::EndStep()
         // Broadcast substream data positions to all ranks, since any
         // of them could become a substream rank 0 on the next time step
 
-        std::string bc_str = "ES_DSB_Broadcast";
-        m_Profiler.AddTimerWatch(bc_str);
-        m_Profiler.Start(bc_str);
+        m_Profiler.Start(m_ProfID.ESDSBBroadcast);
         m_Aggregator->m_Comm.BroadcastVector(m_SubstreamDataPos, 0);
         m_DataPosShared = true;
-        m_Profiler.Stop(bc_str);
+        m_Profiler.Stop(m_ProfID.ESDSBBroadcast);
 
         if (m_Parameters.verbose > 2)
         {
@@ -1141,7 +1344,7 @@ void BP5Writer::EndStep()
         }
     }
 
-    m_Profiler.Stop("ES");
+    m_Profiler.Stop(m_ProfID.ES);
     m_WriterStep++;
     m_AggregatorInitializedThisStep = false;
     m_EndStepEnd = Now();
@@ -1182,6 +1385,11 @@ void BP5Writer::InitParameters()
     ParseParams(m_IO, m_Parameters);
     m_WriteToBB = !(m_Parameters.BurstBufferPath.empty());
     m_DrainBB = m_WriteToBB && m_Parameters.BurstBufferDrain;
+    if (m_DrainBB)
+    {
+        m_FileDrainer.SetThreads(m_Parameters.BurstBufferDrainThreads);
+        m_FileDrainer.SetBandwidthLimit(m_Parameters.BurstBufferDrainBandwidth);
+    }
 
     unsigned int nproc = (unsigned int)m_Comm.Size();
     m_Parameters.NumAggregators = helper::SetWithinLimit(m_Parameters.NumAggregators, 0U, nproc);
@@ -1202,6 +1410,7 @@ void BP5Writer::InitParameters()
     }
     m_Parameters.NumSubFiles =
         helper::SetWithinLimit(m_Parameters.NumSubFiles, 0U, m_Parameters.NumAggregators);
+    m_MetadataPartitions = helper::SetWithinLimit(m_Parameters.NumMetadataFiles, 1U, nproc);
 
     // Limiting to max 64MB page size
     m_Parameters.StripeSize = helper::SetWithinLimit(m_Parameters.StripeSize, 0U, 67108864U);
@@ -1231,6 +1440,52 @@ void BP5Writer::InitParameters()
     }
 
     m_BP5Serializer.m_StatsLevel = m_Parameters.StatsLevel;
+    m_BP5Serializer.m_StatsThreads = m_Parameters.StatsThreads;
+    m_BP5Serializer.m_MetadataDeltaKeyframe = m_Parameters.MetadataDeltaKeyframe;
+
+    m_Parameters.LevelsOfDetail = helper::SetWithinLimit(m_Parameters.LevelsOfDetail, 0U, 32U);
+    const std::string lodMethod = helper::LowerCase(m_Parameters.LevelOfDetailMethod);
+    if (lodMethod == "average")
+    {
+        m_LevelOfDetailAverage = true;
+    }
+    else if (lodMethod == "stride")
+    {
+        m_LevelOfDetailAverage = false;
+    }
+    else
+    {
+        helper::Throw<std::invalid_argument>("Engine", "BP5Writer", "InitParameters",
+                                             "LevelOfDetailMethod must be average or stride, "
+                                             "found " +
+                                                 m_Parameters.LevelOfDetailMethod);
+    }
+
+    m_TraceAsyncWrite = m_Profiler.Intern("AsyncWrite");
+    m_ProfID.BS = m_Profiler.AddTimerWatch("BS");
+    m_ProfID.BSWaitOnAsync = m_Profiler.AddTimerWatch("BS_WaitOnAsync");
+    m_ProfID.PP = m_Profiler.AddTimerWatch("PP");
+    m_ProfID.WriteData = m_Profiler.AddTimerWatch("WriteData");
+    m_ProfID.WriteMD = m_Profiler.AddTimerWatch("WriteMD");
+    m_ProfID.WriteMDBlocks = m_Profiler.AddTimerWatch("WriteMD_Blocks");
+    m_ProfID.WriteMmD = m_Profiler.AddTimerWatch("WriteMmD");
+    m_ProfID.ES = m_Profiler.AddTimerWatch("ES");
+    m_ProfID.ESDeriveVars = m_Profiler.AddTimerWatch("ES_DeriveVars");
+    m_ProfID.ESCloseTS = m_Profiler.AddTimerWatch("ES_CloseTS");
+    m_ProfID.ESWriteData = m_Profiler.AddTimerWatch("ES_WriteData");
+    m_ProfID.ESDSB = m_Profiler.AddTimerWatch("ES_DSB");
+    m_ProfID.ESDSBAllGather = m_Profiler.AddTimerWatch("ES_DSB_AllGather");
+    m_ProfID.ESDSBBroadcast = m_Profiler.AddTimerWatch("ES_DSB_Broadcast");
+    m_ProfID.MDAgg = m_Profiler.AddTimerWatch("ES_MDAgg");
+    m_ProfID.MDAggInfo = m_Profiler.AddTimerWatch("ES_MDAgg_AggInfo");
+    m_ProfID.MDAggGatherWriteMeta = m_Profiler.AddTimerWatch("ES_MDAgg_GatherWriteMeta");
+    m_ProfID.MDAggMDBlocks = m_Profiler.AddTimerWatch("ES_MDAgg_GatherWriteMeta_MDBlocks");
+    m_ProfID.MDAggLv1 = m_Profiler.AddTimerWatch("ES_MDAgg_lv1");
+    m_ProfID.MDAggLv2 = m_Profiler.AddTimerWatch("ES_MDAgg_lv2");
+    if (m_Parameters.ProfileTraceRecords > 0)
+    {
+        m_Profiler.EnableTrace(m_Parameters.ProfileTraceRecords);
+    }
 }
 
 uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
@@ -1243,6 +1498,7 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
         m_AppendMetadataPos = 0;
         m_AppendMetaMetadataPos = 0;
         m_AppendMetadataIndexPos = 0;
+        m_AppendPartitionPos.assign(m_Comm.Size(), 0);
         m_AppendDataPos.resize(m_Aggregator->m_NumAggregators,
                                0ULL); // safe bet
         return 0;
@@ -1325,8 +1581,19 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
             position += m_AppendWriterCount * sizeof(uint64_t);
             break;
         }
+        case IndexRecord::MetadataPartitionRecord: {
+            m_AppendMetadataPartitions =
+                helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
+            // jump over attribute bytes and the partitions
+            position += (1 + 3 * m_AppendMetadataPartitions) * sizeof(uint64_t);
+            break;
+        }
         case IndexRecord::StepRecord: {
-            position += 2 * sizeof(uint64_t); // MetadataPos, MetadataSize
+            const uint64_t MetadataPos =
+                helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
+            const uint64_t MetadataSize =
+                helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
+            m_AppendMetadataEnd = MetadataPos + MetadataSize;
             const uint64_t FlushCount =
                 helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
             // jump over the metadata positions
@@ -1366,6 +1633,7 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
         m_AppendMetadataPos = 0;
         m_AppendMetaMetadataPos = 0;
         m_AppendMetadataIndexPos = 0;
+        m_AppendPartitionPos.assign(m_Comm.Size(), 0);
         return 0;
     }
 
@@ -1385,6 +1653,7 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
     position = m_IndexHeaderSize;
     unsigned int currentStep = 0;
     std::vector<uint64_t> writerToFileMap;
+    std::vector<size_t> partitionPos;
     // reading one step beyond target to get correct offsets
     while (currentStep <= targetStep && position < buffer.size())
     {
@@ -1412,6 +1681,21 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
             }
             break;
         }
+        case IndexRecord::MetadataPartitionRecord: {
+            const uint64_t partitions =
+                helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
+            position += sizeof(uint64_t); // attribute bytes
+            // where each md.<k> has this step
+            partitionPos.assign(partitions, MaxSizeT);
+            for (uint64_t k = 0; k < partitions; k++)
+            {
+                position += sizeof(uint64_t); // first rank
+                partitionPos[k] = static_cast<size_t>(
+                    helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian));
+                position += sizeof(uint64_t); // size
+            }
+            break;
+        }
         case IndexRecord::StepRecord: {
             m_AppendMetadataIndexPos =
                 position - sizeof(unsigned char) - sizeof(uint64_t); // pos of RecordID
@@ -1425,6 +1709,7 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
 
             if (currentStep == targetStep)
             {
+                m_AppendPartitionPos = partitionPos;
                 // we need the very first (smallest) write position to each
                 // subfile Offsets and sizes,  2*FlushCount + 1 per writer
                 for (uint64_t i = 0; i < m_AppendWriterCount; i++)
@@ -1898,6 +2183,9 @@ void BP5Writer::MakeHeader(std::vector<char> &buffer, size_t &position, const st
     helper::CopyToBuffer(buffer, position, &columnMajor);
 
     helper::CopyToBuffer(buffer, position, &m_Parameters.FlattenSteps);
+
+    const uint8_t metadataDelta = (m_BP5Serializer.m_MetadataDeltaKeyframe > 0) ? 1 : 0;
+    helper::CopyToBuffer(buffer, position, &metadataDelta);
     // remainder  unused
     position = m_IndexHeaderSize;
     // absolutePosition = position;
@@ -1940,6 +2228,34 @@ void BP5Writer::InitBPBuffer()
         m_Comm.BroadcastVector(preMetadataIndex.m_Buffer);
         m_WriterStep = CountStepsInMetadataIndex(preMetadataIndex);
 
+        // appended metadata blocks are tagged if and only if the existing ones are
+        if (m_WriterStep > 0 && preMetadataIndex.m_Buffer.size() >= m_IndexHeaderSize)
+        {
+            const bool metadataDelta = preMetadataIndex.m_Buffer[m_MetadataDeltaPosition] != 0;
+            if (!metadataDelta)
+            {
+                m_BP5Serializer.m_MetadataDeltaKeyframe = 0;
+            }
+            else if (!m_BP5Serializer.m_MetadataDeltaKeyframe)
+            {
+                m_BP5Serializer.m_MetadataDeltaKeyframe = 1;
+            }
+        }
+
+        // and they keep the existing file's layout of md.0 or md.<k> files
+        if (m_WriterStep > 0)
+        {
+            if (!m_AppendMetadataPartitions)
+            {
+                m_MetadataPartitions = 1;
+            }
+            else if (m_MetadataPartitions == 1)
+            {
+                m_MetadataPartitions =
+                    std::min(m_AppendMetadataPartitions, static_cast<size_t>(m_Comm.Size()));
+            }
+        }
+
         // truncate and seek
         if (m_Aggregator->m_IsAggregator)
         {
@@ -1962,7 +2278,14 @@ void BP5Writer::InitBPBuffer()
         if (m_Comm.Rank() == 0)
         {
             // Truncate existing metadata file
-            if (m_AppendMetadataPos < MaxSizeT)
+            if (m_MetadataPartitions > 1 && m_WriterStep > 0)
+            {
+                // the index has positions in the md.0 readers assemble
+                m_LogicalMetaDataPos =
+                    (m_AppendMetadataPos < MaxSizeT) ? m_AppendMetadataPos : m_AppendMetadataEnd;
+                OpenMetadataPartition(0);
+            }
+            else if (m_AppendMetadataPos < MaxSizeT)
             {
                 m_MetaDataPos = m_AppendMetadataPos;
                 m_MetadataFile->Truncate(m_MetaDataPos);
@@ -2211,6 +2534,11 @@ void BP5Writer::DoClose(const int transportIndex)
             // close metametadata file
             m_MetaMetadataFile->Close();
         }
+        else if (m_MetadataFile)
+        {
+            // first rank of a metadata partition
+            m_MetadataFile->Close();
+        }
 
         if (m_Parameters.AsyncWrite)
         {
@@ -2310,6 +2638,26 @@ void BP5Writer::FlushProfiler()
             profilingJSONStream.Close();
         }
     }
+
+    if (m_Profiler.IsTraceEnabled())
+    {
+        // binary trace of every rank, convert with adios2_trace2json
+        const std::vector<char> trace(m_Profiler.GetRankTrace());
+        const std::string traceFileName =
+            m_Name + (fileTransportIdx > -1 ? "/profiling." : "_profiling.") +
+            std::to_string(m_RankMPI) + ".trace";
+        if (m_DrainBB)
+        {
+            m_FileDrainer.AddOperationWrite(traceFileName, trace.size(), trace.data());
+        }
+        else
+        {
+            transport::FileFStream traceStream(m_Comm);
+            traceStream.Open(traceFileName, Mode::Write);
+            traceStream.Write(trace.data(), trace.size());
+            traceStream.Close();
+        }
+    }
 }
 
 size_t BP5Writer::DebugGetDataBufferSize() const
@@ -2371,6 +2719,8 @@ void BP5Writer::PutCommon(VariableBase &variable, const void *values, bool sync)
         }
     }
 
+    // contiguous copy of the block, for the levels of detail
+    const void *blockData = values;
     if (!variable.m_MemoryCount.empty())
     {
         const bool sourceRowMajor = helper::IsRowMajor(m_IO.m_HostLanguage);
@@ -2399,6 +2749,7 @@ void BP5Writer::PutCommon(VariableBase &variable, const void *values, bool sync)
                        false, (int)ObjSize, helper::CoreDims(), helper::CoreDims(),
                        helper::CoreDims(), helper::CoreDims(), false /* safemode */, memSpace,
                        /* duringWrite */ true);
+        blockData = ptr;
     }
     else
     {
@@ -2415,6 +2766,36 @@ void BP5Writer::PutCommon(VariableBase &variable, const void *values, bool sync)
                                     variable.m_ElementSize, DimCount, Shape, Count, Start, values,
                                     sync, nullptr);
     }
+
+    if (variable.m_ShapeID == ShapeID::GlobalArray && memSpace == MemorySpace::Host)
+    {
+        const size_t levels = LevelsOfDetail(variable);
+        if (levels == 0)
+        {
+        }
+#define declare_type(T, L)                                                                         \
+    else if (variable.m_Type == helper::GetDataType<T>())                                          \
+    {                                                                                              \
+        PutLevelsOfDetail(static_cast<Variable<T> &>(variable), static_cast<const T *>(blockData), \
+                          levels);                                                                 \
+    }
+        ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(declare_type)
+#undef declare_type
+    }
+}
+
+size_t BP5Writer::LevelsOfDetail(const VariableBase &variable) const
+{
+    size_t levels = m_Parameters.LevelsOfDetail;
+    const auto &attributes = m_IO.GetAttributes();
+    auto it = attributes.find(variable.m_Name + "/LevelsOfDetail");
+    if (it != attributes.end())
+    {
+        levels = helper::StringToSizeT(it->second->GetInfo()["Value"],
+                                       "in LevelsOfDetail attribute of " + variable.m_Name);
+        levels = std::min(levels, static_cast<size_t>(32));
+    }
+    return levels;
 }
 
 #define declare_type(T)                                                                            \
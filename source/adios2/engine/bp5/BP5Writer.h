@@ -18,7 +18,7 @@
 #include "adios2/helper/adiosPartitioner.h" // RankPartition
 #include "adios2/toolkit/aggregator/mpi/MPIChain.h"
 #include "adios2/toolkit/aggregator/mpi/MPIShmChain.h"
-#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
+#include "adios2/toolkit/burstbuffer/FileDrainerMultiThread.h"
 #include "adios2/toolkit/format/bp5/BP5Serializer.h"
 #include "adios2/toolkit/format/buffer/BufferV.h"
 #include "adios2/toolkit/shm/Spinlock.h"
@@ -98,7 +98,7 @@ private:
     /** true if burst buffer is drained to disk  */
     bool m_DrainBB = true;
     /** File drainer thread if burst buffer is used */
-    burstbuffer::FileDrainerSingleThread m_FileDrainer;
+    burstbuffer::FileDrainerMultiThread m_FileDrainer;
     /** m_Name modified with burst buffer path if BB is used,
      * == m_Name otherwise.
      * m_Name is a constant of Engine and is the user provided target path
@@ -159,6 +159,14 @@ private:
 
     void PutCommon(VariableBase &variable, const void *data, bool sync);
 
+    /** Number of coarse levels to write for variable, from the LevelsOfDetail
+     * parameter or the variable's LevelsOfDetail attribute */
+    size_t LevelsOfDetail(const VariableBase &variable) const;
+
+    /** Marshals the coarse levels of one block as hidden companion variables */
+    template <class T>
+    void PutLevelsOfDetail(Variable<T> &variable, const T *values, const size_t levels);
+
 #define declare_type(T, L)                                                                         \
     T *DoBufferData_##L(const int bufferIdx, const size_t payloadPosition,                         \
                         const size_t bufferID = 0) noexcept final;
@@ -188,8 +196,21 @@ private:
     uint64_t WriteMetadata(const std::vector<char> &ContigMetaData,
                            const std::vector<size_t> &SizeVector,
                            const std::vector<core::iovec> &AttributeBlocks);
+    /** One partition's part of a step in md.<k>: the sizes and the blocks of
+     * its writers, and on rank 0 the attribute sizes and blocks of all */
+    uint64_t WriteMetadataPartition(const std::vector<char> &ContigMetaData,
+                                    const std::vector<size_t> &SizeVector,
+                                    const std::vector<core::iovec> &AttributeBlocks);
 
     void SelectiveAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo);
+    /** NumMetadataFiles > 1: each partition of ranks gathers its metadata
+     * to its first rank, which writes it to its own md.<k> */
+    void PartitionedAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo);
+    /** splits the ranks into the metadata partitions, on the first step */
+    void InitMetadataPartitions();
+    /** partition leaders: open md.<k> on the first step, at the append
+     * position of the existing file in Append mode */
+    void OpenMetadataPartition(const size_t partition);
     void TwoLevelAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo);
     void SimpleAggregationMetadata(format::BP5Serializer::TimestepInfo TSInfo);
 
@@ -231,7 +252,36 @@ private:
     aggregator::MPIChain m_AggregatorMetadata; // first level
     helper::Comm m_CommMetadataAggregators;    // second level
 
+    /* partitioned metadata, NumMetadataFiles > 1 */
+    size_t m_MetadataPartitions = 1;
+    bool m_MetadataPartitionsReady = false;
+    helper::Comm m_CommMetadataPartition;        // ranks of my partition
+    helper::Comm m_CommMetadataPartitionLeaders; // first ranks of all partitions
+    /** rank 0: end of the steps in the md.0 a reader assembles from the
+     * partitions, the index records positions in it */
+    uint64_t m_LogicalMetaDataPos = 0;
+    /** rank 0: MetadataPartitionRecord of the latest step for the index */
+    std::vector<uint64_t> m_MetadataPartitionRecord;
+
     adios2::profiling::JSONProfiler m_Profiler;
+    /** trace event of the asynchronous write threads */
+    profiling::TraceEventID m_TraceAsyncWrite = 0;
+    /** timers of the per-step paths, interned once in InitParameters */
+    struct ProfilerIDs
+    {
+        profiling::TraceEventID BS, BSWaitOnAsync, PP, WriteData, WriteMD, WriteMDBlocks,
+            WriteMmD;
+        profiling::TraceEventID ES, ESDeriveVars, ESCloseTS, ESWriteData, ESDSB, ESDSBAllGather,
+            ESDSBBroadcast;
+        profiling::TraceEventID MDAgg, MDAggInfo, MDAggGatherWriteMeta, MDAggMDBlocks, MDAggLv1,
+            MDAggLv2;
+        /** gather timers are named after the communicator size, re-interned
+         * only when it changes */
+        profiling::TraceEventID Meta1Gather, Meta2Gather;
+        int Meta1GatherSize = -1;
+        int Meta2GatherSize = -1;
+    };
+    ProfilerIDs m_ProfID;
 
 protected:
     virtual void DestructorClose(bool Verbose) noexcept;
@@ -280,6 +330,11 @@ private:
 
     bool m_MarshalAttributesNecessary = true;
 
+    /** companion variables of the coarse levels, by name */
+    std::map<std::string, std::unique_ptr<VariableBase>> m_LevelOfDetailVariables;
+    /** LevelOfDetailMethod=average, otherwise every 2^k-th element is kept */
+    bool m_LevelOfDetailAverage = true;
+
     std::vector<std::vector<size_t>> FlushPosSizeInfo;
 
     void MakeHeader(std::vector<char> &buffer, size_t &position, const std::string fileType,
@@ -295,6 +350,10 @@ private:
     uint32_t m_AppendWriterCount;         // last active number of writers
     unsigned int m_AppendAggregatorCount; // last active number of aggr
     unsigned int m_AppendSubfileCount;    // last active number of subfiles
+
+    size_t m_AppendMetadataPartitions = 0;    // md.<k> files, 0 if only md.0
+    uint64_t m_AppendMetadataEnd = 0;         // end of the last step in md.0
+    std::vector<size_t> m_AppendPartitionPos; // each md.<k> append pos
     /* Process existing index, fill in append variables,
      * and return the actual step we land after appending.
      * Uses parameter AppendAfterStep
@@ -354,6 +413,8 @@ private:
         std::vector<ComputationBlockInfo> *currentComputationBlocks; // extended by main thread
         size_t *currentComputationBlockID;                           // increased by main thread
         shm::Spinlock *lock; // race condition over currentComp* variables
+        profiling::TraceRecorder *tracer;
+        profiling::TraceEventID traceEvent;
     };
 
     AsyncWriteInfo *m_AsyncWriteInfo;
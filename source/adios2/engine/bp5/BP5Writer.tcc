@@ -9,7 +9,11 @@
 #define ADIOS2_ENGINE_BP5_BP5WRITER_TCC_
 
 #include "BP5Writer.h"
+#include "adios2/core/Selection.h"
 #include "adios2/helper/adiosMath.h"
+#include "adios2/helper/adiosSystem.h" // IsRowMajor
+
+#include <algorithm>
 
 namespace adios2
 {
@@ -87,6 +91,143 @@ void BP5Writer::PutCommonSpan(Variable<T> &variable, typename Variable<T>::Span
     }
 }
 
+template <class T>
+void BP5Writer::PutLevelsOfDetail(Variable<T> &variable, const T *values, const size_t levels)
+{
+    // coarsen in row-major order, the fastest dimension last
+    const bool rowMajor = helper::IsRowMajor(m_IO.m_HostLanguage);
+    Dims shape = variable.m_Shape;
+    Dims start = variable.m_Start;
+    Dims count = variable.m_Count;
+    if (!rowMajor)
+    {
+        std::reverse(shape.begin(), shape.end());
+        std::reverse(start.begin(), start.end());
+        std::reverse(count.begin(), count.end());
+    }
+    const size_t ndim = count.size();
+    if (ndim == 0 || helper::GetTotalSize(count) == 0)
+    {
+        return;
+    }
+    Dims stride(ndim, 1);
+    for (size_t d = ndim - 1; d > 0; --d)
+    {
+        stride[d - 1] = stride[d] * count[d];
+    }
+
+    // all levels are made before marshaling, which may move a block already
+    // copied into the serializer's buffer
+    std::vector<std::vector<T>> data(levels);
+    std::vector<Box<Dims>> boxes(levels);
+    for (size_t l = 0; l < levels; ++l)
+    {
+        const size_t factor = static_cast<size_t>(1) << (l + 1);
+        boxes[l] = LevelOfDetailBox(start, count, l + 1);
+        std::vector<T> &out = data[l];
+        out.resize(helper::GetTotalSize(boxes[l].second));
+
+        Dims c(ndim, 0);
+        Dims extent(ndim, 1);
+        Dims e(ndim);
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            // first full resolution element of coarse element c, in the block
+            size_t first = 0;
+            for (size_t d = 0; d < ndim; ++d)
+            {
+                const size_t g = (boxes[l].first[d] + c[d]) * factor - start[d];
+                first += g * stride[d];
+                if (m_LevelOfDetailAverage)
+                {
+                    extent[d] = std::min(factor, count[d] - g);
+                }
+            }
+            if (m_LevelOfDetailAverage)
+            {
+                const size_t n = helper::GetTotalSize(extent);
+                double sum = 0.0;
+                std::fill(e.begin(), e.end(), 0);
+                for (size_t k = 0; k < n; ++k)
+                {
+                    size_t pos = first;
+                    for (size_t d = 0; d < ndim; ++d)
+                    {
+                        pos += e[d] * stride[d];
+                    }
+                    sum += static_cast<double>(values[pos]);
+                    for (size_t d = ndim; d-- > 0;)
+                    {
+                        if (++e[d] < extent[d])
+                        {
+                            break;
+                        }
+                        e[d] = 0;
+                    }
+                }
+                out[i] = static_cast<T>(sum / static_cast<double>(n));
+            }
+            else
+            {
+                out[i] = values[first];
+            }
+            for (size_t d = ndim; d-- > 0;)
+            {
+                if (++c[d] < boxes[l].second[d])
+                {
+                    break;
+                }
+                c[d] = 0;
+            }
+        }
+    }
+
+    size_t newLevels = 0;
+    for (size_t l = 0; l < levels; ++l)
+    {
+        if (data[l].empty())
+        {
+            continue;
+        }
+        Dims levelShape = LevelOfDetailBox(Dims(ndim, 0), shape, l + 1).second;
+        Dims levelStart = boxes[l].first;
+        Dims levelCount = boxes[l].second;
+        if (!rowMajor)
+        {
+            std::reverse(levelShape.begin(), levelShape.end());
+            std::reverse(levelStart.begin(), levelStart.end());
+            std::reverse(levelCount.begin(), levelCount.end());
+        }
+        const std::string name = LevelOfDetailName(variable.m_Name, l + 1);
+        auto &slot = m_LevelOfDetailVariables[name];
+        if (!slot)
+        {
+            slot.reset(new Variable<T>(name, levelShape, levelStart, levelCount, false));
+            newLevels = l + 1;
+        }
+        Variable<T> &level = static_cast<Variable<T> &>(*slot);
+        level.m_Shape = levelShape;
+        level.m_Start = levelStart;
+        level.m_Count = levelCount;
+        m_BP5Serializer.Marshal((void *)&level, level.m_Name.c_str(), level.m_Type,
+                                level.m_ElementSize, ndim, level.m_Shape.data(),
+                                level.m_Count.data(), level.m_Start.data(), data[l].data(), true,
+                                nullptr);
+    }
+
+    if (newLevels > 0)
+    {
+        // readers hide the companions only if the full variable says so
+        auto *written = m_IO.InquireAttribute<uint32_t>(LevelsOfDetailAttribute, variable.m_Name);
+        if (written == nullptr || written->m_DataSingleValue < newLevels)
+        {
+            m_IO.DefineAttribute<uint32_t>(LevelsOfDetailAttribute,
+                                           static_cast<uint32_t>(newLevels), variable.m_Name, "/",
+                                           true);
+        }
+    }
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
@@ -190,6 +190,7 @@ void BP5Writer::AsyncWriteOwnData(AsyncWriteInfo *info, std::vector<core::iovec>
 
 int BP5Writer::AsyncWriteThread_EveryoneWrites(AsyncWriteInfo *info)
 {
+    profiling::TraceGuard trace(*info->tracer, info->traceEvent, info->Data->Size());
     if (info->tokenChain)
     {
         if (info->rank_chain > 0)
@@ -277,6 +278,8 @@ void BP5Writer::WriteData_EveryoneWrites_Async(format::BufferV *Data, bool Seria
     AggTransportData *aggData = &(m_AggregatorSpecifics.at(GetCacheKey(m_Aggregator)));
     m_AsyncWriteInfo->tm = &(aggData->m_FileDataManager);
     m_AsyncWriteInfo->Data = Data;
+    m_AsyncWriteInfo->tracer = &m_Profiler.Tracer();
+    m_AsyncWriteInfo->traceEvent = m_TraceAsyncWrite;
     m_AsyncWriteInfo->startPos = m_StartDataPos;
     m_AsyncWriteInfo->totalSize = Data->Size();
     m_AsyncWriteInfo->deadline = m_ExpectedTimeBetweenSteps.count();
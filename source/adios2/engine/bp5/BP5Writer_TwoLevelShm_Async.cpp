@@ -134,6 +134,7 @@ int BP5Writer::AsyncWriteThread_TwoLevelShm(AsyncWriteInfo *info)
 {
     /* DO NOT use MPI in this separate thread, including destroying
        shm segments explicitely (a->DestroyShm) or implicitely (tokenChain) */
+    profiling::TraceGuard trace(*info->tracer, info->traceEvent, info->Data->Size());
     Seconds ts = Now() - info->tstart;
     // std::cout << "ASYNC rank " << info->rank_global
     //          << " starts at: " << ts.count() << std::endl;
@@ -260,6 +261,8 @@ void BP5Writer::WriteData_TwoLevelShm_Async(format::BufferV *Data)
     AggTransportData *aggData = &(m_AggregatorSpecifics.at(GetCacheKey(m_Aggregator)));
     m_AsyncWriteInfo->tm = &(aggData->m_FileDataManager);
     m_AsyncWriteInfo->Data = Data;
+    m_AsyncWriteInfo->tracer = &m_Profiler.Tracer();
+    m_AsyncWriteInfo->traceEvent = m_TraceAsyncWrite;
     m_AsyncWriteInfo->flagRush = &m_flagRush;
     m_AsyncWriteInfo->lock = &m_AsyncWriteLock;
 
@@ -43,6 +43,7 @@ StepStatus HDF5WriterP::BeginStep(StepMode mode, const float timeoutSeconds)
 
 void HDF5WriterP::EndStep()
 {
+    m_H5File.PerformWrites();
     m_H5File.CleanUpNullVars(m_IO);
     m_H5File.Advance();
     m_H5File.WriteAttrFromIO(m_IO);
@@ -52,7 +53,7 @@ void HDF5WriterP::EndStep()
     }
 }
 
-void HDF5WriterP::PerformPuts() {}
+void HDF5WriterP::PerformPuts() { m_H5File.PerformWrites(); }
 
 // PRIVATE
 void HDF5WriterP::Init()
@@ -116,7 +117,7 @@ void HDF5WriterP::Init()
     }                                                                                              \
     void HDF5WriterP::DoPutDeferred(Variable<T> &variable, const T *values)                        \
     {                                                                                              \
-        DoPutSyncCommon(variable, values);                                                         \
+        DoPutDeferredCommon(variable, values);                                                     \
     }
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
@@ -128,6 +129,14 @@ void HDF5WriterP::DoPutSyncCommon(Variable<T> &variable, const T *values)
     m_H5File.Write(variable, values);
 }
 
+// Deferred data is queued and written together in PerformPuts/EndStep
+template <class T>
+void HDF5WriterP::DoPutDeferredCommon(Variable<T> &variable, const T *values)
+{
+    variable.SetData(values);
+    m_H5File.WriteDeferred(variable, values);
+}
+
 // I forced attribute writing to hdf5 in Endstep().
 // So Do not call engine.Flush()
 // unless you are using ascent
@@ -136,6 +145,7 @@ void HDF5WriterP::DoPutSyncCommon(Variable<T> &variable, const T *values)
 
 void HDF5WriterP::Flush(const int transportIndex)
 {
+    m_H5File.PerformWrites();
     m_H5File.WriteAttrFromIO(m_IO);
 
     m_Flushed = true;
@@ -143,6 +153,7 @@ void HDF5WriterP::Flush(const int transportIndex)
 
 void HDF5WriterP::DoClose(const int transportIndex)
 {
+    m_H5File.PerformWrites();
     if (!m_Flushed)
     {
         m_H5File.WriteAttrFromIO(m_IO);
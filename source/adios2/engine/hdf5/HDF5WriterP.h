@@ -61,6 +61,9 @@ private:
     template <class T>
     void DoPutSyncCommon(Variable<T> &variable, const T *values);
 
+    template <class T>
+    void DoPutDeferredCommon(Variable<T> &variable, const T *values);
+
     void DoClose(const int transportIndex = -1) final;
 
     /**
@@ -14,6 +14,8 @@
 #include "adios2/helper/adiosFunctions.h" // CSVToVector
 #include <adios2-perfstubs-interface.h>
 
+#include <cstring>
+#include <future>
 #include <iostream>
 
 namespace adios2
@@ -113,6 +115,7 @@ void InlineReader::PerformGets()
         std::cout << "Inline Reader " << m_ReaderRank << "     PerformGets()\n";
     }
     SetDeferredVariablePointers();
+    PerformCopies();
 }
 
 size_t InlineReader::CurrentStep() const
@@ -142,6 +145,10 @@ void InlineReader::EndStep()
     {
         SetDeferredVariablePointers();
     }
+    if (!m_CopyRequests.empty())
+    {
+        PerformCopies();
+    }
     m_InsideStep = false;
 }
 
@@ -220,6 +227,14 @@ void InlineReader::InitParameters()
                                                      "integer in the range [0,5], in call to "
                                                      "Open or Engine constructor");
         }
+        else if (key == "threads")
+        {
+            m_Threads = helper::StringToSizeT(value, " in Parameter key=Threads ");
+            if (m_Threads == 0)
+            {
+                m_Threads = 1;
+            }
+        }
     }
 }
 
@@ -263,6 +278,52 @@ void InlineReader::SetDeferredVariablePointers()
     m_DeferredVariables.clear();
 }
 
+void InlineReader::PerformCopies()
+{
+    PERFSTUBS_SCOPED_TIMER("InlineReader::PerformCopies");
+    const size_t nRequests = m_CopyRequests.size();
+
+    auto lf_Copy = [&](const size_t tid, const size_t nThreads) {
+        for (size_t i = tid; i < nRequests; i += nThreads)
+        {
+            const CopyRequest &request = m_CopyRequests[i];
+            if (request.Contiguous)
+            {
+                std::memcpy(request.Destination, request.Source,
+                            request.Count[0] * request.ElementSize);
+                continue;
+            }
+            helper::NdCopy(request.Source, request.Start, request.Count, true,
+                           helper::IsLittleEndian(), request.Destination, request.Start,
+                           request.Count, true, helper::IsLittleEndian(),
+                           static_cast<int>(request.ElementSize), request.SourceMemStart,
+                           request.SourceMemCount, request.DestinationMemStart,
+                           request.DestinationMemCount);
+        }
+    };
+
+    const size_t nThreads = (m_Threads < nRequests ? m_Threads : nRequests);
+    if (nThreads > 1)
+    {
+        // launch Threads-1 threads, the main thread copies the first subset
+        std::vector<std::future<void>> futures(nThreads - 1);
+        for (size_t tid = 0; tid < nThreads - 1; ++tid)
+        {
+            futures[tid] = std::async(std::launch::async, lf_Copy, tid + 1, nThreads);
+        }
+        lf_Copy(0, nThreads);
+        for (auto &f : futures)
+        {
+            f.get();
+        }
+    }
+    else if (nRequests > 0)
+    {
+        lf_Copy(0, 1);
+    }
+    m_CopyRequests.clear();
+}
+
 #define declare_type(T) template void InlineReader::Get<T>(Variable<T> &, T **) const;
 ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
 #undef declare_type
@@ -67,6 +67,25 @@ private:
     bool m_InsideStep = false;
     std::vector<std::string> m_DeferredVariables;
 
+    /** number of threads used to copy selections into user memory */
+    size_t m_Threads = 1;
+
+    /** one intersection of a writer block with a reader selection */
+    struct CopyRequest
+    {
+        const char *Source = nullptr;
+        char *Destination = nullptr;
+        size_t ElementSize = 0;
+        bool Contiguous = false; ///< selection equals the block, memcpy it
+        Dims Start;              ///< copied region, global coordinates
+        Dims Count;
+        Dims SourceMemStart; ///< writer block memory layout
+        Dims SourceMemCount;
+        Dims DestinationMemStart; ///< reader selection memory layout
+        Dims DestinationMemCount;
+    };
+    std::vector<CopyRequest> m_CopyRequests;
+
     void Init() final; ///< called from constructor, gets the selected Inline
                        /// transport method from settings
     void InitParameters() final;
@@ -91,6 +110,15 @@ private:
     template <class T>
     typename Variable<T>::BPInfo *GetBlockSyncCommon(Variable<T> &variable);
 
+    /** Intersects the variable selection with the blocks Put by the writer
+     * in this step and queues the copies into data */
+    template <class T>
+    void QueueSelectionCopies(Variable<T> &variable, T *data);
+
+    /** Block of the current step that matches the selection exactly, if any */
+    template <class T>
+    const typename Variable<T>::BPInfo *FindSelectedBlock(const Variable<T> &variable) const;
+
     template <class T>
     typename Variable<T>::BPInfo *GetBlockDeferredCommon(Variable<T> &variable);
 
@@ -105,6 +133,9 @@ private:
 #undef declare_type
 
     void SetDeferredVariablePointers();
+
+    /** Executes the queued m_CopyRequests on up to m_Threads threads */
+    void PerformCopies();
 };
 
 } // end namespace engine
@@ -39,7 +39,8 @@ inline void InlineReader::GetSyncCommon(Variable<T> &variable, T *data)
     }
     else
     {
-        *data = blockInfo.Data[0];
+        QueueSelectionCopies(variable, data);
+        PerformCopies();
     }
 }
 
@@ -50,8 +51,11 @@ void InlineReader::Get(core::Variable<T> &variable, T **data) const
     {
         std::cout << "Inline Reader " << m_ReaderRank << "     Get(" << variable.m_Name << ")\n";
     }
-    auto blockInfo = variable.m_BlocksInfo.back();
-    *data = blockInfo.Data;
+    // a local array without SetBlockSelection keeps getting the last block Put
+    const bool unselectedLocal = (variable.m_ShapeID == ShapeID::LocalArray &&
+                                  variable.m_SelectionType != SelectionType::WriteBlock);
+    const auto *blockInfo = unselectedLocal ? nullptr : FindSelectedBlock(variable);
+    *data = blockInfo ? blockInfo->Data : variable.m_BlocksInfo.back().Data;
 }
 
 template <class T>
@@ -63,9 +67,132 @@ void InlineReader::GetDeferredCommon(Variable<T> &variable, T *data)
     }
     else
     {
-        helper::Throw<std::runtime_error>(
-            "Engine", "InlineReader", "GetDeferredCommon",
-            "GetBlockDeferredCommon should be used instead of GetDeferredCommon.");
+        if (m_Verbosity == 5)
+        {
+            std::cout << "Inline Reader " << m_ReaderRank << "     GetDeferred("
+                      << variable.m_Name << ")\n";
+        }
+        variable.m_Data = data;
+        QueueSelectionCopies(variable, data);
+    }
+}
+
+template <class T>
+const typename Variable<T>::BPInfo *
+InlineReader::FindSelectedBlock(const Variable<T> &variable) const
+{
+    if (variable.m_SelectionType == SelectionType::WriteBlock ||
+        variable.m_ShapeID == ShapeID::LocalArray)
+    {
+        if (variable.m_BlockID < variable.m_BlocksInfo.size())
+        {
+            return &variable.m_BlocksInfo[variable.m_BlockID];
+        }
+        return nullptr;
+    }
+    for (const auto &blockInfo : variable.m_BlocksInfo)
+    {
+        if (blockInfo.Start == variable.m_Start && blockInfo.Count == variable.m_Count)
+        {
+            return &blockInfo;
+        }
+    }
+    return nullptr;
+}
+
+template <class T>
+void InlineReader::QueueSelectionCopies(Variable<T> &variable, T *data)
+{
+    const bool blockSelection = (variable.m_SelectionType == SelectionType::WriteBlock ||
+                                 variable.m_ShapeID == ShapeID::LocalArray);
+    if (blockSelection && variable.m_BlockID >= variable.m_BlocksInfo.size())
+    {
+        helper::Throw<std::invalid_argument>(
+            "Engine", "InlineReader", "QueueSelectionCopies",
+            "selected BlockID " + std::to_string(variable.m_BlockID) +
+                " is above range of available blocks for variable " + variable.m_Name);
+    }
+
+    const Dims selCount = blockSelection ? variable.m_BlocksInfo[variable.m_BlockID].Count
+                                         : variable.m_Count;
+    Dims selStart = blockSelection ? variable.m_BlocksInfo[variable.m_BlockID].Start
+                                   : variable.m_Start;
+    if (selStart.empty())
+    {
+        // local array blocks have no start, copy in block coordinates
+        selStart.assign(selCount.size(), 0);
+    }
+    Dims outMemStart;
+    Dims outMemCount;
+    if (!variable.m_MemoryCount.empty())
+    {
+        outMemStart.resize(selStart.size());
+        for (size_t d = 0; d < selStart.size(); ++d)
+        {
+            outMemStart[d] = selStart[d] - variable.m_MemoryStart[d];
+        }
+        outMemCount = variable.m_MemoryCount;
+    }
+
+    auto lf_QueueCopy = [&](const typename Variable<T>::BPInfo &blockInfo, const Dims &blockStart,
+                            const Dims &start, const Dims &count) {
+        CopyRequest request;
+        request.Source = reinterpret_cast<const char *>(blockInfo.Data);
+        request.Destination = reinterpret_cast<char *>(data);
+        request.ElementSize = sizeof(T);
+        request.Start = start;
+        request.Count = count;
+        request.SourceMemStart = blockStart;
+        request.SourceMemCount = blockInfo.Count;
+        if (!blockInfo.MemoryCount.empty())
+        {
+            for (size_t d = 0; d < blockStart.size(); ++d)
+            {
+                request.SourceMemStart[d] -= blockInfo.MemoryStart[d];
+            }
+            request.SourceMemCount = blockInfo.MemoryCount;
+        }
+        request.DestinationMemStart = outMemStart.empty() ? selStart : outMemStart;
+        request.DestinationMemCount = outMemCount.empty() ? selCount : outMemCount;
+        m_CopyRequests.push_back(std::move(request));
+    };
+
+    // zero-copy candidate: the selection is exactly one writer block, and
+    // neither side has a memory selection
+    const auto *selected = FindSelectedBlock(variable);
+    if (selected && selected->MemoryCount.empty() && outMemCount.empty())
+    {
+        CopyRequest request;
+        request.Source = reinterpret_cast<const char *>(selected->Data);
+        request.Destination = reinterpret_cast<char *>(data);
+        request.ElementSize = sizeof(T);
+        request.Contiguous = true;
+        request.Count = {helper::GetTotalSize(selected->Count)};
+        m_CopyRequests.push_back(std::move(request));
+        return;
+    }
+    if (blockSelection)
+    {
+        // only the selected block, the others may overlap it
+        lf_QueueCopy(*selected, selStart, selStart, selCount);
+        return;
+    }
+
+    const Box<Dims> selectionBox = helper::StartEndBox(selStart, selCount);
+    for (const auto &blockInfo : variable.m_BlocksInfo)
+    {
+        const Box<Dims> intersection = helper::IntersectionBox(
+            selectionBox, helper::StartEndBox(blockInfo.Start, blockInfo.Count));
+        if (intersection.first.empty())
+        {
+            continue;
+        }
+        Dims count(intersection.first.size());
+        for (size_t d = 0; d < count.size(); ++d)
+        {
+            count[d] = intersection.second[d] - intersection.first[d] + 1;
+        }
+        lf_QueueCopy(blockInfo, blockInfo.Start, intersection.first, count);
     }
 }
 
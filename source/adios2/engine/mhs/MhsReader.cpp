@@ -11,6 +11,9 @@
 #include "MhsReader.tcc"
 #include "adios2/helper/adiosFunctions.h"
 
+#include <fstream>
+#include <sstream>
+
 namespace adios2
 {
 namespace core
@@ -34,6 +37,8 @@ MhsReader::MhsReader(IO &io, const std::string &name, const Mode mode, helper::C
         m_SubEngines.emplace_back(
             &m_SubIOs.back()->Open(m_Name + ".tier" + std::to_string(i), adios2::Mode::Read));
     }
+    m_TierActive.resize(m_SubEngines.size(), true);
+    ReadCatalog();
     m_IsOpen = true;
 }
 
@@ -53,9 +58,15 @@ MhsReader::~MhsReader()
 StepStatus MhsReader::BeginStep(const StepMode mode, const float timeoutSeconds)
 {
     bool endOfStream = false;
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        auto status = e->BeginStep(mode, timeoutSeconds);
+        // a tier that stopped being written before this step is skipped
+        m_TierActive[i] = (i == 0 || i >= m_TierSteps.size() || m_CurrentStep < m_TierSteps[i]);
+        if (!m_TierActive[i])
+        {
+            continue;
+        }
+        auto status = m_SubEngines[i]->BeginStep(mode, timeoutSeconds);
         if (status == StepStatus::EndOfStream)
         {
             endOfStream = true;
@@ -72,18 +83,25 @@ size_t MhsReader::CurrentStep() const { return m_SubEngines[0]->CurrentStep(); }
 
 void MhsReader::PerformGets()
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->PerformGets();
+        if (m_TierActive[i])
+        {
+            m_SubEngines[i]->PerformGets();
+        }
     }
 }
 
 void MhsReader::EndStep()
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->EndStep();
+        if (m_TierActive[i])
+        {
+            m_SubEngines[i]->EndStep();
+        }
     }
+    ++m_CurrentStep;
 }
 
 // PRIVATE
@@ -98,6 +116,49 @@ void MhsReader::EndStep()
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
 
+void MhsReader::ReadCatalog()
+{
+    std::string contents;
+    if (m_Comm.Rank() == 0)
+    {
+        std::ifstream file(m_Name + ".catalog");
+        if (file)
+        {
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            contents = buffer.str();
+        }
+    }
+    contents = m_Comm.BroadcastValue(contents);
+
+    std::istringstream lines(contents);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        std::istringstream fields(line);
+        std::string key;
+        size_t tier = 0;
+        fields >> key >> tier;
+        if (key == "steps")
+        {
+            size_t steps = 0;
+            fields >> steps;
+            if (tier >= m_TierSteps.size())
+            {
+                m_TierSteps.resize(tier + 1, 0);
+            }
+            m_TierSteps[tier] = steps;
+        }
+        else if (key == "route")
+        {
+            std::string name;
+            fields.get();
+            std::getline(fields, name);
+            m_Replicas[name].push_back(tier);
+        }
+    }
+}
+
 void MhsReader::DoClose(const int transportIndex)
 {
     for (auto &e : m_SubEngines)
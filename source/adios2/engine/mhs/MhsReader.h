@@ -36,7 +36,17 @@ private:
     std::vector<IO *> m_SubIOs;
     std::vector<Engine *> m_SubEngines;
     std::shared_ptr<compress::CompressSirius> m_SiriusCompressor;
-    int m_Tiers;
+    int m_Tiers = 1;
+
+    /* from <name>.catalog: steps written to each tier and the variables
+     * copied to slower tiers, which are read from tier 0 only. Without a
+     * catalog every tier is assumed to hold every step */
+    std::vector<size_t> m_TierSteps;
+    std::unordered_map<std::string, std::vector<size_t>> m_Replicas;
+    std::vector<bool> m_TierActive;
+    size_t m_CurrentStep = 0;
+
+    void ReadCatalog();
 
 #define declare_type(T)                                                                            \
     void DoGetSync(Variable<T> &, T *) final;                                                      \
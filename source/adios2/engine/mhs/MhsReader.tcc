@@ -36,8 +36,18 @@ inline void MhsReader::GetDeferredCommon(Variable<std::string> &variable, std::s
 template <class T>
 void MhsReader::GetDeferredCommon(Variable<T> &variable, T *data)
 {
+    if (m_Replicas.find(variable.m_Name) != m_Replicas.end())
+    {
+        // slower tiers only hold copies of tier 0
+        m_SubEngines[0]->Get(variable, data, Mode::Sync);
+        return;
+    }
     for (int i = 0; i < m_Tiers; ++i)
     {
+        if (!m_TierActive[i])
+        {
+            break;
+        }
         auto var = m_SubIOs[i]->InquireVariable<T>(variable.m_Name);
         if (!var)
         {
@@ -12,6 +12,8 @@
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/operator/compress/CompressSirius.h"
 
+#include <fstream>
+
 namespace adios2
 {
 namespace core
@@ -23,6 +25,26 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode, helper::C
 : Engine("MhsWriter", io, name, mode, std::move(comm))
 {
     helper::GetParameter(io.m_Parameters, "Tiers", m_Tiers);
+    helper::GetParameter(io.m_Parameters, "AsyncMigration", m_AsyncMigration);
+    if (m_AsyncMigration)
+    {
+        // the background EndStep of a tier communicates while the
+        // application thread does, every rank must run the same mode
+        const int local = m_Comm.IsThreadMultiple() ? 1 : 0;
+        int all = 0;
+        m_Comm.Allreduce(&local, &all, 1, helper::Comm::Op::Min);
+        if (!all)
+        {
+            m_AsyncMigration = false;
+            if (m_Comm.Rank() == 0)
+            {
+                helper::Log("Engine", "MhsWriter", "MhsWriter",
+                            "AsyncMigration needs MPI_THREAD_MULTIPLE, migrating "
+                            "synchronously",
+                            helper::LogMode::WARNING);
+            }
+        }
+    }
     for (const auto &transportParams : io.m_TransportsParameters)
     {
         auto itVar = transportParams.find("variable");
@@ -41,6 +63,18 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode, helper::C
             m_TransportMap.emplace(itVar->second,
                                    std::make_shared<compress::CompressSirius>(io.m_Parameters));
         }
+        else if (itTransport->second == "tier")
+        {
+            int tier = 0;
+            helper::GetParameter(transportParams, "tier", tier);
+            if (tier < 1 || tier >= m_Tiers)
+            {
+                helper::Throw<std::invalid_argument>("Engine", "MhsWriter", "MhsWriter",
+                                                     "invalid tier " + std::to_string(tier) +
+                                                         " for variable " + itVar->second);
+            }
+            m_TierRouting[itVar->second].push_back(static_cast<size_t>(tier));
+        }
         else
         {
             helper::Throw<std::invalid_argument>("Engine", "MhsWriter", "MhsWriter",
@@ -53,11 +87,25 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode, helper::C
         m_SubEngines.emplace_back(
             &m_SubIOs.back()->Open(m_Name + ".tier" + std::to_string(i), adios2::Mode::Write));
     }
+    m_Migrations.resize(m_SubEngines.size());
+    m_TierStepOpen.resize(m_SubEngines.size(), false);
+    m_TierSteps.resize(m_SubEngines.size(), 0);
+    m_TierFailed.resize(m_SubEngines.size(), false);
+    m_TierErrors.resize(m_SubEngines.size());
+    m_TierReported.resize(m_SubEngines.size(), false);
     m_IsOpen = true;
 }
 
 MhsWriter::~MhsWriter()
 {
+    // the sub-engines go away with their IOs, background steps must be done
+    for (auto &migration : m_Migrations)
+    {
+        if (migration.valid())
+        {
+            migration.wait();
+        }
+    }
     for (int i = 0; i < m_Tiers; ++i)
     {
         m_IO.m_ADIOS.RemoveIO("SubIO" + std::to_string(i));
@@ -71,9 +119,17 @@ MhsWriter::~MhsWriter()
 
 StepStatus MhsWriter::BeginStep(StepMode mode, const float timeoutSeconds)
 {
-    for (auto &e : m_SubEngines)
+    m_InStep = true;
+    m_StepMode = mode;
+    m_StepTimeout = timeoutSeconds;
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->BeginStep(mode, timeoutSeconds);
+        // with AsyncMigration a slower tier may still be ending the previous
+        // step, its step is opened by its first Put or at EndStep
+        if (i == 0 || !m_AsyncMigration)
+        {
+            BeginTierStep(i);
+        }
     }
     return StepStatus::OK;
 }
@@ -82,25 +138,62 @@ size_t MhsWriter::CurrentStep() const { return m_SubEngines[0]->CurrentStep(); }
 
 void MhsWriter::PerformPuts()
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->PerformPuts();
+        // nothing was put yet to a tier whose step is not open
+        if (m_InStep && !m_TierStepOpen[i])
+        {
+            continue;
+        }
+        if (BeginTierStep(i))
+        {
+            m_SubEngines[i]->PerformPuts();
+        }
     }
 }
 
 void MhsWriter::EndStep()
 {
-    for (auto &e : m_SubEngines)
+    // synchronous tiers raise their errors right away, nothing to agree on
+    const std::string failures = m_AsyncMigration ? AgreeOnTierFailures() : std::string();
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->EndStep();
+        // every tier ends every step, also the ones without data
+        if (!BeginTierStep(i))
+        {
+            continue;
+        }
+        m_TierStepOpen[i] = false;
+        Engine *engine = m_SubEngines[i];
+        if (i > 0 && m_AsyncMigration)
+        {
+            m_Migrations[i] = std::async(std::launch::async, [engine]() { engine->EndStep(); });
+        }
+        else
+        {
+            engine->EndStep();
+            ++m_TierSteps[i];
+        }
+    }
+    m_InStep = false;
+    if (!failures.empty())
+    {
+        // the working tiers completed the step, readers find in the catalog
+        // where the failed ones stopped
+        WriteCatalog();
+        helper::Throw<std::runtime_error>("Engine", "MhsWriter", "EndStep",
+                                          "migration failed," + failures);
     }
 }
 
 void MhsWriter::Flush(const int transportIndex)
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->Flush(transportIndex);
+        if (BeginTierStep(i))
+        {
+            m_SubEngines[i]->Flush(transportIndex);
+        }
     }
 }
 
@@ -118,11 +211,115 @@ void MhsWriter::Flush(const int transportIndex)
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 #undef declare_type
 
+bool MhsWriter::BeginTierStep(const size_t tier)
+{
+    WaitForMigration(tier);
+    if (m_TierFailed[tier])
+    {
+        return false;
+    }
+    if (m_InStep && !m_TierStepOpen[tier])
+    {
+        m_SubEngines[tier]->BeginStep(m_StepMode, m_StepTimeout);
+        m_TierStepOpen[tier] = true;
+    }
+    return true;
+}
+
+void MhsWriter::WaitForMigration(const size_t tier)
+{
+    if (!m_Migrations[tier].valid())
+    {
+        return;
+    }
+    try
+    {
+        m_Migrations[tier].get();
+        ++m_TierSteps[tier];
+    }
+    catch (std::exception &e)
+    {
+        // this rank stops writing the tier now, the next EndStep or Close
+        // tells the others and raises the error
+        m_TierFailed[tier] = true;
+        m_TierErrors[tier] = e.what();
+    }
+}
+
+std::string MhsWriter::AgreeOnTierFailures()
+{
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
+    {
+        WaitForMigration(i);
+    }
+
+    // ending or closing a tier is collective, all ranks must skip it
+    std::vector<int> local(m_TierFailed.size()), all(m_TierFailed.size());
+    for (size_t i = 0; i < m_TierFailed.size(); ++i)
+    {
+        local[i] = m_TierFailed[i] ? 1 : 0;
+    }
+    m_Comm.Allreduce(local.data(), all.data(), all.size(), helper::Comm::Op::Max);
+
+    std::string failures;
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        if (!all[i] || m_TierReported[i])
+        {
+            continue;
+        }
+        m_TierFailed[i] = true;
+        m_TierReported[i] = true;
+        failures += " tier " + std::to_string(i) + " stopped after step " +
+                    std::to_string(m_TierSteps[i]) + ": " +
+                    (m_TierErrors[i].empty() ? "failed on another rank" : m_TierErrors[i]) + ".";
+    }
+    return failures;
+}
+
+void MhsWriter::WriteCatalog()
+{
+    // without background steps every tier holds every step, the catalog is
+    // only needed for the routed variables
+    if (m_Comm.Rank() != 0 || (!m_AsyncMigration && m_TierRouting.empty()))
+    {
+        return;
+    }
+    std::ofstream catalog(m_Name + ".catalog");
+    catalog << "tiers " << m_SubEngines.size() << "\n";
+    for (size_t i = 0; i < m_TierSteps.size(); ++i)
+    {
+        catalog << "steps " << i << " " << m_TierSteps[i] << "\n";
+    }
+    for (const auto &route : m_TierRouting)
+    {
+        for (const auto tier : route.second)
+        {
+            catalog << "route " << tier << " " << route.first << "\n";
+        }
+    }
+    if (!catalog)
+    {
+        helper::Log("Engine", "MhsWriter", "WriteCatalog",
+                    "unable to write " + m_Name + ".catalog", helper::LogMode::WARNING);
+    }
+}
+
 void MhsWriter::DoClose(const int transportIndex)
 {
-    for (auto &e : m_SubEngines)
+    const std::string failures = m_AsyncMigration ? AgreeOnTierFailures() : std::string();
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
+    {
+        if (!m_TierFailed[i])
+        {
+            m_SubEngines[i]->Close();
+        }
+    }
+    WriteCatalog();
+    if (!failures.empty())
     {
-        e->Close();
+        helper::Throw<std::runtime_error>("Engine", "MhsWriter", "Close",
+                                          "migration failed," + failures);
     }
 }
 
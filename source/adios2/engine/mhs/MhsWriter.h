@@ -13,6 +13,8 @@
 
 #include "adios2/core/Engine.h"
 
+#include <future>
+
 namespace adios2
 {
 namespace core
@@ -39,8 +41,43 @@ private:
     std::unordered_map<std::string, std::shared_ptr<Operator>> m_TransportMap;
     int m_Tiers = 1;
 
+    /* slower tiers end their steps in the background, tier 0 stays on the
+     * critical path */
+    bool m_AsyncMigration = false;
+    /* extra tiers that get a plain copy of a variable, from "tier" transports */
+    std::unordered_map<std::string, std::vector<size_t>> m_TierRouting;
+
+    bool m_InStep = false;
+    StepMode m_StepMode = StepMode::Append;
+    float m_StepTimeout = -1.0;
+
+    /* per tier: pending background EndStep, open step, completed steps,
+     * whether the tier was given up after a failed step, why, and whether
+     * the failure was raised to the application */
+    std::vector<std::future<void>> m_Migrations;
+    std::vector<bool> m_TierStepOpen;
+    std::vector<size_t> m_TierSteps;
+    std::vector<bool> m_TierFailed;
+    std::vector<std::string> m_TierErrors;
+    std::vector<bool> m_TierReported;
+
     void PutSubEngine(bool finalPut = false);
 
+    /** waits for the tier's pending EndStep and opens its step if needed,
+     * returns false if the tier is no longer written */
+    bool BeginTierStep(const size_t tier);
+    void WaitForMigration(const size_t tier);
+
+    /** collective, AsyncMigration only: waits for all background steps and
+     * makes a tier that failed on any rank failed on all of them. Returns the
+     * description of the failures not reported before, empty if there are
+     * none */
+    std::string AgreeOnTierFailures();
+
+    /** rank 0 records the steps of each tier and the routed variables for
+     * the reader in <name>.catalog, only with AsyncMigration or routes */
+    void WriteCatalog();
+
 #define declare_type(T)                                                                            \
     void DoPutSync(Variable<T> &, const T *) final;                                                \
     void DoPutDeferred(Variable<T> &, const T *) final;
@@ -29,6 +29,7 @@ void MhsWriter::PutDeferredCommon<std::string>(Variable<std::string> &variable,
     {
         var = &m_SubIOs[0]->DefineVariable<std::string>(variable.m_Name, {LocalValueDim});
     }
+    BeginTierStep(0);
     m_SubEngines[0]->Put(variable, data, Mode::Sync);
 }
 
@@ -64,21 +65,46 @@ void MhsWriter::PutDeferredCommon(Variable<T> &variable, const T *data)
     }
 
     var0->SetSelection({variable.m_Start, variable.m_Count});
+    BeginTierStep(0);
     m_SubEngines[0]->Put(*var0, data, Mode::Sync);
 
+    // sirius splits the data over all tiers, routed variables are copied to
+    // their tiers. The sub-engines buffer the data until EndStep, which runs
+    // in the background for the slower tiers with AsyncMigration
+    std::vector<size_t> tiers;
     if (putToAll)
     {
         for (size_t i = 1; i < m_SubEngines.size(); ++i)
         {
-            auto var = m_SubIOs[i]->InquireVariable<T>(variable.m_Name);
-            if (!var)
+            tiers.push_back(i);
+        }
+    }
+    else
+    {
+        auto itRoute = m_TierRouting.find(variable.m_Name);
+        if (itRoute != m_TierRouting.end())
+        {
+            tiers = itRoute->second;
+        }
+    }
+
+    for (const auto i : tiers)
+    {
+        if (!BeginTierStep(i))
+        {
+            continue;
+        }
+        auto var = m_SubIOs[i]->InquireVariable<T>(variable.m_Name);
+        if (!var)
+        {
+            var = &m_SubIOs[i]->DefineVariable<T>(variable.m_Name, variable.m_Shape);
+            if (putToAll)
             {
-                var = &m_SubIOs[i]->DefineVariable<T>(variable.m_Name, variable.m_Shape);
                 var->AddOperation(itVar->second);
             }
-            var->SetSelection({variable.m_Start, variable.m_Count});
-            m_SubEngines[i]->Put(*var, data, Mode::Sync);
         }
+        var->SetSelection({variable.m_Start, variable.m_Count});
+        m_SubEngines[i]->Put(*var, data, Mode::Sync);
     }
 }
 
@@ -757,6 +757,48 @@ void MPI_Gatherv64OneSidedPush(const void *sendbuf, uint64_t sendcount, MPI_Data
     MPI_Win_free(&win);
 }
 
+void UpdateWindow(RmaWindow &window, void *base, const size_t size, MPI_Comm comm)
+{
+    int rebuild = (window.win == MPI_WIN_NULL || base != window.base || size > window.size);
+    MPI_Allreduce(MPI_IN_PLACE, &rebuild, 1, MPI_INT, MPI_MAX, comm);
+    if (rebuild != 0)
+    {
+        FreeWindow(window);
+        MPI_Win_create(base, size, 1, MPI_INFO_NULL, comm, &window.win);
+        window.base = base;
+        window.size = size;
+    }
+    // the stores of this step reach the public copy of the window (separate
+    // model) or are ordered before the peers' MPI_Get (unified model) only
+    // through a synchronization, the caller's barrier then hands them over
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window.win);
+    MPI_Win_sync(window.win);
+    MPI_Win_unlock_all(window.win);
+}
+
+void FreeWindow(RmaWindow &window)
+{
+    if (window.win != MPI_WIN_NULL)
+    {
+        MPI_Win_free(&window.win);
+    }
+    window.base = nullptr;
+    window.size = 0;
+}
+
+void FreeRequests(std::vector<MPI_Request> &requests)
+{
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    for (auto &r : requests)
+    {
+        if (r != MPI_REQUEST_NULL)
+        {
+            MPI_Request_free(&r);
+        }
+    }
+    requests.clear();
+}
+
 void PrintDims(const Dims &dims, const std::string &label)
 {
     std::cout << label;
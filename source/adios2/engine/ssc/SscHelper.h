@@ -90,6 +90,7 @@ public:
         return reinterpret_cast<const uint8_t *>(m_Buffer + pos);
     }
     size_t size() const { return m_Size; }
+    size_t capacity() const { return m_Capacity; }
     uint8_t &operator[](const size_t pos) { return *(m_Buffer + pos); }
     const uint8_t &operator[](const size_t pos) const { return *(m_Buffer + pos); }
 
@@ -165,6 +166,25 @@ void MPI_Gatherv64(const void *sendbuf, uint64_t sendcount, MPI_Datatype sendtyp
 
 bool AreSameDims(const Dims &a, const Dims &b);
 
+/* RMA window kept across steps, see UpdateWindow */
+struct RmaWindow
+{
+    MPI_Win win = MPI_WIN_NULL;
+    void *base = nullptr;
+    size_t size = 0;
+};
+
+/* Collective over comm: reuses the window of the previous step unless the
+ * memory of some rank moved or outgrew it, only then it is re-created.
+ * Call it after the local writes of the step and before the barrier that
+ * lets the peers read, its MPI_Win_sync makes those writes visible to
+ * MPI_Get in either memory model */
+void UpdateWindow(RmaWindow &window, void *base, const size_t size, MPI_Comm comm);
+void FreeWindow(RmaWindow &window);
+
+/* persistent point to point requests are freed once they are done */
+void FreeRequests(std::vector<MPI_Request> &requests);
+
 } // end namespace ssc
 } // end namespace engine
 } // end namespace core
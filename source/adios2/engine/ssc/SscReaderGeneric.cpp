@@ -27,7 +27,6 @@ SscReaderGeneric::SscReaderGeneric(IO &io, const std::string &name, const Mode m
 void SscReaderGeneric::BeginStepConsequentFixed()
 {
     MPI_Waitall(static_cast<int>(m_MpiRequests.size()), m_MpiRequests.data(), MPI_STATUS_IGNORE);
-    m_MpiRequests.clear();
 }
 
 void SscReaderGeneric::BeginStepFlexible(StepStatus &status)
@@ -42,10 +41,11 @@ void SscReaderGeneric::BeginStepFlexible(StepStatus &status)
     bool finalStep = SyncWritePattern();
     if (finalStep)
     {
+        ssc::FreeWindow(m_Window);
         status = StepStatus::EndOfStream;
         return;
     }
-    MPI_Win_create(NULL, 0, 1, MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
+    ssc::UpdateWindow(m_Window, nullptr, 0, m_StreamComm);
 }
 
 StepStatus SscReaderGeneric::BeginStep(const StepMode stepMode, const float timeoutSeconds,
@@ -129,6 +129,8 @@ StepStatus SscReaderGeneric::BeginStep(const StepMode stepMode, const float time
 
     if (m_Buffer[0] == 1)
     {
+        ssc::FreeRequests(m_MpiRequests);
+        ssc::FreeWindow(m_Window);
         return StepStatus::EndOfStream;
     }
 
@@ -141,27 +143,35 @@ void SscReaderGeneric::EndStepFixed()
 {
     if (m_CurrentStep == 0)
     {
-        MPI_Win_free(&m_MpiWin);
+        MPI_Barrier(m_StreamComm);
         SyncReadPattern();
     }
-    for (const auto &i : m_AllReceivingWriterRanks)
+    // the receive plan is built once, the buffer does not move in fixed mode
+    if (m_MpiRequests.empty())
     {
-        m_MpiRequests.emplace_back();
-        MPI_Irecv(m_Buffer.data() + i.second.first, static_cast<int>(i.second.second), MPI_CHAR,
-                  i.first, 0, m_StreamComm, &m_MpiRequests.back());
+        for (const auto &i : m_AllReceivingWriterRanks)
+        {
+            m_MpiRequests.emplace_back();
+            MPI_Recv_init(m_Buffer.data() + i.second.first, static_cast<int>(i.second.second),
+                          MPI_CHAR, i.first, 0, m_StreamComm, &m_MpiRequests.back());
+        }
+    }
+    if (!m_MpiRequests.empty())
+    {
+        MPI_Startall(static_cast<int>(m_MpiRequests.size()), m_MpiRequests.data());
     }
 }
 
 void SscReaderGeneric::EndStepFirstFlexible()
 {
-    MPI_Win_free(&m_MpiWin);
+    MPI_Barrier(m_StreamComm);
     SyncReadPattern();
     BeginStepFlexible(m_StepStatus);
 }
 
 void SscReaderGeneric::EndStepConsequentFlexible()
 {
-    MPI_Win_free(&m_MpiWin);
+    MPI_Barrier(m_StreamComm);
     BeginStepFlexible(m_StepStatus);
 }
 
@@ -184,7 +194,8 @@ void SscReaderGeneric::EndStep(const bool readerLocked)
             }
             else
             {
-                MPI_Win_free(&m_MpiWin);
+                // done reading, the writers keep the window for the next step
+                MPI_Barrier(m_StreamComm);
                 SyncReadPattern();
             }
         }
@@ -196,7 +207,7 @@ void SscReaderGeneric::EndStep(const bool readerLocked)
             }
             else
             {
-                MPI_Win_free(&m_MpiWin);
+                MPI_Barrier(m_StreamComm);
             }
         }
     }
@@ -224,14 +235,15 @@ void SscReaderGeneric::PerformGets()
                 totalDataSize += i.second.second;
             }
             m_Buffer.resize(totalDataSize);
+            // one passive epoch for all writers instead of one per writer
+            MPI_Win_lock_all(0, m_Window.win);
             for (const auto &i : m_AllReceivingWriterRanks)
             {
-                MPI_Win_lock(MPI_LOCK_SHARED, i.first, 0, m_MpiWin);
                 MPI_Get(m_Buffer.data() + i.second.first, static_cast<int>(i.second.second),
                         MPI_CHAR, i.first, 0, static_cast<int>(i.second.second), MPI_CHAR,
-                        m_MpiWin);
-                MPI_Win_unlock(i.first, m_MpiWin);
+                        m_Window.win);
             }
+            MPI_Win_unlock_all(m_Window.win);
         }
 
         for (auto &br : m_LocalReadPattern)
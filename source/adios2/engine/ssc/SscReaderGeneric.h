@@ -55,12 +55,13 @@ private:
     bool m_ReaderSelectionsLocked = false;
     std::thread m_EndStepThread;
     StepStatus m_StepStatus;
+    // persistent receives from the writers, started again every fixed step
     std::vector<MPI_Request> m_MpiRequests;
     ssc::RankPosMap m_AllReceivingWriterRanks;
     ssc::BlockVecVec m_GlobalWritePattern;
     ssc::BlockVec m_LocalReadPattern;
     ssc::Buffer m_GlobalWritePatternBuffer;
-    MPI_Win m_MpiWin;
+    ssc::RmaWindow m_Window;
 
     bool SyncWritePattern();
     void SyncReadPattern();
@@ -54,11 +54,11 @@ StepStatus SscWriterGeneric::BeginStep(const StepMode mode, const float timeoutS
         {
             MPI_Waitall(static_cast<int>(m_MpiRequests.size()), m_MpiRequests.data(),
                         MPI_STATUSES_IGNORE);
-            m_MpiRequests.clear();
         }
         else
         {
-            MPI_Win_free(&m_MpiWin);
+            // the readers are done with the window of the last step
+            MPI_Barrier(m_StreamComm);
         }
     }
 
@@ -116,9 +116,7 @@ void SscWriterGeneric::Close(const int transportIndex)
     {
         if (m_CurrentStep > 0)
         {
-            MPI_Waitall(static_cast<int>(m_MpiRequests.size()), m_MpiRequests.data(),
-                        MPI_STATUSES_IGNORE);
-            m_MpiRequests.clear();
+            ssc::FreeRequests(m_MpiRequests);
         }
 
         m_Buffer[0] = 1;
@@ -133,9 +131,13 @@ void SscWriterGeneric::Close(const int transportIndex)
     }
     else
     {
-        MPI_Win_free(&m_MpiWin);
+        if (m_Window.win != MPI_WIN_NULL)
+        {
+            MPI_Barrier(m_StreamComm);
+        }
         SyncWritePattern(true);
     }
+    ssc::FreeWindow(m_Window);
 }
 
 void SscWriterGeneric::PutDeferred(VariableBase &variable, const void *data)
@@ -259,25 +261,36 @@ void SscWriterGeneric::PutDeferred(VariableBase &variable, const void *data)
 void SscWriterGeneric::EndStepFirst()
 {
     SyncWritePattern();
-    MPI_Win_create(m_Buffer.data(), m_Buffer.size(), 1, MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
-    MPI_Win_free(&m_MpiWin);
+    ssc::UpdateWindow(m_Window, m_Buffer.data(), m_Buffer.capacity(), m_StreamComm);
+    MPI_Barrier(m_StreamComm);
     SyncReadPattern();
 }
 
 void SscWriterGeneric::EndStepConsequentFixed()
 {
-    for (const auto &i : m_AllSendingReaderRanks)
+    // the buffer and the readers do not change any more, so the sends are
+    // set up once and only restarted in the following steps
+    if (m_MpiRequests.empty())
+    {
+        for (const auto &i : m_AllSendingReaderRanks)
+        {
+            m_MpiRequests.emplace_back();
+            MPI_Send_init(m_Buffer.data(), static_cast<int>(m_Buffer.size()), MPI_CHAR, i.first,
+                          0, m_StreamComm, &m_MpiRequests.back());
+        }
+    }
+    if (!m_MpiRequests.empty())
     {
-        m_MpiRequests.emplace_back();
-        MPI_Isend(m_Buffer.data(), static_cast<int>(m_Buffer.size()), MPI_CHAR, i.first, 0,
-                  m_StreamComm, &m_MpiRequests.back());
+        MPI_Startall(static_cast<int>(m_MpiRequests.size()), m_MpiRequests.data());
     }
 }
 
 void SscWriterGeneric::EndStepConsequentFlexible()
 {
     SyncWritePattern();
-    MPI_Win_create(m_Buffer.data(), m_Buffer.size(), 1, MPI_INFO_NULL, m_StreamComm, &m_MpiWin);
+    // the window covers the whole buffer capacity, it only changes when the
+    // buffer grows
+    ssc::UpdateWindow(m_Window, m_Buffer.data(), m_Buffer.capacity(), m_StreamComm);
 }
 
 void SscWriterGeneric::SyncWritePattern(bool finalStep)
@@ -43,10 +43,11 @@ public:
     std::unordered_map<std::string, StructDefinition> m_StructDefinitions;
 
 private:
-    MPI_Win m_MpiWin;
+    ssc::RmaWindow m_Window;
     std::thread m_EndStepThread;
     ssc::BlockVecVec m_GlobalWritePattern;
     ssc::BlockVecVec m_GlobalReadPattern;
+    // persistent sends to the readers, started again every fixed step
     std::vector<MPI_Request> m_MpiRequests;
     ssc::RankPosMap m_AllSendingReaderRanks;
 
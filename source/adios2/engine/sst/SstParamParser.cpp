@@ -49,6 +49,16 @@ void SstParamParser::ParseParams(IO &io, struct _SstParams &Params,
         return false;
     };
 
+    auto lf_SetByteUnitsParameter = [&](const std::string key, size_t &parameter) {
+        auto itKey = io.m_Parameters.find(key);
+        if (itKey != io.m_Parameters.end())
+        {
+            parameter = helper::StringToByteUnits(itKey->second, "for Sst parameter " + key);
+            return true;
+        }
+        return false;
+    };
+
     auto lf_SetStringParameter = [&](const std::string key, char *&parameter) {
         auto itKey = io.m_Parameters.find(key);
         if (itKey != io.m_Parameters.end())
@@ -186,10 +196,14 @@ void SstParamParser::ParseParams(IO &io, struct _SstParams &Params,
             {
                 parameter = SstQueueFullBlock;
             }
-            else if (method == "discard")
+            else if (method == "discard" || method == "dropnewest")
             {
                 parameter = SstQueueFullDiscard;
             }
+            else if (method == "dropoldest")
+            {
+                parameter = SstQueueFullDropOldest;
+            }
             else
             {
                 helper::Throw<std::invalid_argument>("Engine", "SstParamParser", "ParseParams",
@@ -143,6 +143,13 @@ public:
      */
     bool IsMPI() const;
 
+    /**
+     * @brief Return true if threads may call into the communication library
+     * concurrently, i.e. MPI provides MPI_THREAD_MULTIPLE. Always true
+     * without MPI.
+     */
+    bool IsThreadMultiple() const;
+
     void Barrier(const std::string &hint = std::string()) const;
 
     /**
@@ -442,6 +449,7 @@ public:
     virtual int Rank() const = 0;
     virtual int Size() const = 0;
     virtual bool IsMPI() const = 0;
+    virtual bool IsThreadMultiple() const = 0;
     virtual void Barrier(const std::string &hint) const = 0;
     virtual void Allgather(const void *sendbuf, size_t sendcount, Datatype sendtype, void *recvbuf,
                            size_t recvcount, Datatype recvtype, const std::string &hint) const = 0;
@@ -145,6 +145,7 @@ public:
     int Rank() const override;
     int Size() const override;
     bool IsMPI() const override;
+    bool IsThreadMultiple() const override;
     void Barrier(const std::string &hint) const override;
 
     void Allgather(const void *sendbuf, size_t sendcount, Datatype sendtype, void *recvbuf,
@@ -272,6 +273,13 @@ int CommImplMPI::Size() const
 
 bool CommImplMPI::IsMPI() const { return true; }
 
+bool CommImplMPI::IsThreadMultiple() const
+{
+    int provided = MPI_THREAD_SINGLE;
+    CheckMPIReturn(MPI_Query_thread(&provided), {});
+    return provided == MPI_THREAD_MULTIPLE;
+}
+
 void CommImplMPI::Barrier(const std::string &hint) const
 {
     CheckMPIReturn(MPI_Barrier(m_MPIComm), hint);
@@ -11,6 +11,8 @@
 #include "adiosMemory.h"
 
 #include <algorithm>
+#include <cstring>
+#include <future>
 #include <stddef.h> // max_align_t
 
 #include "adios2/helper/adiosType.h"
@@ -238,6 +240,328 @@ void ClipColumnMajor(char *dest, const Dims &destStart, const Dims &destCount,
     }
 }
 
+/* NdCopy kernels work on a strided form of the copy: element p of the
+ * overlap goes from In + sum(p[d] * InStride[d]) to Out + sum(p[d] *
+ * OutStride[d]), in bytes. Dimensions of one element are dropped and
+ * dimensions contiguous in both buffers are merged, so the innermost one left
+ * is either a contiguous run, the output side of a transposition, or strided
+ */
+struct StridedCopy
+{
+    const char *In;
+    char *Out;
+    size_t Dims;
+    size_t Count[MAX_DIMS];
+    size_t InStride[MAX_DIMS];
+    size_t OutStride[MAX_DIMS];
+};
+
+// spread over threads only when each gets at least this many bytes
+constexpr size_t StridedCopyBytesPerThread = 4 * 1024 * 1024;
+// edge of the square of elements a transposition copies at a time
+constexpr size_t StridedCopyTile = 32;
+
+inline uint8_t ReverseBytes(const uint8_t v) { return v; }
+inline uint16_t ReverseBytes(const uint16_t v)
+{
+    return static_cast<uint16_t>((v << 8) | (v >> 8));
+}
+inline uint32_t ReverseBytes(const uint32_t v)
+{
+    return ((v & 0x000000ffu) << 24) | ((v & 0x0000ff00u) << 8) | ((v & 0x00ff0000u) >> 8) |
+           ((v & 0xff000000u) >> 24);
+}
+inline uint64_t ReverseBytes(const uint64_t v)
+{
+    return (static_cast<uint64_t>(ReverseBytes(static_cast<uint32_t>(v))) << 32) |
+           ReverseBytes(static_cast<uint32_t>(v >> 32));
+}
+
+/* element of a fixed size, the loops over it are vectorized by the compiler
+ * (the byte reversal becomes bswap or a byte shuffle) */
+template <class T, bool Swap>
+struct TypedElement
+{
+    size_t Size() const { return sizeof(T); }
+    void operator()(char *out, const char *in) const
+    {
+        T v;
+        std::memcpy(&v, in, sizeof(T));
+        if (Swap)
+        {
+            v = ReverseBytes(v);
+        }
+        std::memcpy(out, &v, sizeof(T));
+    }
+    void Run(char *out, const char *in, const size_t n) const
+    {
+        if (!Swap)
+        {
+            std::memcpy(out, in, n * sizeof(T));
+            return;
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            (*this)(out + i * sizeof(T), in + i * sizeof(T));
+        }
+    }
+};
+
+/* element of any other size, reversed as a whole like the original kernels */
+struct AnyElement
+{
+    size_t ElementSize;
+    bool Swap;
+    size_t Size() const { return ElementSize; }
+    void operator()(char *out, const char *in) const
+    {
+        if (!Swap)
+        {
+            std::memcpy(out, in, ElementSize);
+            return;
+        }
+        for (size_t j = 0; j < ElementSize; ++j)
+        {
+            out[j] = in[ElementSize - 1 - j];
+        }
+    }
+    void Run(char *out, const char *in, const size_t n) const
+    {
+        if (!Swap)
+        {
+            std::memcpy(out, in, n * ElementSize);
+            return;
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            (*this)(out + i * ElementSize, in + i * ElementSize);
+        }
+    }
+};
+
+StridedCopy SimplifyStridedCopy(const char *in, char *out, const CoreDims &count,
+                                const CoreDims &inStride, const CoreDims &outStride,
+                                const size_t elmSize)
+{
+    StridedCopy s;
+    s.In = in;
+    s.Out = out;
+    size_t order[MAX_DIMS];
+    size_t n = 0;
+    for (size_t d = 0; d < count.size(); ++d)
+    {
+        if (count[d] > 1)
+        {
+            order[n++] = d;
+        }
+    }
+    // the dimension written with the smallest stride goes innermost
+    std::stable_sort(order, order + n, [&](const size_t a, const size_t b) {
+        return outStride[a] > outStride[b];
+    });
+    s.Dims = 0;
+    for (size_t k = 0; k < n; ++k)
+    {
+        const size_t d = order[k];
+        if (s.Dims > 0)
+        {
+            const size_t prev = s.Dims - 1;
+            if (s.InStride[prev] == count[d] * inStride[d] &&
+                s.OutStride[prev] == count[d] * outStride[d])
+            {
+                s.Count[prev] *= count[d];
+                s.InStride[prev] = inStride[d];
+                s.OutStride[prev] = outStride[d];
+                continue;
+            }
+        }
+        s.Count[s.Dims] = count[d];
+        s.InStride[s.Dims] = inStride[d];
+        s.OutStride[s.Dims] = outStride[d];
+        ++s.Dims;
+    }
+    if (s.Dims == 0)
+    {
+        s.Dims = 1;
+        s.Count[0] = 1;
+        s.InStride[0] = elmSize;
+        s.OutStride[0] = elmSize;
+    }
+    return s;
+}
+
+/* copies na x nb elements where the a side is contiguous in the input and
+ * the b side in the output, in tiles that stay in cache on both sides */
+template <class Element>
+void TransposeTiles(const char *in, char *out, const size_t na, const size_t outStrideA,
+                    const size_t nb, const size_t inStrideB, const Element &element)
+{
+    const size_t elmSize = element.Size();
+    for (size_t a0 = 0; a0 < na; a0 += StridedCopyTile)
+    {
+        const size_t a1 = std::min(na, a0 + StridedCopyTile);
+        for (size_t b0 = 0; b0 < nb; b0 += StridedCopyTile)
+        {
+            const size_t b1 = std::min(nb, b0 + StridedCopyTile);
+            for (size_t a = a0; a < a1; ++a)
+            {
+                char *o = out + a * outStrideA;
+                const char *i = in + a * elmSize;
+                for (size_t b = b0; b < b1; ++b)
+                {
+                    element(o + b * elmSize, i + b * inStrideB);
+                }
+            }
+        }
+    }
+}
+
+template <class Element>
+void StridedCopyKernel(const StridedCopy &s, const Element &element)
+{
+    const size_t elmSize = element.Size();
+    const size_t inner = s.Dims - 1;
+    const bool run = (s.InStride[inner] == elmSize && s.OutStride[inner] == elmSize);
+    size_t transposed = s.Dims;
+    if (!run && s.OutStride[inner] == elmSize)
+    {
+        for (size_t d = 0; d < inner; ++d)
+        {
+            if (s.InStride[d] == elmSize)
+            {
+                transposed = d;
+                break;
+            }
+        }
+    }
+
+    size_t outer[MAX_DIMS];
+    size_t nOuter = 0;
+    for (size_t d = 0; d < inner; ++d)
+    {
+        if (d != transposed)
+        {
+            outer[nOuter++] = d;
+        }
+    }
+    size_t pos[MAX_DIMS] = {0};
+    while (true)
+    {
+        const char *in = s.In;
+        char *out = s.Out;
+        for (size_t k = 0; k < nOuter; ++k)
+        {
+            in += pos[k] * s.InStride[outer[k]];
+            out += pos[k] * s.OutStride[outer[k]];
+        }
+        if (run)
+        {
+            element.Run(out, in, s.Count[inner]);
+        }
+        else if (transposed < s.Dims)
+        {
+            TransposeTiles(in, out, s.Count[transposed], s.OutStride[transposed], s.Count[inner],
+                           s.InStride[inner], element);
+        }
+        else
+        {
+            for (size_t i = 0; i < s.Count[inner]; ++i)
+            {
+                element(out + i * s.OutStride[inner], in + i * s.InStride[inner]);
+            }
+        }
+
+        size_t k = nOuter;
+        while (true)
+        {
+            if (k == 0)
+            {
+                return;
+            }
+            --k;
+            if (++pos[k] < s.Count[outer[k]])
+            {
+                break;
+            }
+            pos[k] = 0;
+        }
+    }
+}
+
+/* splits the largest dimension over up to threads threads */
+template <class Element>
+void StridedCopyThreaded(const StridedCopy &s, const Element &element, const size_t threads)
+{
+    size_t bytes = element.Size();
+    size_t split = 0;
+    for (size_t d = 0; d < s.Dims; ++d)
+    {
+        bytes *= s.Count[d];
+        if (s.Count[d] > s.Count[split])
+        {
+            split = d;
+        }
+    }
+    const size_t nThreads =
+        std::min(std::min(threads, bytes / StridedCopyBytesPerThread), s.Count[split]);
+    if (nThreads <= 1)
+    {
+        StridedCopyKernel(s, element);
+        return;
+    }
+    const size_t per = (s.Count[split] + nThreads - 1) / nThreads;
+    std::vector<std::future<void>> futures;
+    for (size_t begin = per; begin < s.Count[split]; begin += per)
+    {
+        StridedCopy part = s;
+        part.Count[split] = std::min(per, s.Count[split] - begin);
+        part.In += begin * s.InStride[split];
+        part.Out += begin * s.OutStride[split];
+        futures.push_back(std::async(std::launch::async,
+                                     [part, &element]() { StridedCopyKernel(part, element); }));
+    }
+    StridedCopy first = s;
+    first.Count[split] = per;
+    StridedCopyKernel(first, element);
+    for (auto &f : futures)
+    {
+        f.get();
+    }
+}
+
+void StridedNdCopy(const char *in, char *out, const CoreDims &count, const CoreDims &inStride,
+                   const CoreDims &outStride, const size_t elmSize, const bool reverseEndian,
+                   const size_t threads)
+{
+    const StridedCopy s = SimplifyStridedCopy(in, out, count, inStride, outStride, elmSize);
+    switch (elmSize)
+    {
+    case 1:
+        StridedCopyThreaded(s, TypedElement<uint8_t, false>(), threads);
+        break;
+    case 2:
+        if (reverseEndian)
+            StridedCopyThreaded(s, TypedElement<uint16_t, true>(), threads);
+        else
+            StridedCopyThreaded(s, TypedElement<uint16_t, false>(), threads);
+        break;
+    case 4:
+        if (reverseEndian)
+            StridedCopyThreaded(s, TypedElement<uint32_t, true>(), threads);
+        else
+            StridedCopyThreaded(s, TypedElement<uint32_t, false>(), threads);
+        break;
+    case 8:
+        if (reverseEndian)
+            StridedCopyThreaded(s, TypedElement<uint64_t, true>(), threads);
+        else
+            StridedCopyThreaded(s, TypedElement<uint64_t, false>(), threads);
+        break;
+    default:
+        StridedCopyThreaded(s, AnyElement{elmSize, reverseEndian}, threads);
+    }
+}
+
 } // end empty namespace
 
 int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
@@ -245,7 +569,8 @@ int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
            const CoreDims &outStart, const CoreDims &outCount, const bool outIsRowMajor,
            const bool outIsLittleEndian, const int typeSize, const CoreDims &inMemStart,
            const CoreDims &inMemCount, const CoreDims &outMemStart, const CoreDims &outMemCount,
-           const bool safeMode, const MemorySpace MemSpace, const bool duringWrite)
+           const bool safeMode, const MemorySpace MemSpace, const bool duringWrite,
+           const size_t threads)
 
 {
 
@@ -438,7 +763,12 @@ int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
             // most efficient algm
             // warning: number of function stacks used is number of dimensions
             // of data.
-            if (!safeMode)
+            if (!safeMode && threads > 1)
+            {
+                StridedNdCopy(inOvlpBase, outOvlpBase, ovlpCount, inStride, outStride, typeSize,
+                              false, threads);
+            }
+            else if (!safeMode)
             {
                 NdCopyRecurDFSeqPadding(0, inOvlpBase, outOvlpBase, inOvlpGapSize, outOvlpGapSize,
                                         ovlpCount, minContDim, blockSize);
@@ -465,9 +795,8 @@ int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
 #endif
             if (!safeMode)
             {
-                NdCopyRecurDFSeqPaddingRevEndian(0, inOvlpBase, outOvlpBase, inOvlpGapSize,
-                                                 outOvlpGapSize, ovlpCount, minContDim, blockSize,
-                                                 typeSize, blockSize / typeSize);
+                StridedNdCopy(inOvlpBase, outOvlpBase, ovlpCount, inStride, outStride, typeSize,
+                              true, threads);
             }
             else
             {
@@ -586,41 +915,34 @@ int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
 
         inOvlpBase = in;
         outOvlpBase = out;
-        // Same Endian"
-        if (inIsLittleEndian == outIsLittleEndian)
+        if (!safeMode)
         {
-            if (!safeMode)
+            // transposition, byte reversal and runs contiguous on both sides
+            for (size_t i = 0; i < ovlpCount.size(); i++)
             {
-                NdCopyRecurDFNonSeqDynamic(0, inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
-                                           outRltvOvlpStartPos, inStride, outStride, ovlpCount,
-                                           typeSize);
-            }
-            else
-            {
-                NdCopyIterDFDynamic(inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
-                                    outRltvOvlpStartPos, inStride, outStride, ovlpCount, typeSize);
+                inOvlpBase += inRltvOvlpStartPos[i] * inStride[i];
+                outOvlpBase += outRltvOvlpStartPos[i] * outStride[i];
             }
+            StridedNdCopy(inOvlpBase, outOvlpBase, ovlpCount, inStride, outStride, typeSize,
+                          inIsLittleEndian != outIsLittleEndian, threads);
+        }
+        // Same Endian"
+        else if (inIsLittleEndian == outIsLittleEndian)
+        {
+            NdCopyIterDFDynamic(inOvlpBase, outOvlpBase, inRltvOvlpStartPos, outRltvOvlpStartPos,
+                                inStride, outStride, ovlpCount, typeSize);
         }
         // different Endian"
         else
         {
-            if (!safeMode)
-            {
-                NdCopyRecurDFNonSeqDynamicRevEndian(0, inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
-                                                    outRltvOvlpStartPos, inStride, outStride,
-                                                    ovlpCount, typeSize);
-            }
-            else
-            {
-                NdCopyIterDFDynamicRevEndian(inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
-                                             outRltvOvlpStartPos, inStride, outStride, ovlpCount,
-                                             typeSize);
-            }
+            NdCopyIterDFDynamicRevEndian(inOvlpBase, outOvlpBase, inRltvOvlpStartPos,
+                                         outRltvOvlpStartPos, inStride, outStride, ovlpCount,
+                                         typeSize);
         }
     }
     return 0;
 }
-//*************** End of NdCopy() and its 8 helpers ***************
+//*************** End of NdCopy() and its helpers ***************
 
 void CopyPayload(char *dest, const Dims &destStart, const Dims &destCount, const bool destRowMajor,
                  const char *src, const Dims &srcStart, const Dims &srcCount,
@@ -230,6 +230,12 @@ void Resize(std::vector<T> &vec, const size_t dataSize, const std::string hint,
  *                 used by recursive algm is equal to the number of dimensions.
  *                 true: runs a bit slower, same algorithm using the explicit
  *                 stack/simulated stack which has more overhead for the algm.
+ *                 Outside of safeMode, copies that change the major order or
+ *                 the byte order run in kernels that transpose in cache sized
+ *                 tiles, reverse bytes a vector at a time and copy runs
+ *                 contiguous on both sides with memcpy.
+ * @param threads up to this many threads split copies of more than 4MB
+ *                per thread (not in safeMode)
  */
 
 int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
@@ -239,7 +245,7 @@ int NdCopy(const char *in, const CoreDims &inStart, const CoreDims &inCount,
            const CoreDims &inMemStart = CoreDims(), const CoreDims &inMemCount = CoreDims(),
            const CoreDims &outMemStart = CoreDims(), const CoreDims &outMemCount = CoreDims(),
            const bool safeMode = false, const MemorySpace MemSpace = MemorySpace::Host,
-           const bool duringWrite = false);
+           const bool duringWrite = false, const size_t threads = 1);
 
 template <class T>
 size_t PayloadSize(const T *data, const Dims &count) noexcept;
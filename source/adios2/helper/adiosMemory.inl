@@ -636,7 +636,7 @@ void Resize(std::vector<T> &vec, const size_t dataSize, const std::string hint,
     }
 }
 
-//***************Start of NdCopy() and its 8 helpers ***************
+//***************Start of NdCopy() and its helpers ***************
 // Author:Shawn Yang, shawnyang610@gmail.com
 //
 // NdCopyRecurDFSeqPadding(): helper function
@@ -683,103 +683,6 @@ static inline void NdCopyRecurDFSeqPadding(size_t curDim, const char *&inOvlpBas
     }
 }
 
-// NdCopyRecurDFSeqPaddingRevEndian(): helper function
-// Copys n-dimensional Data from input to output in the row major but in
-// reversed endianess. the memory address calculation complexity for copying
-// each element is minimized to average O(1), which is independent of
-// the number of dimensions.
-
-static inline void NdCopyRecurDFSeqPaddingRevEndian(size_t curDim, const char *&inOvlpBase,
-                                                    char *&outOvlpBase, CoreDims &inOvlpGapSize,
-                                                    CoreDims &outOvlpGapSize, CoreDims &ovlpCount,
-                                                    size_t minCountDim, size_t blockSize,
-                                                    size_t elmSize, size_t numElmsPerBlock)
-{
-    if (curDim == minCountDim)
-    {
-        // each byte of each element in the continuous block needs
-        // to be copied in reverse order
-        for (size_t i = 0; i < numElmsPerBlock; i++)
-        {
-            for (size_t j = 0; j < elmSize; j++)
-            {
-                outOvlpBase[j] = inOvlpBase[elmSize - 1 - j];
-            }
-            inOvlpBase += elmSize;
-            outOvlpBase += elmSize;
-        }
-    }
-    // case: curDim<minCountDim
-    else
-    {
-        for (size_t i = 0; i < ovlpCount[curDim]; i++)
-        {
-            NdCopyRecurDFSeqPaddingRevEndian(curDim + 1, inOvlpBase, outOvlpBase, inOvlpGapSize,
-                                             outOvlpGapSize, ovlpCount, minCountDim, blockSize,
-                                             elmSize, numElmsPerBlock);
-        }
-    }
-    inOvlpBase += inOvlpGapSize[curDim];
-    outOvlpBase += outOvlpGapSize[curDim];
-}
-
-// NdCopyRecurDFNonSeqDynamic(): helper function
-// Copys n-dimensional Data from input to output in the same Endianess
-// used for buffer of Column major
-// the memory address calculation complexity for copying each element is
-// minimized to average O(1), which is independent of the number of dimensions.
-static inline void NdCopyRecurDFNonSeqDynamic(size_t curDim, const char *inBase, char *outBase,
-                                              CoreDims &inRltvOvlpSPos, CoreDims &outRltvOvlpSPos,
-                                              CoreDims &inStride, CoreDims &outStride,
-                                              CoreDims &ovlpCount, size_t elmSize)
-{
-    if (curDim == inStride.size())
-    {
-        std::memcpy(outBase, inBase, elmSize);
-    }
-    else
-    {
-        for (size_t i = 0; i < ovlpCount[curDim]; i++)
-        {
-            NdCopyRecurDFNonSeqDynamic(
-                curDim + 1, inBase + (inRltvOvlpSPos[curDim] + i) * inStride[curDim],
-                outBase + (outRltvOvlpSPos[curDim] + i) * outStride[curDim], inRltvOvlpSPos,
-                outRltvOvlpSPos, inStride, outStride, ovlpCount, elmSize);
-        }
-    }
-}
-
-// NdCopyRecurDFNonSeqDynamicRevEndian(): helper function
-// Copies n-dimensional Data from input to output in the reversed Endianess and
-// Major.
-// The memory address calculation complexity for copying each element is
-// minimized to average O(1), which is independent of the number of dimensions.
-
-static inline void NdCopyRecurDFNonSeqDynamicRevEndian(size_t curDim, const char *inBase,
-                                                       char *outBase, CoreDims &inRltvOvlpSPos,
-                                                       CoreDims &outRltvOvlpSPos,
-                                                       CoreDims &inStride, CoreDims &outStride,
-                                                       CoreDims &ovlpCount, size_t elmSize)
-{
-    if (curDim == inStride.size())
-    {
-        for (size_t i = 0; i < elmSize; i++)
-        {
-            outBase[i] = inBase[elmSize - 1 - i];
-        }
-    }
-    else
-    {
-        for (size_t i = 0; i < ovlpCount[curDim]; i++)
-        {
-            NdCopyRecurDFNonSeqDynamicRevEndian(
-                curDim + 1, inBase + (inRltvOvlpSPos[curDim] + i) * inStride[curDim],
-                outBase + (outRltvOvlpSPos[curDim] + i) * outStride[curDim], inRltvOvlpSPos,
-                outRltvOvlpSPos, inStride, outStride, ovlpCount, elmSize);
-        }
-    }
-}
-
 static inline void NdCopyIterDFSeqPadding(const char *&inOvlpBase, char *&outOvlpBase,
                                           CoreDims &inOvlpGapSize, CoreDims &outOvlpGapSize,
                                           CoreDims &ovlpCount, size_t minContDim, size_t blockSize)
@@ -129,6 +129,8 @@ size_t CompressBZIP2::InverseOperate(const char *bufferIn, const size_t sizeIn,
     return 0;
 }
 
+bool CompressBZIP2::IsInverseThreadSafe() const noexcept { return true; }
+
 bool CompressBZIP2::IsDataTypeValid(const DataType type) const { return true; }
 
 size_t CompressBZIP2::DecompressV1(const char *bufferIn, const size_t sizeIn, char *dataOut)
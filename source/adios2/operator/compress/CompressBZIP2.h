@@ -52,6 +52,8 @@ public:
 
     bool IsDataTypeValid(const DataType type) const final;
 
+    bool IsInverseThreadSafe() const noexcept final;
+
 private:
     /**
      * check status from BZip compression and decompression functions
@@ -45,6 +45,8 @@ size_t CompressNull::InverseOperate(const char *bufferIn, const size_t sizeIn, c
     return totalBytes;
 }
 
+bool CompressNull::IsInverseThreadSafe() const noexcept { return true; }
+
 bool CompressNull::IsDataTypeValid(const DataType type) const { return true; }
 
 } // end namespace compress
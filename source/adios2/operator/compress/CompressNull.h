@@ -34,6 +34,8 @@ public:
     size_t InverseOperate(const char *bufferIn, const size_t sizeIn, char *dataOut) final;
 
     bool IsDataTypeValid(const DataType type) const final;
+
+    bool IsInverseThreadSafe() const noexcept final;
 };
 
 } // end namespace compress
@@ -211,6 +211,8 @@ size_t CompressPNG::InverseOperate(const char *bufferIn, const size_t sizeIn, ch
     return 0;
 }
 
+bool CompressPNG::IsInverseThreadSafe() const noexcept { return true; }
+
 bool CompressPNG::IsDataTypeValid(const DataType type) const { return true; }
 
 size_t CompressPNG::DecompressV1(const char *bufferIn, const size_t sizeIn, char *dataOut)
@@ -55,6 +55,8 @@ public:
 
     bool IsDataTypeValid(const DataType type) const final;
 
+    bool IsInverseThreadSafe() const noexcept final;
+
 private:
     /**
      * Decompress function for V1 buffer. Do NOT remove even if the buffer
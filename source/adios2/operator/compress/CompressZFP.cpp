@@ -9,6 +9,8 @@
  */
 #include "CompressZFP.h"
 #include "adios2/helper/adiosFunctions.h"
+#include <algorithm>
+#include <future>
 #include <sstream>
 #include <zfp.h>
 
@@ -140,6 +142,8 @@ size_t CompressZFP::InverseOperate(const char *bufferIn, const size_t sizeIn, ch
     return 0;
 }
 
+bool CompressZFP::IsInverseThreadSafe() const noexcept { return true; }
+
 bool CompressZFP::IsDataTypeValid(const DataType type) const
 {
     if (type == DataType::Float || type == DataType::Double || type == DataType::FloatComplex ||
@@ -187,6 +191,70 @@ size_t CompressZFP::DecompressV1(const char *bufferIn, const size_t sizeIn, char
     field = GetZFPField(dataOut, convertedDims, type);
     stream = GetZFPStream(convertedDims, type, parameters);
 
+    // In fixed-rate mode every block takes maxbits, so slabs of whole blocks
+    // along the slowest dimension (the last one for zfp) decode independently
+    size_t threads = 1;
+    auto itThreads = m_Parameters.find("nthreads");
+    if (itThreads != m_Parameters.end() && parameters.count("rate") > 0 &&
+        zfp_stream_execution(stream) == zfp_exec_serial)
+    {
+        threads = helper::StringTo<size_t>(itThreads->second,
+                                           "when setting ZFP nthreads parameter\n");
+    }
+    const size_t last = convertedDims.size() - 1;
+    const size_t slabBlocks = (convertedDims[last] + 3) / 4;
+    threads = std::min(threads, slabBlocks);
+    if (threads > 1)
+    {
+        size_t layerElements = 1;
+        size_t layerBlocks = 1;
+        for (size_t i = 0; i < last; ++i)
+        {
+            layerElements *= convertedDims[i];
+            layerBlocks *= (convertedDims[i] + 3) / 4;
+        }
+        const size_t elementSize = zfp_type_size(GetZfpType(type));
+        const uint64_t blockBits = stream->maxbits;
+        zfp_field_free(field);
+        zfp_stream_close(stream);
+
+        auto lf_Slab = [&](const size_t b0, const size_t b1) -> size_t {
+            Dims slabDims = convertedDims;
+            slabDims[last] = std::min(4 * b1, convertedDims[last]) - 4 * b0;
+            zfp_field *slabField =
+                GetZFPField(dataOut + 4 * b0 * layerElements * elementSize, slabDims, type);
+            zfp_stream *slabStream = GetZFPStream(convertedDims, type, parameters);
+            bitstream *slabBitstream =
+                stream_open(const_cast<char *>(bufferIn + bufferInOffset), sizeIn - bufferInOffset);
+            zfp_stream_set_bit_stream(slabStream, slabBitstream);
+            zfp_stream_rewind(slabStream);
+            stream_rseek(slabBitstream, b0 * layerBlocks * blockBits);
+            const size_t slabStatus = zfp_decompress(slabStream, slabField);
+            zfp_field_free(slabField);
+            zfp_stream_close(slabStream);
+            stream_close(slabBitstream);
+            return slabStatus;
+        };
+
+        std::vector<std::future<size_t>> futures;
+        for (size_t t = 1; t < threads; ++t)
+        {
+            futures.push_back(std::async(std::launch::async, lf_Slab, t * slabBlocks / threads,
+                                         (t + 1) * slabBlocks / threads));
+        }
+        size_t status = lf_Slab(0, slabBlocks / threads);
+        for (auto &f : futures)
+        {
+            status = f.get() ? status : 0;
+        }
+        if (!status)
+        {
+            helper::Throw<std::runtime_error>("Operator", "CompressZFP", "DecompressV1",
+                                              "zfp failed to decompress a slab of the block");
+        }
+        return helper::GetTotalSize(convertedDims, helper::GetDataTypeSize(type));
+    }
+
     // associate bitstream
     bitstream *bitstream =
         stream_open(const_cast<char *>(bufferIn + bufferInOffset), sizeIn - bufferInOffset);
@@ -11,7 +11,9 @@
 #include "RefactorMDR.h"
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/operator/compress/CompressNull.h"
+#include <algorithm>
 #include <assert.h>
+#include <cmath>
 #include <cstring>
 
 #include <stdio.h>
@@ -167,6 +169,7 @@ size_t RefactorMDR::Operate(const char *dataIn, const Dims &blockStart, const Di
 
     // input under this size will not be refactored
     const size_t thresholdSize = 100000;
+    m_AccuracyLevels.clear();
 
     size_t sizeIn = helper::GetTotalSize(blockCount, helper::GetDataTypeSize(type));
 
@@ -190,6 +193,11 @@ size_t RefactorMDR::Operate(const char *dataIn, const Dims &blockStart, const Di
     size_t nbytes = SerializeRefactoredData(refactored_metadata, refactored_data,
                                             bufferOut + bufferOutOffset, SIZE_MAX);
 
+    if (HasAccuracyLevels())
+    {
+        ComputeAccuracyLevels(dataIn, sizeIn, mgardType, bufferOut + bufferOutOffset,
+                              bufferOutOffset);
+    }
     bufferOutOffset += nbytes;
 
     return bufferOutOffset;
@@ -251,30 +259,29 @@ size_t RefactorMDR::SerializeRefactoredData(mgard_x::MDR::RefactoredMetadata &re
     offset += tableSize * sizeof(uint64_t);
     MDRHeaderSize = offset;
 
-    /* Individual components of refactored data */
+    /* Individual components of refactored data, ordered by bitplane first so that
+       any accuracy needs only a prefix of the components (see ComputeAccuracyLevels) */
     size_t nBlocks = 0;
-    uint64_t tableIdx = 0;
-    for (size_t subdomain_id = 0; subdomain_id < refactored_metadata.metadata.size();
-         subdomain_id++)
+    for (size_t bitplane_idx = 0; bitplane_idx < nBitPlanes; bitplane_idx++)
     {
-        for (size_t level_idx = 0;
-             level_idx < refactored_metadata.metadata[subdomain_id].level_sizes.size(); level_idx++)
+        for (size_t subdomain_id = 0; subdomain_id < refactored_metadata.metadata.size();
+             subdomain_id++)
         {
-            tableIdx = subdomain_id * nLevels * nBitPlanes + level_idx * nBitPlanes;
-            for (size_t bitplane_idx = 0;
-                 bitplane_idx <
-                 refactored_metadata.metadata[subdomain_id].level_sizes[level_idx].size();
-                 bitplane_idx++)
+            const auto &level_sizes = refactored_metadata.metadata[subdomain_id].level_sizes;
+            for (size_t level_idx = 0; level_idx < level_sizes.size(); level_idx++)
             {
+                if (bitplane_idx >= level_sizes[level_idx].size())
+                {
+                    continue;
+                }
+                const uint64_t tableIdx =
+                    subdomain_id * nLevels * nBitPlanes + level_idx * nBitPlanes + bitplane_idx;
                 std::memcpy(buffer + offset,
                             refactored_data.data[subdomain_id][level_idx][bitplane_idx],
-                            refactored_metadata.metadata[subdomain_id]
-                                .level_sizes[level_idx][bitplane_idx]);
+                            level_sizes[level_idx][bitplane_idx]);
                 table[tableIdx] = offset - MDRHeaderSize;
-                offset +=
-                    refactored_metadata.metadata[subdomain_id].level_sizes[level_idx][bitplane_idx];
+                offset += level_sizes[level_idx][bitplane_idx];
                 ++nBlocks;
-                ++tableIdx;
             }
         }
     }
@@ -285,8 +292,127 @@ size_t RefactorMDR::SerializeRefactoredData(mgard_x::MDR::RefactoredMetadata &re
     return offset;
 }
 
+template <class T>
+static double DataRange(const T *values, const size_t n)
+{
+    if (!n)
+    {
+        return 0.0;
+    }
+    auto mm = std::minmax_element(values, values + n);
+    return static_cast<double>(*mm.second) - static_cast<double>(*mm.first);
+}
+
+void RefactorMDR::ComputeAccuracyLevels(const char *dataIn, const size_t sizeIn,
+                                        const mgard_x::data_type mgardType,
+                                        const char *mdrBuffer, const size_t mdrOffset)
+{
+    int maxExponent;
+    double range;
+    if (mgardType == mgard_x::data_type::Float)
+    {
+        range = DataRange(reinterpret_cast<const float *>(dataIn), sizeIn / sizeof(float));
+        maxExponent = 7;
+    }
+    else
+    {
+        range = DataRange(reinterpret_cast<const double *>(dataIn), sizeIn / sizeof(double));
+        maxExponent = 15;
+    }
+    if (!(range > 0.0))
+    {
+        return;
+    }
+
+    /* parse the buffer the same way ReconstructV1 does */
+    size_t offset = 0;
+    const uint64_t metadata_header_size = GetParameter<uint64_t>(mdrBuffer, offset);
+    std::vector<mgard_x::Byte> header(metadata_header_size);
+    std::memcpy(header.data(), mdrBuffer + offset, metadata_header_size);
+    offset += metadata_header_size;
+    const uint64_t metadata_size = GetParameter<uint64_t>(mdrBuffer, offset);
+    std::vector<mgard_x::Byte> serialized_metadata(metadata_size);
+    std::memcpy(serialized_metadata.data(), mdrBuffer + offset, metadata_size);
+    offset += metadata_size;
+    const uint8_t nSubdomains = GetParameter<uint8_t>(mdrBuffer, offset);
+    const uint8_t nLevels = GetParameter<uint8_t>(mdrBuffer, offset);
+    const uint8_t nBitPlanes = GetParameter<uint8_t>(mdrBuffer, offset);
+    const uint64_t *table = (const uint64_t *)(mdrBuffer + offset);
+    offset += nSubdomains * nLevels * nBitPlanes * sizeof(uint64_t);
+    const size_t componentsStart = mdrOffset + offset;
+
+    size_t fullLength = 0;
+    for (int exponent = 1; exponent <= maxExponent; ++exponent)
+    {
+        const double tolerance = range * std::pow(10.0, -exponent);
+        mgard_x::MDR::RefactoredMetadata request;
+        request.header = header;
+        request.Deserialize(serialized_metadata);
+        request.InitializeForReconstruction();
+        for (auto &metadata : request.metadata)
+        {
+            metadata.requested_tol = tolerance;
+            metadata.requested_s = adios2::Linf_norm;
+        }
+        mgard_x::MDR::MDRequest(request, config);
+
+        size_t length = 0;
+        bool complete = true;
+        for (size_t subdomain_id = 0; subdomain_id < request.metadata.size(); subdomain_id++)
+        {
+            const auto &metadata = request.metadata[subdomain_id];
+            for (size_t level_idx = 0; level_idx < metadata.level_sizes.size(); level_idx++)
+            {
+                const size_t requested = metadata.requested_level_num_bitplanes[level_idx];
+                complete = complete && (requested == metadata.level_sizes[level_idx].size());
+                for (size_t bitplane_idx = 0; bitplane_idx < requested; bitplane_idx++)
+                {
+                    const uint64_t tableIdx =
+                        subdomain_id * nLevels * nBitPlanes + level_idx * nBitPlanes + bitplane_idx;
+                    length = std::max(length, static_cast<size_t>(
+                                                  table[tableIdx] +
+                                                  metadata.level_sizes[level_idx][bitplane_idx]));
+                }
+            }
+        }
+        length += componentsStart;
+        if (!m_AccuracyLevels.empty() && length == m_AccuracyLevels.back().second)
+        {
+            // the same prefix is also good for the tighter bound
+            m_AccuracyLevels.back().first = tolerance;
+        }
+        else
+        {
+            m_AccuracyLevels.emplace_back(tolerance, length);
+        }
+        if (complete)
+        {
+            fullLength = length;
+            break;
+        }
+    }
+    if (fullLength && m_AccuracyLevels.size() == 1)
+    {
+        // even the coarsest bound needs everything, nothing to gain
+        m_AccuracyLevels.clear();
+    }
+}
+
 size_t RefactorMDR::GetHeaderSize() const { return headerSize; }
 
+bool RefactorMDR::HasAccuracyLevels() const
+{
+    // planning the ladder of requests costs some time on every Operate
+    bool accuracyLevels = false;
+    helper::GetParameter(m_Parameters, "accuracy_levels", accuracyLevels);
+    return accuracyLevels;
+}
+
+std::vector<std::pair<double, size_t>> RefactorMDR::GetAccuracyLevels() const
+{
+    return m_AccuracyLevels;
+}
+
 size_t RefactorMDR::ReconstructV1(const char *bufferIn, const size_t sizeIn, char *dataOut)
 {
     // Do NOT remove even if the buffer version is updated. Data might be still
@@ -399,6 +525,13 @@ size_t RefactorMDR::ReconstructV1(const char *bufferIn, const size_t sizeIn, cha
 
                     uint64_t componentSize = refactored_metadata.metadata[subdomain_id]
                                                  .level_sizes[level_idx][bitplane_idx];
+                    if (componentData + table[tableIdx] + componentSize > bufferIn + sizeIn)
+                    {
+                        // the reader fetched a prefix made for a looser accuracy
+                        helper::Throw<std::runtime_error>(
+                            "Operator", "RefactorMDR", "ReconstructV1",
+                            "buffer is too short for the requested accuracy");
+                    }
                     const mgard_x::Byte *cdata =
                         reinterpret_cast<const mgard_x::Byte *>(componentData + table[tableIdx]);
 
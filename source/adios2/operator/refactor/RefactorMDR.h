@@ -54,6 +54,12 @@ public:
 
     size_t GetHeaderSize() const;
 
+    /** true if the parameter accuracy_levels is set, only then Operate
+     * runs ComputeAccuracyLevels */
+    bool HasAccuracyLevels() const final;
+
+    std::vector<std::pair<double, size_t>> GetAccuracyLevels() const final;
+
     size_t GetEstimatedSize(const size_t ElemCount, const size_t ElemSize, const size_t ndims,
                             const size_t *dims) const;
 
@@ -72,9 +78,21 @@ private:
     size_t SerializeRefactoredData(mgard_x::MDR::RefactoredMetadata &refactored_metadata,
                                    mgard_x::MDR::RefactoredData &refactored_data, char *buffer,
                                    size_t maxsize);
+    /**
+     * Find the prefix of the serialized components that MDRequest needs for a
+     * ladder of error bounds, relative to the value range of the input
+     * @param mdrBuffer : output of SerializeRefactoredData
+     * @param mdrOffset : position of mdrBuffer in the operator output
+     */
+    void ComputeAccuracyLevels(const char *dataIn, const size_t sizeIn,
+                               const mgard_x::data_type mgardType, const char *mdrBuffer,
+                               const size_t mdrOffset);
 
     std::string m_VersionInfo;
 
+    /** (Linf error, output prefix length) of the last Operate */
+    std::vector<std::pair<double, size_t>> m_AccuracyLevels;
+
     mgard_x::Config config;
 };
 
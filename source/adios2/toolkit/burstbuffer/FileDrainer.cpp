@@ -11,6 +11,8 @@
 #include "FileDrainer.h"
 #include "adios2/helper/adiosLog.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <cstring> // std::memcpy
@@ -20,6 +22,15 @@
 #include <ios> //std::ios_base::failure
 /// \endcond
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ADIOS2_DRAINER_KERNEL_COPY
+#endif
+
 namespace adios2
 {
 namespace burstbuffer
@@ -38,10 +49,31 @@ FileDrainOperation::FileDrainOperation(DrainOperation op, const std::string &fro
     };
 }
 
+DrainBandwidthLimit::DrainBandwidthLimit(size_t bytesPerSecond)
+: m_SecondsPerByte(1.0 / static_cast<double>(bytesPerSecond)),
+  m_Next(std::chrono::steady_clock::now())
+{
+}
+
+void DrainBandwidthLimit::Acquire(size_t count)
+{
+    std::chrono::steady_clock::time_point start;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        const auto now = std::chrono::steady_clock::now();
+        // no credit for idle time, an idle drainer does not earn a burst
+        start = std::max(now, m_Next);
+        m_Next = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                             std::chrono::duration<double>(m_SecondsPerByte * count));
+    }
+    std::this_thread::sleep_until(start);
+}
+
 void FileDrainer::AddOperation(FileDrainOperation &operation)
 {
     std::lock_guard<std::mutex> lockGuard(operationsMutex);
     operations.push(operation);
+    ++m_OperationsAdded;
 }
 
 void FileDrainer::AddOperation(DrainOperation op, const std::string &fromFileName,
@@ -50,8 +82,59 @@ void FileDrainer::AddOperation(DrainOperation op, const std::string &fromFileNam
 {
     FileDrainOperation operation(op, fromFileName, toFileName, countBytes, fromOffset, toOffset,
                                  data);
+    AddOperation(operation);
+}
+
+size_t FileDrainer::OperationsAdded()
+{
     std::lock_guard<std::mutex> lockGuard(operationsMutex);
-    operations.push(operation);
+    return m_OperationsAdded;
+}
+
+void FileDrainer::WaitForCompleted(size_t count)
+{
+    std::unique_lock<std::mutex> lock(m_CompletedMutex);
+    m_Completed.wait(lock, [&] { return m_OperationsCompleted >= count; });
+}
+
+void FileDrainer::OperationCompleted()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_CompletedMutex);
+        ++m_OperationsCompleted;
+    }
+    m_Completed.notify_all();
+}
+
+void FileDrainer::SetBandwidthLimit(size_t bytesPerSecond)
+{
+    if (bytesPerSecond > 0)
+    {
+        m_BandwidthLimit = std::make_shared<DrainBandwidthLimit>(bytesPerSecond);
+    }
+    else
+    {
+        m_BandwidthLimit.reset();
+    }
+}
+
+void FileDrainer::SetBandwidthLimit(std::shared_ptr<DrainBandwidthLimit> limit)
+{
+    m_BandwidthLimit = limit;
+}
+
+void FileDrainer::SetKernelCopy(bool copyFileRange, bool sendfile)
+{
+    m_UseCopyFileRange = copyFileRange;
+    m_UseSendfile = sendfile;
+}
+
+void FileDrainer::Throttle(size_t count)
+{
+    if (m_BandwidthLimit)
+    {
+        m_BandwidthLimit->Acquire(count);
+    }
 }
 
 void FileDrainer::AddOperationSeekEnd(const std::string &toFileName)
@@ -137,6 +220,10 @@ OutputFile FileDrainer::GetFileForWrite(const std::string &path, bool append)
         OutputFile f = std::make_shared<std::ofstream>();
         m_OutputFileMap.emplace(path, f);
         Open(f, path, append);
+        if (append)
+        {
+            m_AppendOutputs.insert(path);
+        }
         return f;
     }
 }
@@ -187,6 +274,19 @@ void FileDrainer::CloseAll()
         //}
     }
     m_InputFileMap.clear();
+    m_AppendOutputs.clear();
+#ifdef ADIOS2_DRAINER_KERNEL_COPY
+    for (auto &fd : m_RawOutputFDs)
+    {
+        close(fd.second);
+    }
+    for (auto &fd : m_RawInputFDs)
+    {
+        close(fd.second);
+    }
+#endif
+    m_RawOutputFDs.clear();
+    m_RawInputFDs.clear();
 }
 
 void FileDrainer::Seek(InputFile &f, size_t offset, const std::string &path)
@@ -264,9 +364,158 @@ size_t FileDrainer::Write(OutputFile &f, size_t count, const char *buffer, const
 void FileDrainer::Delete(OutputFile &f, const std::string &path)
 {
     Close(f);
+    CloseRawFD(path);
     std::remove(path.c_str());
 }
 
+int FileDrainer::GetRawFD(const std::string &path, bool forWrite)
+{
+#ifdef ADIOS2_DRAINER_KERNEL_COPY
+    auto &fdMap = (forWrite ? m_RawOutputFDs : m_RawInputFDs);
+    auto it = fdMap.find(path);
+    if (it != fdMap.end())
+    {
+        return it->second;
+    }
+    // the stream has created the file already, never open with O_APPEND,
+    // copy_file_range rejects it
+    const int fd = open(path.c_str(), forWrite ? O_WRONLY : O_RDONLY);
+    if (fd >= 0)
+    {
+        fdMap.emplace(path, fd);
+    }
+    return fd;
+#else
+    return -1;
+#endif
+}
+
+void FileDrainer::CloseRawFD(const std::string &path)
+{
+#ifdef ADIOS2_DRAINER_KERNEL_COPY
+    for (auto *fdMap : {&m_RawOutputFDs, &m_RawInputFDs})
+    {
+        auto it = fdMap->find(path);
+        if (it != fdMap->end())
+        {
+            close(it->second);
+            fdMap->erase(it);
+        }
+    }
+#endif
+}
+
+size_t FileDrainer::KernelCopy(InputFile &fr, OutputFile &fw, size_t count,
+                               const std::string &fromPath, const std::string &toPath,
+                               size_t chunkSize, double &slept)
+{
+#ifdef ADIOS2_DRAINER_KERNEL_COPY
+    if (!m_UseCopyFileRange && !m_UseSendfile)
+    {
+        return 0;
+    }
+    const int fdin = GetRawFD(fromPath, false);
+    const int fdout = GetRawFD(toPath, true);
+    const auto inPos = fr->tellg();
+    if (fdin < 0 || fdout < 0 || inPos < 0)
+    {
+        return 0;
+    }
+    fw->flush();
+    const bool append = (m_AppendOutputs.count(toPath) > 0);
+    off_t inOffset = static_cast<off_t>(inPos);
+    off_t outOffset;
+    if (append)
+    {
+        struct stat st;
+        if (fstat(fdout, &st) != 0)
+        {
+            return 0;
+        }
+        outOffset = st.st_size;
+    }
+    else
+    {
+        const auto outPos = fw->tellp();
+        if (outPos < 0)
+        {
+            return 0;
+        }
+        outOffset = static_cast<off_t>(outPos);
+    }
+
+    const double sleepUnit = 0.01; // seconds
+    size_t copied = 0;
+    while (copied < count && (m_UseCopyFileRange || m_UseSendfile))
+    {
+        const size_t n = std::min(chunkSize, count - copied);
+        ssize_t r = -1;
+        if (m_UseCopyFileRange)
+        {
+#ifdef SYS_copy_file_range
+            loff_t in = inOffset, out = outOffset;
+            r = syscall(SYS_copy_file_range, fdin, &in, fdout, &out, n, 0);
+#else
+            errno = ENOSYS;
+#endif
+            if (r < 0 && errno != EINTR)
+            {
+                // e.g. older kernel, cross-filesystem copy on < 5.3
+                m_UseCopyFileRange = false;
+                continue;
+            }
+        }
+        else
+        {
+            off_t in = inOffset;
+            if (lseek(fdout, outOffset, SEEK_SET) == outOffset)
+            {
+                r = sendfile(fdout, fdin, &in, n);
+            }
+            if (r < 0 && errno != EINTR)
+            {
+                m_UseSendfile = false;
+                continue;
+            }
+        }
+        if (r < 0)
+        {
+            continue; // EINTR
+        }
+        if (r == 0)
+        {
+            // the data is not yet written to the source file
+            std::this_thread::sleep_for(std::chrono::duration<double>(sleepUnit));
+            slept += sleepUnit;
+            continue;
+        }
+        inOffset += r;
+        outOffset += r;
+        copied += static_cast<size_t>(r);
+        Throttle(static_cast<size_t>(r));
+    }
+
+    if (copied > 0)
+    {
+        fr->seekg(static_cast<std::streamoff>(inOffset), std::ios_base::beg);
+        if (!append)
+        {
+            fw->seekp(static_cast<std::streamoff>(outOffset), std::ios_base::beg);
+        }
+    }
+    return copied;
+#else
+    (void)fr;
+    (void)fw;
+    (void)count;
+    (void)fromPath;
+    (void)toPath;
+    (void)chunkSize;
+    (void)slept;
+    return 0;
+#endif
+}
+
 void FileDrainer::SetVerbose(int verboseLevel, int rank)
 {
     m_Verbose = verboseLevel;
@@ -11,6 +11,8 @@
 #ifndef ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINER_H_
 #define ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINER_H_
 
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <locale>
@@ -18,8 +20,10 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <streambuf>
 #include <string>
+#include <vector>
 
 #include "adios2/common/ADIOSTypes.h"
 
@@ -43,6 +47,8 @@ enum class DrainOperation
     Delete   // Remove a file on disk (file will be opened if not already opened)
 };
 
+class FileDrainer;
+
 struct FileDrainOperation
 {
     DrainOperation op;
@@ -52,12 +58,32 @@ struct FileDrainOperation
     size_t fromOffset;
     size_t toOffset;
     std::vector<char> dataToWrite; // memory to write with Write operation
+    /** other drainers and how many of their operations must have completed
+     * before this one may start (ordering across parallel drain streams) */
+    std::vector<std::pair<FileDrainer *, size_t>> waitFor;
 
     FileDrainOperation(DrainOperation op, const std::string &fromFileName,
                        const std::string &toFileName, size_t countBytes, size_t fromOffset,
                        size_t toOffset, const void *data);
 };
 
+/** Paces the drain traffic of one or more drainers to a bandwidth limit, so
+ * that draining does not compete with the application writing the next
+ * output step to the burst buffer */
+class DrainBandwidthLimit
+{
+public:
+    explicit DrainBandwidthLimit(size_t bytesPerSecond);
+
+    /** Blocks until count bytes may be moved */
+    void Acquire(size_t count);
+
+private:
+    const double m_SecondsPerByte;
+    std::mutex m_Mutex;
+    std::chrono::steady_clock::time_point m_Next;
+};
+
 typedef std::map<std::string, std::shared_ptr<std::ifstream>> InputFileMap;
 typedef std::map<std::string, std::shared_ptr<std::ofstream>> OutputFileMap;
 typedef std::shared_ptr<std::ifstream> InputFile;
@@ -70,7 +96,7 @@ public:
 
     virtual ~FileDrainer() = default;
 
-    void AddOperation(FileDrainOperation &operation);
+    virtual void AddOperation(FileDrainOperation &operation);
     void AddOperation(DrainOperation op, const std::string &fromFileName,
                       const std::string &toFileName, size_t fromOffset, size_t toOffset,
                       size_t countBytes, const void *data = nullptr);
@@ -98,11 +124,33 @@ public:
 
     /** turn on verbosity. set rank to differentiate between the output of
      * processes */
-    void SetVerbose(int verboseLevel, int rank);
+    virtual void SetVerbose(int verboseLevel, int rank);
+
+    /** Limit drain traffic to bytesPerSecond, 0 means unlimited */
+    virtual void SetBandwidthLimit(size_t bytesPerSecond);
+    /** Share one limit among several drainers */
+    void SetBandwidthLimit(std::shared_ptr<DrainBandwidthLimit> limit);
+
+    /** Allow copies inside the kernel with copy_file_range and/or sendfile.
+     * Both are on by default, a copy falls back to sendfile and then to
+     * read/write through memory if the kernel refuses */
+    virtual void SetKernelCopy(bool copyFileRange, bool sendfile);
+
+    /** Number of operations added so far */
+    size_t OperationsAdded();
+
+    /** Block until at least count operations have been completed */
+    void WaitForCompleted(size_t count);
 
 protected:
     std::queue<FileDrainOperation> operations;
     std::mutex operationsMutex;
+    size_t m_OperationsAdded = 0;
+
+    /** Count one finished operation and wake up WaitForCompleted */
+    void OperationCompleted();
+
+    std::shared_ptr<DrainBandwidthLimit> m_BandwidthLimit;
 
     /** rank of process just for stdout/stderr messages */
     int m_Rank = 0;
@@ -134,9 +182,36 @@ protected:
 
     void Delete(OutputFile &f, const std::string &path);
 
+    /** Wait for the bandwidth limit, if any, before moving count bytes */
+    void Throttle(size_t count);
+
+    /**
+     * Copy count bytes from the current read position of fromPath to the
+     * current write position of toPath inside the kernel, using
+     * copy_file_range or sendfile, in chunkSize pieces. Both streams are
+     * advanced past the copied range.
+     * @return the number of bytes copied, less than count if kernel copies
+     * are not supported (the caller must copy the rest through memory)
+     */
+    size_t KernelCopy(InputFile &fr, OutputFile &fw, size_t count, const std::string &fromPath,
+                      const std::string &toPath, size_t chunkSize, double &slept);
+
 private:
+    size_t m_OperationsCompleted = 0;
+    std::mutex m_CompletedMutex;
+    std::condition_variable m_Completed;
+
     InputFileMap m_InputFileMap;
     OutputFileMap m_OutputFileMap;
+    /** output files opened in append mode, writes always go to the end */
+    std::set<std::string> m_AppendOutputs;
+    /** raw descriptors for kernel copies, next to the streams */
+    std::map<std::string, int> m_RawInputFDs;
+    std::map<std::string, int> m_RawOutputFDs;
+    bool m_UseCopyFileRange = true;
+    bool m_UseSendfile = true;
+    int GetRawFD(const std::string &path, bool forWrite);
+    void CloseRawFD(const std::string &path);
     void Open(InputFile &f, const std::string &path);
     void Close(InputFile &f);
     void Open(OutputFile &f, const std::string &path, bool append);
@@ -0,0 +1,135 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.cpp
+ */
+
+#include "FileDrainerMultiThread.h"
+
+#include <functional>
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+FileDrainerMultiThread::FileDrainerMultiThread() : FileDrainer() { SetThreads(1); }
+
+FileDrainerMultiThread::~FileDrainerMultiThread() { Join(); }
+
+void FileDrainerMultiThread::SetThreads(size_t nThreads)
+{
+    if (nThreads < 1)
+    {
+        nThreads = 1;
+    }
+    m_Streams.clear();
+    for (size_t i = 0; i < nThreads; ++i)
+    {
+        m_Streams.emplace_back(new FileDrainerSingleThread());
+        m_Streams.back()->SetBufferSize(m_BufferSize);
+        m_Streams.back()->SetVerbose(m_Verbose, m_Rank);
+        m_Streams.back()->SetBandwidthLimit(m_BandwidthLimit);
+        m_Streams.back()->SetKernelCopy(m_CopyFileRange, m_Sendfile);
+    }
+}
+
+void FileDrainerMultiThread::SetBufferSize(size_t bufferSizeBytes)
+{
+    m_BufferSize = bufferSizeBytes;
+    for (auto &s : m_Streams)
+    {
+        s->SetBufferSize(bufferSizeBytes);
+    }
+}
+
+void FileDrainerMultiThread::SetVerbose(int verboseLevel, int rank)
+{
+    FileDrainer::SetVerbose(verboseLevel, rank);
+    for (auto &s : m_Streams)
+    {
+        s->SetVerbose(verboseLevel, rank);
+    }
+}
+
+void FileDrainerMultiThread::SetBandwidthLimit(size_t bytesPerSecond)
+{
+    // one limit for the sum of all streams
+    FileDrainer::SetBandwidthLimit(bytesPerSecond);
+    for (auto &s : m_Streams)
+    {
+        s->SetBandwidthLimit(m_BandwidthLimit);
+    }
+}
+
+void FileDrainerMultiThread::SetKernelCopy(bool copyFileRange, bool sendfile)
+{
+    m_CopyFileRange = copyFileRange;
+    m_Sendfile = sendfile;
+    for (auto &s : m_Streams)
+    {
+        s->SetKernelCopy(copyFileRange, sendfile);
+    }
+}
+
+size_t FileDrainerMultiThread::StreamIndex(const std::string &toFileName) const noexcept
+{
+    return std::hash<std::string>()(toFileName) % m_Streams.size();
+}
+
+void FileDrainerMultiThread::AddOperation(FileDrainOperation &operation)
+{
+    std::lock_guard<std::mutex> lockGuard(operationsMutex);
+    const size_t idx = StreamIndex(operation.toFileName);
+    if (m_Streams.size() > 1)
+    {
+        switch (operation.op)
+        {
+        case DrainOperation::WriteAt:
+        case DrainOperation::Write:
+        case DrainOperation::SeekEnd:
+        case DrainOperation::Delete:
+            for (size_t i = 0; i < m_Streams.size(); ++i)
+            {
+                if (i != idx)
+                {
+                    FileDrainer *other = m_Streams[i].get();
+                    operation.waitFor.emplace_back(other, other->OperationsAdded());
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    m_Streams[idx]->AddOperation(operation);
+    ++m_OperationsAdded;
+}
+
+void FileDrainerMultiThread::Start()
+{
+    for (auto &s : m_Streams)
+    {
+        s->Start();
+    }
+}
+
+void FileDrainerMultiThread::Finish()
+{
+    for (auto &s : m_Streams)
+    {
+        s->Finish();
+    }
+}
+
+void FileDrainerMultiThread::Join()
+{
+    for (auto &s : m_Streams)
+    {
+        s->Join();
+    }
+}
+
+} // end namespace burstbuffer
+} // end namespace adios2
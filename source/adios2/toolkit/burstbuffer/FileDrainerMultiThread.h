@@ -0,0 +1,67 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileDrainerMultiThread.h
+ */
+
+#ifndef ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+#define ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_
+
+#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
+
+#include <memory>
+#include <vector>
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+/**
+ * Drains with several FileDrainerSingleThread streams in parallel. All
+ * operations on one target file go to the same stream, so they keep their
+ * order. Operations writing from memory (e.g. the metadata index) and
+ * deletes wait until everything added before them has been drained by all
+ * streams, so the target never has an index pointing to data not yet there.
+ */
+class FileDrainerMultiThread : public FileDrainer
+{
+
+public:
+    FileDrainerMultiThread();
+
+    ~FileDrainerMultiThread();
+
+    /** Number of parallel streams, call before Start(). Default is 1 */
+    void SetThreads(size_t nThreads);
+
+    void SetBufferSize(size_t bufferSizeBytes);
+
+    void SetVerbose(int verboseLevel, int rank) final;
+
+    void SetBandwidthLimit(size_t bytesPerSecond) final;
+
+    void SetKernelCopy(bool copyFileRange, bool sendfile) final;
+
+    void AddOperation(FileDrainOperation &operation) final;
+
+    void Start() final;
+
+    void Finish() final;
+
+    void Join() final;
+
+private:
+    std::vector<std::unique_ptr<FileDrainerSingleThread>> m_Streams;
+    size_t m_BufferSize = FileDrainerSingleThread::defaultBufferSize;
+    bool m_CopyFileRange = true;
+    bool m_Sendfile = true;
+
+    size_t StreamIndex(const std::string &toFileName) const noexcept;
+};
+
+} // end namespace burstbuffer
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_BURSTBUFFER_FILEDRAINERMULTITHREAD_H_ */
@@ -11,8 +11,10 @@
 #include "FileDrainerSingleThread.h"
 #include "adios2/helper/adiosLog.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
@@ -89,11 +91,13 @@ void FileDrainerSingleThread::DrainThread()
     core::Seconds timeSleep(0.0);
     core::Seconds timeRead(0.0);
     core::Seconds timeWrite(0.0);
+    core::Seconds timeCopy(0.0);
     core::Seconds timeClose(0.0);
     core::TimePoint ts, te;
     size_t maxQueueSize = 0;
     std::vector<char> buffer; // fixed, preallocated buffer to read/write data
     buffer.resize(bufferSize);
+    std::vector<char> buffer2; // second buffer, allocated for large copies only
 
     size_t nReadBytesTasked = 0;
     size_t nReadBytesSucc = 0;
@@ -101,22 +105,69 @@ void FileDrainerSingleThread::DrainThread()
     size_t nWriteBytesSucc = 0;
     double sleptForWaitingOnRead = 0.0;
 
-    /* Copy a block of data from one file to another at the same offset */
+    /* Copy a block of data from one file to another at the same offset.
+     * The kernel copies as much as it can without bouncing the data through
+     * user space, the rest is copied through two buffers so that reading the
+     * next chunk overlaps with writing the current one. */
     auto lf_Copy = [&](FileDrainOperation &fdo, InputFile fdr, OutputFile fdw, size_t count) {
         nReadBytesTasked += count;
-        ts = core::Now();
-        std::pair<size_t, double> ret = Read(fdr, count, buffer.data(), fdo.fromFileName);
-        te = core::Now();
-        timeRead += te - ts;
-        nReadBytesSucc += ret.first;
-        sleptForWaitingOnRead += ret.second;
-
         nWriteBytesTasked += count;
         ts = core::Now();
-        size_t n = Write(fdw, count, buffer.data(), fdo.toFileName);
+        const size_t nKernel = KernelCopy(fdr, fdw, count, fdo.fromFileName, fdo.toFileName,
+                                          bufferSize, sleptForWaitingOnRead);
         te = core::Now();
-        timeWrite += te - ts;
-        nWriteBytesSucc += n;
+        timeCopy += te - ts;
+        nReadBytesSucc += nKernel;
+        nWriteBytesSucc += nKernel;
+        count -= nKernel;
+        if (!count)
+        {
+            return;
+        }
+
+        auto lf_Read = [&](size_t n, char *buf) -> std::pair<std::pair<size_t, double>, double> {
+            const auto t0 = core::Now();
+            std::pair<size_t, double> ret = Read(fdr, n, buf, fdo.fromFileName);
+            const core::Seconds t = core::Now() - t0;
+            return std::make_pair(ret, t.count());
+        };
+        auto lf_AddRead = [&](const std::pair<std::pair<size_t, double>, double> &ret) {
+            nReadBytesSucc += ret.first.first;
+            sleptForWaitingOnRead += ret.first.second;
+            timeRead += core::Seconds(ret.second);
+        };
+
+        std::vector<char> *buf[2] = {&buffer, &buffer2};
+        int cur = 0;
+        size_t curSize = std::min(bufferSize, count);
+        lf_AddRead(lf_Read(curSize, buf[cur]->data()));
+        count -= curSize;
+        while (curSize)
+        {
+            const size_t nextSize = std::min(bufferSize, count);
+            std::future<std::pair<std::pair<size_t, double>, double>> next;
+            if (nextSize)
+            {
+                if (buffer2.size() < bufferSize)
+                {
+                    buffer2.resize(bufferSize);
+                }
+                next = std::async(std::launch::async, lf_Read, nextSize, buf[1 - cur]->data());
+            }
+            Throttle(curSize);
+            ts = core::Now();
+            size_t n = Write(fdw, curSize, buf[cur]->data(), fdo.toFileName);
+            te = core::Now();
+            timeWrite += te - ts;
+            nWriteBytesSucc += n;
+            if (nextSize)
+            {
+                lf_AddRead(next.get());
+            }
+            count -= nextSize;
+            curSize = nextSize;
+            cur = 1 - cur;
+        }
     };
 
     std::chrono::duration<double> d(0.100);
@@ -149,6 +200,12 @@ void FileDrainerSingleThread::DrainThread()
         }
         operationsMutex.unlock();
 
+        // keep the order with operations given earlier to other drainers
+        for (auto &w : fdo.waitFor)
+        {
+            w.first->WaitForCompleted(w.second);
+        }
+
         switch (fdo.op)
         {
 
@@ -198,16 +255,7 @@ void FileDrainerSingleThread::DrainThread()
                         te = core::Now();
                         timeWrite += te - ts;
                     }
-                    const size_t batches = fdo.countBytes / bufferSize;
-                    const size_t remainder = fdo.countBytes % bufferSize;
-                    for (size_t b = 0; b < batches; ++b)
-                    {
-                        lf_Copy(fdo, fdr, fdw, bufferSize);
-                    }
-                    if (remainder)
-                    {
-                        lf_Copy(fdo, fdr, fdw, remainder);
-                    }
+                    lf_Copy(fdo, fdr, fdw, fdo.countBytes);
                 }
                 catch (std::ios_base::failure &e)
                 {
@@ -317,6 +365,7 @@ void FileDrainerSingleThread::DrainThread()
         operationsMutex.lock();
         operations.pop();
         operationsMutex.unlock();
+        OperationCompleted();
     }
 
     if (m_Verbose > 1)
@@ -341,8 +390,8 @@ void FileDrainerSingleThread::DrainThread()
 #ifndef NO_SANITIZE_THREAD
         std::cout << "Drain " << m_Rank << ": Runtime  total = " << timeTotal.count()
                   << " read = " << timeRead.count() << " write = " << timeWrite.count()
-                  << " close = " << timeClose.count() << " sleep = " << timeSleep.count()
-                  << " seconds"
+                  << " kernel copy = " << timeCopy.count() << " close = " << timeClose.count()
+                  << " sleep = " << timeSleep.count() << " seconds"
                   << ". Max queue size = " << maxQueueSize << ".";
         if (nReadBytesTasked == nReadBytesSucc)
         {
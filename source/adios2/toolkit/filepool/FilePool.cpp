@@ -1,6 +1,16 @@
 #include "adios2/toolkit/filepool/FilePool.h"
 #include "adios2sys/SystemTools.hxx"
 
+#include <chrono>
+
+constexpr size_t FilePool::ShardCount;
+
+namespace
+{
+/* open-ahead requests beyond this many queued names are dropped */
+constexpr size_t MaxOpenAheadQueue = 1024;
+}
+
 PoolableFile::~PoolableFile() { m_OwningPool->Release(m_Entry); }
 
 void PoolableFile::Read(char *buffer, size_t size, size_t start)
@@ -27,16 +37,51 @@ void PoolableFile::SetParameters(const adios2::Params &params)
 
 void PoolableFile::Close() {}
 
+FilePool::~FilePool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_OpenAheadMutex);
+        m_OpenAheadStop = true;
+        m_OpenAheadQueue.clear();
+    }
+    m_OpenAheadCV.notify_all();
+    if (m_OpenAheadThread.joinable())
+    {
+        m_OpenAheadThread.join();
+    }
+}
+
+size_t FilePool::ShardIndex(const std::string &filename) const
+{
+    return std::hash<std::string>()(filename) % ShardCount;
+}
+
+std::string FilePool::ResolveTarInfo(const std::string &filename, const bool skipTarInfo,
+                                     size_t &offset, size_t &size) const
+{
+    if (!skipTarInfo && m_TarInfoMap && m_TarInfoMap->size())
+    {
+        auto FilenameInTar = adios2sys::SystemTools::GetFilenameName(filename);
+        auto it = m_TarInfoMap->find(FilenameInTar);
+        if (it != m_TarInfoMap->end())
+        {
+            offset = std::get<0>(it->second);
+            size = std::get<1>(it->second);
+            return filename.substr(0, filename.length() - FilenameInTar.length() - 1);
+        }
+    }
+    return filename;
+}
+
 void FilePool::Release(PoolEntry *obj)
 {
-    std::lock_guard<std::mutex> lockGuard(PoolMutex);
+    std::lock_guard<std::mutex> lockGuard(m_Shards[obj->m_Shard].Mutex);
     obj->m_InUseCount--;
+    obj->m_LastUse = ++m_Clock;
 }
 
 void FilePool::Evict(const std::string &filename)
 {
-    std::lock_guard<std::mutex> lockGuard(PoolMutex);
-
     /* Resolve TarInfo the same way Acquire() does.  If this filename maps
        into a tar container, the pool entry is the containing file and is
        shared with other files inside the tar — do NOT evict it. */
@@ -51,12 +96,14 @@ void FilePool::Evict(const std::string &filename)
         }
     }
 
-    auto range = m_Pool.equal_range(finalFileName);
+    Shard &shard = m_Shards[ShardIndex(finalFileName)];
+    std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+    auto range = shard.Pool.equal_range(finalFileName);
     for (auto it = range.first; it != range.second;)
     {
-        if (it->second->m_InUseCount == 0)
+        if (it->second->m_Ready && it->second->m_InUseCount == 0)
         {
-            it = m_Pool.erase(it);
+            it = shard.Pool.erase(it);
             m_OpenFileCount--;
         }
         else
@@ -69,83 +116,332 @@ void FilePool::Evict(const std::string &filename)
 std::vector<std::shared_ptr<adios2::Transport>> FilePool::ListOfTransports()
 {
     std::vector<std::shared_ptr<adios2::Transport>> Ret;
-    for (auto it = m_Pool.begin(); it != m_Pool.end(); ++it)
+    for (auto &shard : m_Shards)
     {
-        Ret.push_back(it->second->m_File);
+        std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+        for (auto it = shard.Pool.begin(); it != shard.Pool.end(); ++it)
+        {
+            if (it->second->m_Ready)
+            {
+                Ret.push_back(it->second->m_File);
+            }
+        }
     }
     return Ret;
 }
-std::unique_ptr<PoolableFile> FilePool::Acquire(const std::string &filename, const bool skipTarInfo)
+
+bool FilePool::EvictLRU()
 {
-    std::lock_guard<std::mutex> lockGuard(PoolMutex);
-    // Use a custom deleter to return the object to the pool
+    // the victim is chosen without holding all shard locks, so it may be
+    // taken by another thread in between, retry a few times in that case
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        std::shared_ptr<PoolEntry> candidate;
+        uint64_t candidateUse = 0;
+        for (auto &shard : m_Shards)
+        {
+            std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+            for (auto &it : shard.Pool)
+            {
+                const PoolEntry &entry = *it.second;
+                if (entry.m_Ready && entry.m_InUseCount == 0 &&
+                    (!candidate || entry.m_LastUse < candidateUse))
+                {
+                    candidate = it.second;
+                    candidateUse = entry.m_LastUse;
+                }
+            }
+        }
+        if (!candidate)
+        {
+            return false;
+        }
 
-    auto finalFileName = filename;
-    size_t offset = 0;
-    size_t size = (size_t)-1;
-    if (!skipTarInfo && m_TarInfoMap && m_TarInfoMap->size())
+        // the transport is closed when victim goes out of scope, outside the lock
+        std::shared_ptr<PoolEntry> victim;
+        {
+            Shard &shard = m_Shards[candidate->m_Shard];
+            std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+            for (auto it = shard.Pool.begin(); it != shard.Pool.end(); ++it)
+            {
+                if (it->second == candidate && candidate->m_InUseCount == 0)
+                {
+                    victim = it->second;
+                    shard.Pool.erase(it);
+                    m_OpenFileCount--;
+                    break;
+                }
+            }
+        }
+        if (victim)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FilePool::ReserveSlot(const bool evict)
+{
+    while (true)
     {
-        auto FilenameInTar = adios2sys::SystemTools::GetFilenameName(filename);
-        auto it = m_TarInfoMap->find(FilenameInTar);
-        if (it != m_TarInfoMap->end())
+        size_t count = m_OpenFileCount.load();
+        if (count < m_OpenFileLimit)
         {
-            offset = std::get<0>(it->second);
-            size = std::get<1>(it->second);
-            finalFileName = filename.substr(0, filename.length() - FilenameInTar.length() - 1);
+            if (m_OpenFileCount.compare_exchange_weak(count, count + 1))
+            {
+                size_t max = m_MaxFileCount.load();
+                while (count + 1 > max && !m_MaxFileCount.compare_exchange_weak(max, count + 1))
+                {
+                }
+                return true;
+            }
+            continue;
+        }
+        if (!evict)
+        {
+            return false;
         }
+        if (EvictLRU())
+        {
+            continue;
+        }
+        // open-ahead files being opened hold slots but become evictable once open
+        if (m_OpenAheadPending.load() == 0)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+std::shared_ptr<adios2::Transport> FilePool::OpenTransport(const std::string &filename)
+{
+    adios2::Params params;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ParamsMutex);
+        params = m_TransportParams;
+    }
+    std::shared_ptr<adios2::Transport> file = m_Factory->OpenFileTransport(
+        filename, adios2::Mode::Read, params, false, false, adios2::helper::CommDummy());
+    if (!m_ShareTestDone)
+    {
+        // first time through, we'll always be creating the same transport, so see if we can reuse
+        // it on read
+        m_CanShare = file->m_ReentrantRead;
+        m_ShareTestDone = true;
     }
-    auto range = m_Pool.equal_range(finalFileName);
-    for (auto it = range.first; it != range.second; ++it)
+    return file;
+}
+
+void FilePool::FinishOpen(const std::shared_ptr<PoolEntry> &entry,
+                          std::shared_ptr<adios2::Transport> file)
+{
+    Shard &shard = m_Shards[entry->m_Shard];
     {
-        if ((it->second->m_InUseCount == 0) || m_CanShare)
+        std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+        if (file)
+        {
+            entry->m_File = file;
+            entry->m_Ready = true;
+            entry->m_LastUse = ++m_Clock;
+        }
+        else
         {
-            it->second->m_InUseCount++;
-            return std::make_unique<PoolableFile>(this, it->second.get(), offset, size);
+            entry->m_Failed = true;
+            for (auto it = shard.Pool.begin(); it != shard.Pool.end(); ++it)
+            {
+                if (it->second == entry)
+                {
+                    shard.Pool.erase(it);
+                    break;
+                }
+            }
         }
     }
-    // PoolEntry not found or can't be reused, we need to create, first check limit
-    if (m_OpenFileCount == m_OpenFileLimit)
+    shard.Opened.notify_all();
+}
+
+std::unique_ptr<PoolableFile> FilePool::Acquire(const std::string &filename, const bool skipTarInfo)
+{
+    size_t offset = 0;
+    size_t size = (size_t)-1;
+    const std::string finalFileName = ResolveTarInfo(filename, skipTarInfo, offset, size);
+    const size_t shardIndex = ShardIndex(finalFileName);
+    Shard &shard = m_Shards[shardIndex];
+
+    std::shared_ptr<PoolEntry> entry;
     {
-        for (auto it = m_Pool.begin(); it != m_Pool.end(); ++it)
+        std::unique_lock<std::mutex> lock(shard.Mutex);
+        while (true)
         {
-            if (it->second->m_InUseCount == 0)
+            std::shared_ptr<PoolEntry> ready;
+            std::shared_ptr<PoolEntry> opening;
+            auto range = shard.Pool.equal_range(finalFileName);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const PoolEntry &e = *it->second;
+                if (e.m_Ready)
+                {
+                    if (!ready && ((e.m_InUseCount == 0) || m_CanShare))
+                    {
+                        ready = it->second;
+                    }
+                }
+                else if (!opening && (e.m_InUseCount == 0 || m_CanShare || !m_ShareTestDone))
+                {
+                    opening = it->second;
+                }
+            }
+            if (ready)
+            {
+                ready->m_InUseCount++;
+                ready->m_LastUse = ++m_Clock;
+                return std::make_unique<PoolableFile>(this, ready.get(), offset, size);
+            }
+            if (!opening)
             {
-                m_Pool.erase(it);
-                m_OpenFileCount--;
                 break;
             }
+            // Someone is opening this file right now. An unclaimed open-ahead
+            // entry is taken over, otherwise wait and see if it can be shared.
+            const bool claim = (opening->m_InUseCount == 0);
+            if (claim)
+            {
+                opening->m_InUseCount++;
+            }
+            shard.Opened.wait(lock, [&] { return opening->m_Ready || opening->m_Failed; });
+            if (claim && opening->m_Ready)
+            {
+                return std::make_unique<PoolableFile>(this, opening.get(), offset, size);
+            }
         }
+
+        // PoolEntry not found or can't be reused, we need to create it. The
+        // placeholder lets us Open() without holding the shard lock.
+        entry = std::make_shared<PoolEntry>(finalFileName, nullptr, shardIndex);
+        entry->m_InUseCount = 1;
+        entry->m_Ready = false;
+        shard.Pool.insert({finalFileName, entry});
+    }
+
+    if (!ReserveSlot(true))
+    {
+        FinishOpen(entry, nullptr);
         // we didn't find anything to free, can't open more, so throw
-        if (m_OpenFileCount == m_OpenFileLimit)
-            adios2::helper::Throw<std::runtime_error>(
-                "Toolkit", "FilePool", "Acquire",
-                "Tried to open more files than file limit, requested file is \"" + finalFileName +
-                    "\" limit is " + std::to_string(m_OpenFileLimit));
-    }
-
-    std::shared_ptr<adios2::Transport> file =
-        m_Factory->OpenFileTransport(finalFileName, adios2::Mode::Read, m_TransportParams, false,
-                                     false, adios2::helper::CommDummy());
-    auto entry = std::make_shared<PoolEntry>(finalFileName, file);
-    entry->m_InUseCount = 1;
-    m_Pool.insert({finalFileName, entry});
-    std::unique_ptr<PoolableFile> ptr =
-        std::make_unique<PoolableFile>(this, entry.get(), offset, size);
+        adios2::helper::Throw<std::runtime_error>(
+            "Toolkit", "FilePool", "Acquire",
+            "Tried to open more files than file limit, requested file is \"" + finalFileName +
+                "\" limit is " + std::to_string(m_OpenFileLimit));
+    }
 
-    if (!m_ShareTestDone)
+    std::shared_ptr<adios2::Transport> file;
+    try
     {
-        // first time through, we'll always be creating the same transport, so see if we can reuse
-        // it on read
-        m_ShareTestDone = true;
-        m_CanShare = file->m_ReentrantRead;
+        file = OpenTransport(finalFileName);
+    }
+    catch (...)
+    {
+        m_OpenFileCount--;
+        FinishOpen(entry, nullptr);
+        throw;
+    }
+    FinishOpen(entry, file);
+    return std::make_unique<PoolableFile>(this, entry.get(), offset, size);
+}
+
+void FilePool::OpenAhead(const std::vector<std::string> &filenames)
+{
+    if (filenames.empty())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lockGuard(m_OpenAheadMutex);
+        if (m_OpenAheadStop)
+        {
+            return;
+        }
+        for (const auto &name : filenames)
+        {
+            if (m_OpenAheadQueue.size() >= MaxOpenAheadQueue)
+            {
+                break;
+            }
+            m_OpenAheadQueue.push_back(name);
+            ++m_OpenAheadPending;
+        }
+        if (!m_OpenAheadThread.joinable())
+        {
+            m_OpenAheadThread = std::thread(&FilePool::OpenAheadThread, this);
+        }
+    }
+    m_OpenAheadCV.notify_one();
+}
+
+void FilePool::WaitForOpenAhead()
+{
+    while (m_OpenAheadPending.load() > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void FilePool::OpenAheadThread()
+{
+    while (true)
+    {
+        std::string name;
+        {
+            std::unique_lock<std::mutex> lock(m_OpenAheadMutex);
+            m_OpenAheadCV.wait(lock,
+                               [&] { return m_OpenAheadStop || !m_OpenAheadQueue.empty(); });
+            if (m_OpenAheadStop)
+            {
+                m_OpenAheadPending = 0;
+                return;
+            }
+            name = std::move(m_OpenAheadQueue.front());
+            m_OpenAheadQueue.pop_front();
+        }
+
+        size_t offset = 0;
+        size_t size = (size_t)-1;
+        const std::string finalFileName = ResolveTarInfo(name, false, offset, size);
+        const size_t shardIndex = ShardIndex(finalFileName);
+        Shard &shard = m_Shards[shardIndex];
+
+        std::shared_ptr<PoolEntry> entry;
+        {
+            std::lock_guard<std::mutex> lockGuard(shard.Mutex);
+            // never evict for a guess: only open if not present and there is room
+            if (shard.Pool.count(finalFileName) == 0 && ReserveSlot(false))
+            {
+                entry = std::make_shared<PoolEntry>(finalFileName, nullptr, shardIndex);
+                entry->m_Ready = false;
+                shard.Pool.insert({finalFileName, entry});
+            }
+        }
+        if (entry)
+        {
+            std::shared_ptr<adios2::Transport> file;
+            try
+            {
+                file = OpenTransport(finalFileName);
+            }
+            catch (...)
+            {
+                // the file may not exist (yet), a later Acquire reports the error
+                m_OpenFileCount--;
+            }
+            FinishOpen(entry, file);
+        }
+        --m_OpenAheadPending;
     }
-    m_OpenFileCount++;
-    if (m_OpenFileCount > m_MaxFileCount)
-        m_MaxFileCount = m_OpenFileCount;
-    return ptr;
 }
 
 void FilePool::SetParameters(const adios2::Params &params)
 {
+    std::lock_guard<std::mutex> lockGuard(m_ParamsMutex);
     m_TransportParams.insert(params.begin(), params.end());
 }
@@ -19,13 +19,27 @@
  * read threads, each of which runs a loop, pulling a read request off
  * of a shared queue, reading that data (from some data file) and
  * moving on to the next request.  Those threads Acquire() a
- * PoolableFile pointer from a FilePool.  Acquire() is protected by a
- * mutex and each acquire operation involves at least an equal_range()
- * operation on the m_Pool unordered_multimap which is indexed by
- * filename.  If there's an available open transport, then the hash
- * and lookup is the principal cost of the operation, however if the
- * file must be Open()'d, then the mutex will be held until that
- * operation is complete.
+ * PoolableFile pointer from a FilePool.  The pool is split into
+ * shards by the hash of the filename, each with its own mutex, so
+ * threads working on different subfiles rarely contend.  Acquire()
+ * involves at least an equal_range() operation on the shard's
+ * unordered_multimap.  If there's an available open transport, then
+ * the hash and lookup is the principal cost of the operation.  If the
+ * file must be Open()'d, a placeholder entry is inserted and the shard
+ * mutex is released for the duration of the Open(); other threads
+ * asking for the same (sharable) file wait for that placeholder
+ * instead of opening it again.
+ *
+ * The OpenFileLimit is global to the pool.  When it is reached, the
+ * least recently used entry that is not in use is closed.  An entry
+ * that is in use is never closed, if all entries are in use Acquire()
+ * throws.
+ *
+ * OpenAhead() queues the names of files that are expected to be read
+ * soon (e.g. the next subfiles in a sorted list of read requests).  A
+ * background thread opens them while there is room under the
+ * OpenFileLimit, without evicting anything, so that Open() latency
+ * overlaps with reading the current subfile.
  *
  * Aquire() returns a unique_ptr to a PoolableFile. The PoolableFile
  * contains a shared_ptr to Transport, as well as a link to the
@@ -60,19 +74,28 @@
 #include "adios2/helper/adiosCommDummy.h"
 #include "adios2/helper/adiosString.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
 
 class PoolEntry
 {
 public:
-    PoolEntry(const std::string &name, std::shared_ptr<adios2::Transport> file)
-    : m_File(file), m_Name(name)
+    PoolEntry(const std::string &name, std::shared_ptr<adios2::Transport> file, size_t shard)
+    : m_File(file), m_Shard(shard), m_Name(name)
     {
     }
     ~PoolEntry() {}
 
     std::shared_ptr<adios2::Transport> m_File;
     size_t m_InUseCount = 0;
+    size_t m_Shard;
+    uint64_t m_LastUse = 0; ///< pool clock at last Acquire/Release, for LRU eviction
+    bool m_Ready = true;    ///< false while the transport is being opened
+    bool m_Failed = false;  ///< the Open() of this placeholder threw
 
 private:
     std::string m_Name;
@@ -105,29 +128,62 @@ public:
              size_t OpenFileLimit, adios2::helper::TarInfoMap *TarInfoMap)
     : m_Factory(factory), m_TransportParams(transportParams), m_TarInfoMap(TarInfoMap),
       m_OpenFileLimit(OpenFileLimit){};
+    ~FilePool();
     // Acquire a Poolablefile object from the pool, creating it if necessary
     std::unique_ptr<PoolableFile> Acquire(const std::string &filename,
                                           const bool skipTarInfo = false);
     void Release(PoolEntry *obj);
     // Remove all unused pool entries for a given filename, closing their transports.
     void Evict(const std::string &filename);
+    // Open these files in the background if there is room under the open file limit
+    void OpenAhead(const std::vector<std::string> &filenames);
     void SetParameters(const adios2::Params &params);
     std::vector<std::shared_ptr<adios2::Transport>> ListOfTransports();
 
     // testing only
     size_t GetMax() { return m_MaxFileCount; }
+    size_t GetOpenCount() { return m_OpenFileCount; }
+    void WaitForOpenAhead();
 
 private:
-    // The pool's internal storage
-    std::mutex PoolMutex;
+    static constexpr size_t ShardCount = 16;
+    struct Shard
+    {
+        std::mutex Mutex;
+        std::condition_variable Opened;
+        std::unordered_multimap<std::string, std::shared_ptr<PoolEntry>> Pool;
+    };
+    std::array<Shard, ShardCount> m_Shards;
+
     adios2::transportman::TransportMan *m_Factory;
+    std::mutex m_ParamsMutex;
     adios2::Params m_TransportParams;
     adios2::helper::TarInfoMap *m_TarInfoMap;
-    std::unordered_multimap<std::string, std::shared_ptr<PoolEntry>> m_Pool;
     size_t m_OpenFileLimit;
-    size_t m_OpenFileCount = 0;
-    bool m_CanShare = false;
-    bool m_ShareTestDone = false;
-    size_t m_MaxFileCount = 0;
+    std::atomic<size_t> m_OpenFileCount{0};
+    std::atomic<bool> m_CanShare{false};
+    std::atomic<bool> m_ShareTestDone{false};
+    std::atomic<size_t> m_MaxFileCount{0};
+    std::atomic<uint64_t> m_Clock{0};
+
+    // open-ahead worker
+    std::mutex m_OpenAheadMutex;
+    std::condition_variable m_OpenAheadCV;
+    std::deque<std::string> m_OpenAheadQueue;
+    std::atomic<size_t> m_OpenAheadPending{0}; ///< queued or in-flight open-ahead files
+    bool m_OpenAheadStop = false;
+    std::thread m_OpenAheadThread;
+
+    size_t ShardIndex(const std::string &filename) const;
+    std::string ResolveTarInfo(const std::string &filename, const bool skipTarInfo,
+                               size_t &offset, size_t &size) const;
+    std::shared_ptr<adios2::Transport> OpenTransport(const std::string &filename);
+    // Reserve one slot under the open file limit, evicting if allowed
+    bool ReserveSlot(const bool evict);
+    // Close the least recently used entry that is not in use
+    bool EvictLRU();
+    void FinishOpen(const std::shared_ptr<PoolEntry> &entry,
+                    std::shared_ptr<adios2::Transport> file);
+    void OpenAheadThread();
 };
 #endif /* ADIOS2_FILEPOOL_H_ */
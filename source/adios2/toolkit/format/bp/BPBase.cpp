@@ -107,6 +107,11 @@ void BPBase::Init(const Params &parameters, const std::string hint, const std::s
             parsedParameters.Threads = static_cast<unsigned int>(
                 helper::StringTo<uint32_t>(value, " in Parameter key=Threads " + hint));
         }
+        else if (key == "metadatathreads")
+        {
+            parsedParameters.MetadataThreads = static_cast<unsigned int>(
+                helper::StringTo<uint32_t>(value, " in Parameter key=MetadataThreads " + hint));
+        }
         else if (key == "asyncopen")
         {
             parsedParameters.AsyncOpen =
@@ -200,6 +205,17 @@ void BPBase::Init(const Params &parameters, const std::string hint, const std::s
             parsedParameters.BurstBufferVerbose = static_cast<int>(
                 helper::StringTo<int32_t>(value, " in Parameter key=BurstBufferVerbose " + hint));
         }
+        else if (key == "burstbufferdrainthreads")
+        {
+            parsedParameters.BurstBufferDrainThreads =
+                static_cast<unsigned int>(helper::StringTo<uint32_t>(
+                    value, " in Parameter key=BurstBufferDrainThreads " + hint));
+        }
+        else if (key == "burstbufferdrainbandwidth")
+        {
+            parsedParameters.BurstBufferDrainBandwidth = helper::StringToByteUnits(
+                value, "for Parameter key=BurstBufferDrainBandwidth, in call to Open");
+        }
         else if (key == "streamreader")
         {
             parsedParameters.StreamReader =
@@ -190,6 +190,9 @@ public:
         /** might be used in large payload copies to buffer */
         unsigned int Threads = 1;
 
+        /** BP4 reader: threads used to parse the metadata of many steps */
+        unsigned int MetadataThreads = 1;
+
         /** default time unit in m_Profiler */
         TimeUnit ProfileUnit = DefaultTimeUnitEnum;
 
@@ -215,6 +218,12 @@ public:
         /** Verbose level for burst buffer draining thread */
         int BurstBufferVerbose = 0;
 
+        /** Number of parallel burst buffer drain streams */
+        unsigned int BurstBufferDrainThreads = 1;
+
+        /** Limit of the drain traffic in bytes/second, 0 = unlimited */
+        size_t BurstBufferDrainBandwidth = 0;
+
         /** Stream reader flag: process metadata step-by-step
          * instead of parsing everything available
          */
@@ -13,7 +13,10 @@
 #include "BP4Deserializer.h"
 #include "BP4Deserializer.tcc"
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -60,23 +63,123 @@ size_t BP4Deserializer::ParseMetadata(const BufferSTL &bufferSTL, core::Engine &
             selectedSteps.push_back(std::stoi(item));
         }
     }
+    std::vector<size_t> stepsToParse;
     for (size_t i = oldSteps; i < allSteps; i++)
     {
         if (selectedSteps.size() == 0 ||
             std::find(selectedSteps.begin(), selectedSteps.end(), i) != selectedSteps.end())
         {
-            ParsePGIndexPerStep(bufferSTL,
-                                (engine.m_IO.m_ArrayOrder == ArrayOrdering::RowMajor) ? "C++"
-                                                                                      : "Fortran",
-                                0, i + 1);
-            ParseVariablesIndexPerStep(bufferSTL, engine, 0, i + 1);
-            ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
-            lastposition = m_MetadataIndexTable[0][i + 1][3];
+            stepsToParse.push_back(i);
         }
     }
+    const std::string hostLanguage =
+        (engine.m_IO.m_ArrayOrder == ArrayOrdering::RowMajor) ? "C++" : "Fortran";
+
+    if (m_Parameters.MetadataThreads > 1 && stepsToParse.size() > 1)
+    {
+        ParseMetadataThreaded(bufferSTL, engine, hostLanguage, stepsToParse);
+        return m_MetadataIndexTable[0][stepsToParse.back() + 1][3];
+    }
+
+    for (const size_t i : stepsToParse)
+    {
+        ParsePGIndexPerStep(bufferSTL, hostLanguage, 0, i + 1);
+        ParseVariablesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
+        lastposition = m_MetadataIndexTable[0][i + 1][3];
+    }
     return lastposition;
 }
 
+void BP4Deserializer::ParseMetadataThreaded(const BufferSTL &bufferSTL, core::Engine &engine,
+                                            const std::string &hostLanguage,
+                                            const std::vector<size_t> &steps)
+{
+    // the PG indices decide m_ReverseDimensions which every variable needs
+    for (const size_t i : steps)
+    {
+        ParsePGIndexPerStep(bufferSTL, hostLanguage, 0, i + 1);
+    }
+
+    // locate every variable index element of every step, steps in parallel
+    const size_t nThreads = std::min(static_cast<size_t>(m_Parameters.MetadataThreads),
+                                     steps.size());
+    std::vector<std::vector<VariableIndexEntry>> stepEntries(steps.size());
+    auto lf_Scan = [&](const size_t first, const size_t last) {
+        for (size_t k = first; k < last; ++k)
+        {
+            ScanVariablesIndexPerStep(bufferSTL, 0, steps[k] + 1, stepEntries[k]);
+        }
+    };
+    {
+        const size_t stride = steps.size() / nThreads;
+        std::vector<std::future<void>> futures;
+        futures.reserve(nThreads - 1);
+        for (size_t t = 1; t < nThreads; ++t)
+        {
+            const size_t last = (t == nThreads - 1 ? steps.size() : (t + 1) * stride);
+            futures.push_back(std::async(std::launch::async, lf_Scan, t * stride, last));
+        }
+        lf_Scan(0, stride);
+        for (auto &f : futures)
+        {
+            f.get();
+        }
+    }
+
+    // a variable's steps must be applied in order, different variables are
+    // independent, so group the elements by variable name
+    std::vector<std::vector<const VariableIndexEntry *>> variables;
+    std::unordered_map<std::string, size_t> variableIndex;
+    for (const auto &entries : stepEntries)
+    {
+        for (const auto &entry : entries)
+        {
+            const std::string variableName =
+                entry.Header.Path.empty() ? entry.Header.Name
+                                          : entry.Header.Path + PathSeparator + entry.Header.Name;
+            auto it = variableIndex.emplace(variableName, variables.size());
+            if (it.second)
+            {
+                variables.emplace_back();
+            }
+            variables[it.first->second].push_back(&entry);
+        }
+    }
+
+    std::atomic<size_t> nextVariable(0);
+    auto lf_Define = [&]() {
+        size_t v;
+        while ((v = nextVariable++) < variables.size())
+        {
+            for (const VariableIndexEntry *entry : variables[v])
+            {
+                DefineVariablePerStep(entry->Header, engine, bufferSTL.m_Buffer, entry->Position,
+                                      entry->Step);
+            }
+        }
+    };
+    {
+        const size_t nDefiners = std::min(nThreads, variables.size());
+        std::vector<std::future<void>> futures;
+        for (size_t t = 1; t < nDefiners; ++t)
+        {
+            futures.push_back(std::async(std::launch::async, lf_Define));
+        }
+        lf_Define();
+        for (auto &f : futures)
+        {
+            f.get();
+        }
+    }
+
+    // attributes last, they may refer to variables from any step
+    for (const size_t i : steps)
+    {
+        ParseAttributesIndexPerStep(bufferSTL, engine, 0, i + 1);
+    }
+}
+
 void BP4Deserializer::ParseMetadataIndex(BufferSTL &bufferSTL, const size_t absoluteStartPos,
                                          const bool hasHeader, const bool oneStepOnly)
 {
@@ -306,26 +409,60 @@ void BP4Deserializer::ParsePGIndexPerStep(const BufferSTL &bufferSTL,
     }
 } */
 
-void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL, core::Engine &engine,
-                                                 size_t submetadatafileId, size_t step)
+void BP4Deserializer::DefineVariablePerStep(const ElementIndexHeader &header,
+                                            core::Engine &engine, const std::vector<char> &buffer,
+                                            size_t position, size_t step)
 {
-    auto lf_ReadElementIndexPerStep = [&](core::Engine &engine, const std::vector<char> &buffer,
-                                          size_t position, size_t step) {
-        const ElementIndexHeader header =
-            ReadElementIndexHeader(buffer, position, m_Minifooter.IsLittleEndian);
-
-        switch (header.DataType)
-        {
+    switch (header.DataType)
+    {
 
 #define make_case(T)                                                                               \
     case (TypeTraits<T>::type_enum): {                                                             \
         DefineVariableInEngineIOPerStep<T>(header, engine, buffer, position, step);                \
         break;                                                                                     \
     }
-            ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
+        ADIOS2_FOREACH_STDTYPE_1ARG(make_case)
 #undef make_case
 
-        } // end switch
+    } // end switch
+}
+
+void BP4Deserializer::ScanVariablesIndexPerStep(const BufferSTL &bufferSTL,
+                                                size_t submetadatafileId, size_t step,
+                                                std::vector<VariableIndexEntry> &entries) const
+{
+    const auto &buffer = bufferSTL.m_Buffer;
+    size_t position = m_MetadataIndexTable.at(submetadatafileId).at(step)[1];
+
+    helper::ReadValue<uint32_t>(buffer, position, m_Minifooter.IsLittleEndian);
+    const uint64_t length =
+        helper::ReadValue<uint64_t>(buffer, position, m_Minifooter.IsLittleEndian);
+
+    const size_t startPosition = position;
+    while (position - startPosition < length)
+    {
+        size_t elementPosition = position;
+        VariableIndexEntry entry;
+        entry.Header =
+            ReadElementIndexHeader(buffer, elementPosition, m_Minifooter.IsLittleEndian);
+        entry.Position = elementPosition;
+        entry.Step = step;
+        entries.push_back(std::move(entry));
+
+        const size_t elementIndexSize = static_cast<size_t>(
+            helper::ReadValue<uint32_t>(buffer, position, m_Minifooter.IsLittleEndian));
+        position += elementIndexSize;
+    }
+}
+
+void BP4Deserializer::ParseVariablesIndexPerStep(const BufferSTL &bufferSTL, core::Engine &engine,
+                                                 size_t submetadatafileId, size_t step)
+{
+    auto lf_ReadElementIndexPerStep = [&](core::Engine &engine, const std::vector<char> &buffer,
+                                          size_t position, size_t step) {
+        const ElementIndexHeader header =
+            ReadElementIndexHeader(buffer, position, m_Minifooter.IsLittleEndian);
+        DefineVariablePerStep(header, engine, buffer, position, step);
     };
 
     const auto &buffer = bufferSTL.m_Buffer;
@@ -182,6 +182,26 @@ private:
 
     void ParseMinifooter(const BufferSTL &bufferSTL);
 
+    /** Location of one variable index element of one step */
+    struct VariableIndexEntry
+    {
+        ElementIndexHeader Header;
+        size_t Position; ///< first characteristic after the header
+        size_t Step;
+    };
+
+    /** MetadataThreads > 1: scan all steps' indices in parallel, then define
+     * different variables in parallel, each one's steps in order */
+    void ParseMetadataThreaded(const BufferSTL &bufferSTL, core::Engine &engine,
+                               const std::string &hostLanguage,
+                               const std::vector<size_t> &steps);
+
+    void ScanVariablesIndexPerStep(const BufferSTL &bufferSTL, size_t submetadatafileId,
+                                   size_t step, std::vector<VariableIndexEntry> &entries) const;
+
+    void DefineVariablePerStep(const ElementIndexHeader &header, core::Engine &engine,
+                               const std::vector<char> &buffer, size_t position, size_t step);
+
     // void ParsePGIndex(const BufferSTL &bufferSTL, const core::IO &io);
     void ParsePGIndexPerStep(const BufferSTL &bufferSTL, const std::string hostLanguage,
                              size_t submetadatafileId, size_t step);
@@ -701,7 +701,11 @@ inline void BP4Deserializer::DefineVariableInEngineIOPerStep<std::string>(
         header.Path.empty() ? header.Name : header.Path + PathSeparator + header.Name;
 
     core::Variable<std::string> *variable = nullptr;
-    variable = engine.m_IO.InquireVariable<std::string>(variableName);
+    {
+        // to prevent conflict with DefineVariable
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        variable = engine.m_IO.InquireVariable<std::string>(variableName);
+    }
     if (variable)
     {
         size_t endPositionCurrentStep =
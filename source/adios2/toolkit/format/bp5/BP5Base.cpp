@@ -47,6 +47,121 @@ int BP5Base::BP5BitfieldTest(struct BP5MetadataInfoStruct *MBase, int Bit) const
     }
     return ((MBase->BitField[Element] & ((size_t)1 << ElementBit)) == ((size_t)1 << ElementBit));
 }
+
+void BP5Base::PutMetadataTag(char *Tag, const MetadataBlockKind Kind, const size_t RecordLen) const
+{
+    Tag[0] = Kind;
+    for (size_t i = 1; i < MetadataTagSize; ++i)
+    {
+        Tag[i] = static_cast<char>((RecordLen >> (8 * (i - 1))) & 0xff);
+    }
+}
+
+BP5Base::MetadataBlockKind BP5Base::GetMetadataTag(const char *Tag, size_t &RecordLen) const
+{
+    RecordLen = 0;
+    for (size_t i = 1; i < MetadataTagSize; ++i)
+    {
+        RecordLen |= static_cast<size_t>(static_cast<unsigned char>(Tag[i])) << (8 * (i - 1));
+    }
+    return static_cast<MetadataBlockKind>(Tag[0]);
+}
+
+namespace
+{
+void PutVarint(std::vector<char> &Out, size_t Value)
+{
+    while (Value >= 0x80)
+    {
+        Out.push_back(static_cast<char>((Value & 0x7f) | 0x80));
+        Value >>= 7;
+    }
+    Out.push_back(static_cast<char>(Value));
+}
+
+bool GetVarint(const char *&In, const char *End, size_t &Value)
+{
+    Value = 0;
+    for (int Shift = 0; In < End && Shift < 64; Shift += 7)
+    {
+        const unsigned char Byte = static_cast<unsigned char>(*In++);
+        Value |= static_cast<size_t>(Byte & 0x7f) << Shift;
+        if (!(Byte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // end anonymous namespace
+
+void BP5Base::EncodeMetadataDelta(const char *Base, const char *Record, const size_t Size,
+                                  std::vector<char> &Out) const
+{
+    // a short run of unchanged bytes costs less inside the changed bytes
+    // than as a pair of its own
+    const size_t MinGap = 4;
+    size_t i = 0;
+    while (i < Size)
+    {
+        const size_t Start = i;
+        while (i < Size && Record[i] == Base[i])
+        {
+            ++i;
+        }
+        const size_t ChangedStart = i;
+        size_t ChangedEnd = i;
+        while (i < Size)
+        {
+            if (Record[i] != Base[i])
+            {
+                ChangedEnd = ++i;
+                continue;
+            }
+            size_t Gap = i;
+            while (Gap < Size && Gap - i < MinGap && Record[Gap] == Base[Gap])
+            {
+                ++Gap;
+            }
+            if (Gap - i >= MinGap || Gap == Size)
+            {
+                break;
+            }
+            i = Gap;
+        }
+        i = ChangedEnd;
+        PutVarint(Out, ChangedStart - Start);
+        PutVarint(Out, ChangedEnd - ChangedStart);
+        for (size_t j = ChangedStart; j < ChangedEnd; ++j)
+        {
+            Out.push_back(static_cast<char>(Record[j] ^ Base[j]));
+        }
+    }
+}
+
+bool BP5Base::DecodeMetadataDelta(const char *Delta, const size_t DeltaLen,
+                                  std::vector<char> &Base) const
+{
+    const char *End = Delta + DeltaLen;
+    size_t i = 0;
+    while (i < Base.size())
+    {
+        size_t Unchanged, Changed;
+        if (!GetVarint(Delta, End, Unchanged) || !GetVarint(Delta, End, Changed) ||
+            Unchanged > Base.size() - i || Changed > Base.size() - i - Unchanged ||
+            Changed > static_cast<size_t>(End - Delta))
+        {
+            return false;
+        }
+        i += Unchanged;
+        for (size_t j = 0; j < Changed; ++j)
+        {
+            Base[i++] ^= *Delta++;
+        }
+    }
+    return true;
+}
+
 #define BASE_FIELD_ENTRIES                                                                         \
     {"Dims", "integer", sizeof(size_t), FMOffset(BP5Base::MetaArrayRec *, Dims)},                  \
         {"BlockCount", "integer", sizeof(size_t), FMOffset(BP5Base::MetaArrayRec *, BlockCount)},  \
@@ -115,6 +230,40 @@ static FMField MetaArrayRecOperatorMM16List[] = {
                        FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
     {"MinMax", "char[32][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMM *, MinMax)},
     {NULL, NULL, 0, 0}};
+
+/* accuracy levels follow everything else so that readers unaware of them
+ * still find the other fields where they expect them */
+#define LEVEL_FIELD_ENTRIES(TYPE)                                                                  \
+    {"LevelCount", "integer", sizeof(size_t), FMOffset(TYPE *, Levels.LevelCount)},                \
+        {"BlockLevels", "integer[BlockCount]", sizeof(size_t),                                     \
+         FMOffset(TYPE *, Levels.BlockLevels)},                                                    \
+        {"LevelError", "float[LevelCount]", sizeof(double), FMOffset(TYPE *, Levels.LevelError)},  \
+        {"LevelLength", "integer[LevelCount]", sizeof(size_t),                                     \
+         FMOffset(TYPE *, Levels.LevelLength)},
+
+static FMField MetaArrayRecOperatorLvList[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
+    LEVEL_FIELD_ENTRIES(BP5Base::MetaArrayRecOperatorLv){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMM4LvList[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
+    {"MinMax", "char[8][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMM *, MinMax)},
+    LEVEL_FIELD_ENTRIES(BP5Base::MetaArrayRecOperatorMMLv){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMM8LvList[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
+    {"MinMax", "char[16][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMM *, MinMax)},
+    LEVEL_FIELD_ENTRIES(BP5Base::MetaArrayRecOperatorMMLv){NULL, NULL, 0, 0}};
+
+static FMField MetaArrayRecOperatorMM16LvList[] = {
+    BASE_FIELD_ENTRIES{"DataBlockSize", "integer[BlockCount]", sizeof(size_t),
+                       FMOffset(BP5Base::MetaArrayRecOperator *, DataBlockSize)},
+    {"MinMax", "char[32][BlockCount]", 1, FMOffset(BP5Base::MetaArrayRecOperatorMM *, MinMax)},
+    LEVEL_FIELD_ENTRIES(BP5Base::MetaArrayRecOperatorMMLv){NULL, NULL, 0, 0}};
+#undef LEVEL_FIELD_ENTRIES
 #undef BASE_FIELD_ENTRIES
 
 BP5Base::BP5Base()
@@ -131,6 +280,10 @@ BP5Base::BP5Base()
     MetaArrayRecOperatorMM8ListPtr = &MetaArrayRecOperatorMM8List[0];
     MetaArrayRecMM16ListPtr = &MetaArrayRecMM16List[0];
     MetaArrayRecOperatorMM16ListPtr = &MetaArrayRecOperatorMM16List[0];
+    MetaArrayRecOperatorLvListPtr = &MetaArrayRecOperatorLvList[0];
+    MetaArrayRecOperatorMM4LvListPtr = &MetaArrayRecOperatorMM4LvList[0];
+    MetaArrayRecOperatorMM8LvListPtr = &MetaArrayRecOperatorMM8LvList[0];
+    MetaArrayRecOperatorMM16LvListPtr = &MetaArrayRecOperatorMM16LvList[0];
 }
 }
 }
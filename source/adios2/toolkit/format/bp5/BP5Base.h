@@ -70,6 +70,31 @@ public:
         char *MinMax;          // char[TYPESIZE][BlockCount]  varies by type
     } MetaArrayRecOperatorMM;
 
+    /* Prefixes of the operator output that are enough for a given accuracy,
+     * for operators with Operator::HasAccuracyLevels() */
+    typedef struct _MetaAccuracyLevels
+    {
+        size_t LevelCount;   /* Levels of all blocks */
+        size_t *BlockLevels; /* Per-block number of levels [BlockCount] */
+        double *LevelError;  /* Absolute Linf error bound [LevelCount] */
+        size_t *LevelLength; /* Bytes needed from the block start [LevelCount] */
+    } MetaAccuracyLevels;
+
+    typedef struct _MetaArrayRecOperatorLv
+    {
+        BASE_FIELDS
+        size_t *DataBlockSize; // Per-block Lengths [BlockCount]
+        MetaAccuracyLevels Levels;
+    } MetaArrayRecOperatorLv;
+
+    typedef struct _MetaArrayRecOperatorMMLv
+    {
+        BASE_FIELDS
+        size_t *DataBlockSize; // Per-block Lengths [BlockCount]
+        char *MinMax;          // char[TYPESIZE][BlockCount]  varies by type
+        MetaAccuracyLevels Levels;
+    } MetaArrayRecOperatorMMLv;
+
 #undef BASE_FIELDS
 
     struct BP5MetadataInfoStruct
@@ -149,6 +174,29 @@ public:
         {"StrAttr", string_attr_field_list, sizeof(StringArrayAttr), NULL},
         {NULL, NULL, 0, NULL}};
 
+    /* With delta-encoded metadata every metadata block starts with an
+     * 8 byte tag, the block kind followed by the record length in 7 little
+     * endian bytes. A keyframe holds the record after the tag, a delta holds
+     * (unchanged bytes, changed bytes) varint pairs and the changed bytes
+     * XORed with the previous record of the same writer */
+    enum MetadataBlockKind : char
+    {
+        MetadataKeyframe = 'K',
+        MetadataDelta = 'D'
+    };
+    static constexpr size_t MetadataTagSize = 8;
+
+    void PutMetadataTag(char *Tag, const MetadataBlockKind Kind, const size_t RecordLen) const;
+    MetadataBlockKind GetMetadataTag(const char *Tag, size_t &RecordLen) const;
+
+    /** appends to Out the delta that turns Base into Record, both Size bytes */
+    void EncodeMetadataDelta(const char *Base, const char *Record, const size_t Size,
+                             std::vector<char> &Out) const;
+    /** applies the delta of DeltaLen bytes to Base in place, false if it is
+     * malformed */
+    bool DecodeMetadataDelta(const char *Delta, const size_t DeltaLen,
+                             std::vector<char> &Base) const;
+
     void BP5BitfieldSet(struct BP5MetadataInfoStruct *MBase, int Bit) const;
     int BP5BitfieldTest(struct BP5MetadataInfoStruct *MBase, int Bit) const;
     FMField *MetaArrayRecListPtr;
@@ -163,6 +211,10 @@ public:
     FMField *MetaArrayRecOperatorMM8ListPtr;
     FMField *MetaArrayRecMM16ListPtr;
     FMField *MetaArrayRecOperatorMM16ListPtr;
+    FMField *MetaArrayRecOperatorLvListPtr;
+    FMField *MetaArrayRecOperatorMM4LvListPtr;
+    FMField *MetaArrayRecOperatorMM8LvListPtr;
+    FMField *MetaArrayRecOperatorMM16LvListPtr;
 };
 } // end namespace format
 } // end namespace adios2
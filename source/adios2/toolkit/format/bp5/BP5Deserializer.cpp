@@ -33,7 +33,9 @@
 #include "adios2/operator/OperatorFactory.h"
 #include "adios2/operator/plugin/PluginOperator.h"
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
 #include <float.h>
 #include <limits.h>
 #include <math.h>
@@ -181,7 +183,8 @@ const char *BP5Deserializer::BreakdownVarName(const char *Name, DataType *type_p
     return p;
 }
 
-void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax)
+void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax,
+                                         bool &Levels)
 {
     if (FieldType[0] != 'M')
     {
@@ -201,6 +204,7 @@ void BP5Deserializer::BreakdownFieldType(const char *FieldType, bool &Operator,
     {
         MinMax = true;
     }
+    Levels = (strstr(FieldType, "Lv") != NULL);
 }
 
 void BP5Deserializer::BreakdownV1ArrayName(const char *Name, char **base_name_p, DataType *type_p,
@@ -430,6 +434,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             int ElementSize;
             bool Operator = false;
             bool MinMax = false;
+            bool Levels = false;
             bool V1_fields = true;
             FMFormat StructFormat = NULL;
             if (FieldList[i].field_type[0] == 'M')
@@ -441,7 +446,7 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             }
             else
             {
-                BreakdownFieldType(FieldList[i].field_type, Operator, MinMax);
+                BreakdownFieldType(FieldList[i].field_type, Operator, MinMax, Levels);
                 BreakdownArrayName(FieldList[i].field_name + HeaderSkip, &ArrayName, &Type,
                                    &ElementSize, &StructFormat);
             }
@@ -499,6 +504,10 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
                 VarRec->MinMaxOffset = MetaRecFields * sizeof(void *);
                 MetaRecFields++;
             }
+            if (Levels)
+            {
+                VarRec->LevelsOffset = MetaRecFields * sizeof(void *);
+            }
             if (V1_fields)
             {
                 i += (int)MetaRecFields;
@@ -643,9 +652,74 @@ void *BP5Deserializer::ArrayVarSetup(core::Engine *engine, const char *variableN
     return (void *)NULL;
 };
 
+char *BP5Deserializer::ExpandMetadata(char *MetadataBlock, size_t &BlockLen,
+                                      const size_t WriterRank, const bool CopyRecord)
+{
+    size_t RecordLen;
+    const MetadataBlockKind Kind =
+        (BlockLen >= MetadataTagSize) ? GetMetadataTag(MetadataBlock, RecordLen) : MetadataDelta;
+    if (m_MetadataDeltaBase.size() <= WriterRank)
+    {
+        m_MetadataDeltaBase.resize(WriterRank + 1);
+    }
+    std::vector<char> &Base = m_MetadataDeltaBase[WriterRank];
+    char *Record = MetadataBlock + MetadataTagSize;
+    if (Kind == MetadataKeyframe && RecordLen <= BlockLen - MetadataTagSize)
+    {
+        // kept before the record is decoded in place
+        Base.assign(Record, Record + RecordLen);
+        if (CopyRecord)
+        {
+            m_ExpandedMetadata.emplace_back(Base);
+            Record = m_ExpandedMetadata.back().data();
+        }
+    }
+    else if (Kind == MetadataDelta && BlockLen >= MetadataTagSize && RecordLen == Base.size() &&
+             RecordLen > 0 &&
+             DecodeMetadataDelta(Record, BlockLen - MetadataTagSize, Base))
+    {
+        m_ExpandedMetadata.emplace_back(Base);
+        Record = m_ExpandedMetadata.back().data();
+    }
+    else
+    {
+        helper::Throw<std::logic_error>("Toolkit", "format::BP5Deserializer", "ExpandMetadata",
+                                        "Internal error or file corruption, bad delta-encoded "
+                                        "metadata block of writer rank " +
+                                            std::to_string(WriterRank));
+    }
+    BlockLen = RecordLen;
+    return Record;
+}
+
+char *BP5Deserializer::PrivateMetadataCopy(const char *MetadataBlock, const size_t BlockLen)
+{
+    m_ExpandedMetadata.emplace_back(MetadataBlock, MetadataBlock + BlockLen);
+    return m_ExpandedMetadata.back().data();
+}
+
+size_t BP5Deserializer::PrivateMetadataSize() const noexcept
+{
+    size_t size = 0;
+    for (const auto &record : m_ExpandedMetadata)
+    {
+        size += record.size();
+    }
+    for (const auto &base : m_MetadataDeltaBase)
+    {
+        size += base.size();
+    }
+    return size;
+}
+
 void BP5Deserializer::SetupForStep(size_t Step, size_t WriterCount)
 {
     CurTimestep = Step;
+    if (!m_RandomAccessMode && !m_FlattenSteps)
+    {
+        // the metadata of the previous step is not used anymore
+        m_ExpandedMetadata.clear();
+    }
     if (m_RandomAccessMode)
     {
         if (m_WriterCohortSize.size() < Step + 1)
@@ -657,6 +731,8 @@ void BP5Deserializer::SetupForStep(size_t Step, size_t WriterCount)
     else
     {
         PendingGetRequests.clear();
+        m_PrefixCache.clear();
+        m_PrefixCacheBytes = 0;
 
         for (auto RecPair : VarByKey)
         {
@@ -961,6 +1037,8 @@ void BP5Deserializer::InstallMetadataBuffer(void *BaseData, size_t WriterRank, s
                                       meta_base->Shape, meta_base->Offsets, meta_base->Count,
                                       VarRec->Def, VarRec->ReaderDef);
                     static_cast<VariableBase *>(VarRec->Variable)->m_Engine = m_Engine;
+                    static_cast<VariableBase *>(VarRec->Variable)->m_ReadAsJoined =
+                        (VarRec->OrigShapeID == ShapeID::JoinedArray);
                     VarByKey[VarRec->Variable] = VarRec;
                     VarRec->LastTSAdded = Step; // starts at 1
                     if (VarRec->Operator)
@@ -1620,6 +1698,10 @@ bool BP5Deserializer::QueueGetSingleRemote(core::VariableBase &variable, void *D
 bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData,
                                const core::Selection &selection, bool dataIsRemote)
 {
+    if (selection.GetLevelOfDetail() > 0)
+    {
+        return QueueGetLevelOfDetail(variable, DestData, selection, dataIsRemote);
+    }
     const size_t stepsStart = selection.GetStepStart();
     const size_t stepsCount = selection.GetStepCount();
 
@@ -1676,6 +1758,42 @@ bool BP5Deserializer::QueueGet(core::VariableBase &variable, void *DestData,
     }
 }
 
+bool BP5Deserializer::QueueGetLevelOfDetail(core::VariableBase &variable, void *DestData,
+                                            const core::Selection &selection, bool dataIsRemote)
+{
+    const size_t level = selection.GetLevelOfDetail();
+    if (variable.m_ShapeID != ShapeID::GlobalArray || selection.HasBlockSelection())
+    {
+        helper::Throw<std::invalid_argument>("Toolkit", "format::BP5Deserializer", "QueueGet",
+                                             "level of detail requested for variable " +
+                                                 variable.m_Name +
+                                                 ", only global array boxes have coarse levels");
+    }
+    // only the companions the writer marked, a user variable may have the name
+    auto *written = m_Engine->m_IO.InquireAttribute<uint32_t>(core::LevelsOfDetailAttribute,
+                                                              variable.m_Name);
+    auto it = VarByName.find(core::LevelOfDetailName(variable.m_Name, level));
+    if (written == nullptr || level > written->m_DataSingleValue || it == VarByName.end() ||
+        it->second->Variable == NULL)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Toolkit", "format::BP5Deserializer", "QueueGet",
+            "variable " + variable.m_Name + " has no level of detail " + std::to_string(level) +
+                ", it must be written with the LevelsOfDetail parameter or attribute");
+    }
+    auto &levelVariable = *static_cast<core::VariableBase *>(it->second->Variable);
+
+    // the box is given at full resolution, read the coarse elements inside it
+    core::Selection levelSelection = selection.WithLevelOfDetail(0);
+    if (selection.GetSelectionType() == SelectionType::BoundingBox)
+    {
+        const auto box =
+            core::LevelOfDetailBox(selection.GetStart(), selection.GetCount(), level);
+        levelSelection.SetBoundingBox(box.first, box.second);
+    }
+    return QueueGet(levelVariable, DestData, levelSelection, dataIsRemote);
+}
+
 static bool IntersectionStartCount(const size_t dimensionsSize, const size_t *start1,
                                    const size_t *count1, const size_t *start2, const size_t *count2,
                                    size_t *outstart, size_t *outcount) noexcept
@@ -1763,6 +1881,54 @@ bool BP5Deserializer::IsContiguousTransfer(BP5ArrayRequest *Req, size_t *offsets
     return (((struct BP5VarRec *)Req->VarRec)->DimCount == 1);
 }
 
+void BP5Deserializer::SetOperatorReadRange(ReadRequest &RR, const BP5ArrayRequest &Req,
+                                           const MetaArrayRecOperator *writer_meta_base,
+                                           const size_t Block)
+{
+    auto VarRec = (struct BP5VarRec *)Req.VarRec;
+    size_t Length = writer_meta_base->DataBlockSize[Block];
+    RR.StartOffset = writer_meta_base->DataBlockLocation[Block];
+    RR.ReadLength = Length;
+    RR.CachedLength = 0;
+    if (VarRec->LevelsOffset == SIZE_MAX)
+    {
+        return;
+    }
+
+    // levels go from the coarsest to the finest, the first one within the
+    // requested error is the shortest prefix to read
+    const Accuracy &Acc = Req.AccuracyRequested;
+    const MetaAccuracyLevels *Levels =
+        (const MetaAccuracyLevels *)(((const char *)writer_meta_base) + VarRec->LevelsOffset);
+    if ((Acc.error > 0.0) && !Acc.relative && (Acc.norm == Linf_norm))
+    {
+        size_t First = 0;
+        for (size_t b = 0; b < Block; b++)
+        {
+            First += Levels->BlockLevels[b];
+        }
+        for (size_t l = First; l < First + Levels->BlockLevels[Block]; l++)
+        {
+            if (Levels->LevelError[l] <= Acc.error)
+            {
+                Length = std::min(Length, Levels->LevelLength[l]);
+                break;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lockGuard(mutexDecompress);
+    auto it = m_PrefixCache.find(std::make_tuple(Req.VarRec, RR.Timestep, RR.WriterRank, Block));
+    if (it != m_PrefixCache.end())
+    {
+        // always leave something to read, transports differ on empty reads
+        RR.CachedLength = std::min(it->second.Data.size(), Length - 1);
+        it->second.LastUse = ++m_PrefixCacheClock;
+    }
+    RR.StartOffset += RR.CachedLength;
+    RR.ReadLength = Length - RR.CachedLength;
+}
+
 std::vector<BP5Deserializer::ReadRequest>
 BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *maxReadSize)
 {
@@ -1860,8 +2026,7 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                                                          &writer_meta_base->Count[StartDim]);
                             if (VarRec->Operator)
                             {
-                                // have to have the whole thing
-                                RR.ReadLength = writer_meta_base->DataBlockSize[NeededBlock];
+                                SetOperatorReadRange(RR, *Req, writer_meta_base, NeededBlock);
                             }
                             else
                             {
@@ -1979,15 +2144,16 @@ BP5Deserializer::GenerateReadRequests(const bool doAllocTempBuffers, size_t *max
                                 else if (VarRec->Operator != NULL)
                                 {
                                     // need the whole thing for decompression anyway
+                                    // (or the prefix of it for the requested accuracy)
                                     ReadRequest RR;
                                     RR.Timestep = Step;
                                     RR.WriterRank = WriterRank;
-                                    RR.StartOffset = writer_meta_base->DataBlockLocation[Block];
-                                    RR.ReadLength = writer_meta_base->DataBlockSize[Block];
-                                    RR.DestinationAddr = nullptr;
-                                    if (RR.StartOffset == (size_t)-1)
+                                    RR.BlockID = Block;
+                                    if (writer_meta_base->DataBlockLocation[Block] == (size_t)-1)
                                         throw std::runtime_error(
                                             "No data exists for this variable");
+                                    SetOperatorReadRange(RR, *Req, writer_meta_base, Block);
+                                    RR.DestinationAddr = nullptr;
                                     if (doAllocTempBuffers)
                                     {
                                         RR.DestinationAddr = (char *)malloc(RR.ReadLength);
@@ -2126,7 +2292,13 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
     const size_t *SelSize = NULL;
     char *IncomingData = Read.DestinationAddr;
     char *VirtualIncomingData = Read.DestinationAddr - Read.OffsetInBlock;
-    std::vector<char> decompressBuffer;
+    DecompressBuffer decompressBuffer;
+    struct DecompressBufferGuard
+    {
+        BP5Deserializer *Owner;
+        DecompressBuffer &Buffer;
+        ~DecompressBufferGuard() { Owner->ReleaseDecompressBuffer(Buffer); }
+    } decompressBufferGuard{this, decompressBuffer};
     if (((struct BP5VarRec *)Req.VarRec)->Operator != NULL)
     {
         try
@@ -2136,52 +2308,98 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
             {
                 DestSize *= writer_meta_base->Count[dim + Read.BlockID * writer_meta_base->Dims];
             }
-            decompressBuffer.resize(DestSize);
+            decompressBuffer = AcquireDecompressBuffer(DestSize);
 
             // Get the operator of the variable if exists or create one
             std::shared_ptr<Operator> op = nullptr;
             VariableBase *VB =
                 static_cast<VariableBase *>(((struct BP5VarRec *)Req.VarRec)->Variable);
+            const size_t OperatorDataSize = Read.CachedLength + Read.ReadLength;
+            std::vector<char> prefixCopy;
+            // the lock protects mods to VB->m_Operations as well as the decompress operator
+            // and the prefix cache
+            std::unique_lock<std::mutex> lock(mutexDecompress);
+            const size_t BlockSize =
+                ((MetaArrayRecOperator *)writer_meta_base)->DataBlockSize[Read.BlockID];
+            if (Read.CachedLength || (OperatorDataSize < BlockSize))
             {
-                std::lock_guard<std::mutex> lockGuard(mutexDecompress);
-                // lock_guard protects mods to VB->m_Operations as well as the decompress operator
-                if (!VB->m_Operations.empty() && (VB->m_Operations[0]->m_TypeString != "null"))
+                // a prefix for the requested accuracy, keep it for tighter ones
+                auto &Entry = m_PrefixCache[std::make_tuple(Req.VarRec, Read.Timestep,
+                                                            Read.WriterRank, Read.BlockID)];
+                if (Entry.Data.size() < OperatorDataSize)
                 {
-                    op = VB->m_Operations[0];
+                    m_PrefixCacheBytes += OperatorDataSize - Entry.Data.size();
+                    Entry.Data.resize(OperatorDataSize);
                 }
-                else
+                std::memcpy(Entry.Data.data() + Read.CachedLength, Read.DestinationAddr,
+                            Read.ReadLength);
+                Entry.Complete = Entry.Complete || (OperatorDataSize == BlockSize);
+                Entry.LastUse = ++m_PrefixCacheClock;
+                IncomingData = Entry.Data.data();
+            }
+            if (!VB->m_Operations.empty() && (VB->m_Operations[0]->m_TypeString != "null"))
+            {
+                op = VB->m_Operations[0];
+            }
+            else
+            {
+                Operator::OperatorType compressorType =
+                    static_cast<Operator::OperatorType>(IncomingData[0]);
+                op = MakeOperator(OperatorTypeToString(compressorType), {});
+                VB->m_Operations.clear();
+                VB->m_Operations.push_back(op);
+                if (m_Engine->m_OperatorNameQuery)
                 {
-                    Operator::OperatorType compressorType =
-                        static_cast<Operator::OperatorType>(IncomingData[0]);
-                    op = MakeOperator(OperatorTypeToString(compressorType), {});
-                    VB->m_Operations.clear();
-                    VB->m_Operations.push_back(op);
-                    if (m_Engine->m_OperatorNameQuery)
+                    if (compressorType == Operator::PLUGIN_INTERFACE)
                     {
-                        if (compressorType == Operator::PLUGIN_INTERFACE)
-                        {
-                            auto pop = dynamic_cast<plugin::PluginOperator *>(op.get());
-                            pop->m_OperatorNameQuery = true;
-                        }
-                        else
-                        {
-                            auto m = MakeMessage("Operator", "OperatorFactory", "MakeOperator",
-                                                 "ADIOS2 compiled with " +
-                                                     OperatorTypeToString(compressorType) +
-                                                     " library, operator added",
-                                                 -1, helper::LogMode::EXCEPTION);
-                            throw MissingOperatorFailure(m, OperatorTypeToString(compressorType));
-                        }
+                        auto pop = dynamic_cast<plugin::PluginOperator *>(op.get());
+                        pop->m_OperatorNameQuery = true;
+                    }
+                    else
+                    {
+                        auto m = MakeMessage("Operator", "OperatorFactory", "MakeOperator",
+                                             "ADIOS2 compiled with " +
+                                                 OperatorTypeToString(compressorType) +
+                                                 " library, operator added",
+                                             -1, helper::LogMode::EXCEPTION);
+                        throw MissingOperatorFailure(m, OperatorTypeToString(compressorType));
                     }
                 }
-                op->SetAccuracy(Req.AccuracyRequested);
-                core::Decompress(
-                    IncomingData,
-                    ((MetaArrayRecOperator *)writer_meta_base)->DataBlockSize[Read.BlockID],
-                    decompressBuffer.data(), Req.MemSpace, op, m_Engine, VB);
-                VB->m_AccuracyProvided = op->GetAccuracy();
-            }
-            IncomingData = decompressBuffer.data();
+            }
+            // without DecompressThreads blocks are decompressed one at a time
+            // by the variable's operator, as they always were
+            const bool threadSafe = (m_DecompressThreads > 0) && op->IsInverseThreadSafe();
+            if (threadSafe || (m_DecompressThreads > 1 && op->m_TypeString != "plugin"))
+            {
+                // a private instance, the accuracy and thread count set below
+                // must not leak into concurrent decompressions of other blocks
+                Params parameters = op->GetParameters();
+                if (m_DecompressThreads > 1 && parameters.count("nthreads") == 0)
+                {
+                    parameters["nthreads"] = std::to_string(m_DecompressThreads);
+                }
+                op = MakeOperator(op->m_TypeString, parameters);
+            }
+            op->SetAccuracy(Req.AccuracyRequested);
+            if (threadSafe)
+            {
+                if (IncomingData != Read.DestinationAddr)
+                {
+                    // the cached prefix may grow under another thread
+                    prefixCopy.assign(IncomingData, IncomingData + OperatorDataSize);
+                    IncomingData = prefixCopy.data();
+                }
+                lock.unlock();
+            }
+            core::Decompress(IncomingData, OperatorDataSize, decompressBuffer.Ptr, Req.MemSpace,
+                             op, m_Engine, VB);
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+            }
+            VB->m_AccuracyProvided = op->GetAccuracy();
+            lock.unlock();
+            IncomingData = decompressBuffer.Ptr;
             VirtualIncomingData = IncomingData;
         }
         catch (...)
@@ -2305,7 +2523,7 @@ void BP5Deserializer::FinalizeGet(const ReadRequest &Read, const bool freeAddr)
         helper::NdCopy(VirtualIncomingData, inStart, inCount, true, m_SourceIsLittleEndian,
                        (char *)Req.Data, outStart, outCount, true, m_ReaderIsLittleEndian,
                        ElementSize, CoreDims(), CoreDims(), CoreDims(), CoreDims(), false,
-                       Req.MemSpace);
+                       Req.MemSpace, false, m_CopyThreads);
     }
 
     if (freeAddr)
@@ -2354,7 +2572,40 @@ void BP5Deserializer::FinalizeDerivedGets(std::vector<ReadRequest> &Reads)
 #endif
 }
 
-void BP5Deserializer::ClearGetState() { PendingGetRequests.clear(); }
+void BP5Deserializer::ClearGetState()
+{
+    PendingGetRequests.clear();
+    ReleaseDecompressBuffers();
+    std::vector<decltype(m_PrefixCache)::iterator> Kept;
+    for (auto it = m_PrefixCache.begin(); it != m_PrefixCache.end();)
+    {
+        if (it->second.Complete)
+        {
+            m_PrefixCacheBytes -= it->second.Data.size();
+            it = m_PrefixCache.erase(it);
+        }
+        else
+        {
+            Kept.push_back(it);
+            ++it;
+        }
+    }
+    if (m_PrefixCacheBytes <= m_PrefixCacheSize)
+    {
+        return;
+    }
+    // the least recently used prefixes go first
+    std::sort(Kept.begin(), Kept.end(),
+              [](const decltype(m_PrefixCache)::iterator &a,
+                 const decltype(m_PrefixCache)::iterator &b) {
+                  return a->second.LastUse < b->second.LastUse;
+              });
+    for (size_t i = 0; (i < Kept.size()) && (m_PrefixCacheBytes > m_PrefixCacheSize); i++)
+    {
+        m_PrefixCacheBytes -= Kept[i]->second.Data.size();
+        m_PrefixCache.erase(Kept[i]);
+    }
+}
 
 void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> &Reads)
 {
@@ -2429,8 +2680,93 @@ BP5Deserializer::BP5Deserializer(bool WriterIsRowMajor, bool ReaderIsRowMajor,
     free_FMcontext(Tmp);
 }
 
+BP5Deserializer::DecompressBuffer BP5Deserializer::AcquireDecompressBuffer(const size_t Size)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(mutexDecompressBuffers);
+        auto best = m_DecompressBuffers.end();
+        for (auto it = m_DecompressBuffers.begin(); it != m_DecompressBuffers.end(); ++it)
+        {
+            if ((it->Size >= Size) &&
+                ((best == m_DecompressBuffers.end()) || (it->Size < best->Size)))
+            {
+                best = it;
+            }
+        }
+        if (best != m_DecompressBuffers.end())
+        {
+            DecompressBuffer Buffer = *best;
+            *best = m_DecompressBuffers.back();
+            m_DecompressBuffers.pop_back();
+            return Buffer;
+        }
+    }
+
+    // cache line aligned for the operators' vectorized stores
+    constexpr size_t Alignment = 64;
+    DecompressBuffer Buffer;
+    Buffer.AllocatedPtr = malloc(Size + Alignment - 1);
+    if (!Buffer.AllocatedPtr)
+    {
+        helper::Throw<std::runtime_error>("Toolkit", "format::BP5Deserializer",
+                                          "AcquireDecompressBuffer",
+                                          "cannot allocate " + std::to_string(Size) +
+                                              " bytes to decompress a block into");
+    }
+    Buffer.Ptr = (char *)(((uintptr_t)Buffer.AllocatedPtr + Alignment - 1) & ~(Alignment - 1));
+    Buffer.Size = Size;
+    return Buffer;
+}
+
+void BP5Deserializer::ReleaseDecompressBuffer(DecompressBuffer &Buffer)
+{
+    if (!Buffer.AllocatedPtr)
+    {
+        return;
+    }
+    if (m_DecompressThreads == 0)
+    {
+        // a single decompressing thread has nothing to share buffers with
+        free(Buffer.AllocatedPtr);
+        Buffer = DecompressBuffer();
+        return;
+    }
+    std::lock_guard<std::mutex> lockGuard(mutexDecompressBuffers);
+    m_DecompressBuffers.push_back(Buffer);
+    Buffer = DecompressBuffer();
+
+    // one buffer for each thread that may be decompressing, drop the smallest
+    const size_t Keep = m_DecompressThreads + 1;
+    if (m_DecompressBuffers.size() > Keep)
+    {
+        auto smallest = std::min_element(
+            m_DecompressBuffers.begin(), m_DecompressBuffers.end(),
+            [](const DecompressBuffer &a, const DecompressBuffer &b) { return a.Size < b.Size; });
+        free(smallest->AllocatedPtr);
+        *smallest = m_DecompressBuffers.back();
+        m_DecompressBuffers.pop_back();
+    }
+}
+
+void BP5Deserializer::ReleaseDecompressBuffers()
+{
+    std::lock_guard<std::mutex> lockGuard(mutexDecompressBuffers);
+    for (auto &Buffer : m_DecompressBuffers)
+    {
+        free(Buffer.AllocatedPtr);
+    }
+    m_DecompressBuffers.clear();
+}
+
+bool BP5Deserializer::NeedsDecompression(const ReadRequest &Read) const
+{
+    auto VarRec = (struct BP5VarRec *)PendingGetRequests[Read.ReqIndex].VarRec;
+    return !Read.DirectToAppMemory && !VarRec->Derived && (VarRec->Operator != NULL);
+}
+
 BP5Deserializer::~BP5Deserializer()
 {
+    ReleaseDecompressBuffers();
     struct ControlInfo *tmp = ControlBlocks;
     free_FFSContext(ReaderFFSContext);
     ControlBlocks = NULL;
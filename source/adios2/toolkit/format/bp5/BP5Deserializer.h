@@ -19,7 +19,11 @@
 #include "ffs.h"
 #include "fm.h"
 
+#include <deque>
+#include <map>
 #include <mutex>
+#include <tuple>
+#include <vector>
 
 #ifdef _WIN32
 #pragma warning(disable : 4250)
@@ -52,6 +56,9 @@ public:
         size_t ReqIndex;
         size_t OffsetInBlock;
         size_t BlockID;
+        // operated blocks: this many bytes from the block start are already in
+        // the prefix cache, StartOffset/ReadLength cover the rest
+        size_t CachedLength = 0;
     };
     void InstallMetaMetaData(MetaMetaInfoBlock &MMList);
     void InstallMetaData(void *MetadataBlock, size_t BlockLen, size_t WriterRank,
@@ -65,6 +72,21 @@ public:
     void InstallMetadataBuffer(void *MetadataBuffer, size_t WriterRank, size_t Step,
                                FFSTypeHandle FFSFormat);
 
+    /** The metadata record of a tagged block of a file written with
+     * MetadataDeltaKeyframe, rebuilt from a delta against the previous
+     * record of WriterRank if needed. Blocks of each writer must come in step
+     * order. BlockLen becomes the record length. With CopyRecord a keyframe
+     * record is copied too, for a block that must not be decoded where it is */
+    char *ExpandMetadata(char *MetadataBlock, size_t &BlockLen, const size_t WriterRank,
+                         const bool CopyRecord = false);
+
+    /** A private copy of a block that must not be decoded where it is, kept
+     * as long as an expanded record would be */
+    char *PrivateMetadataCopy(const char *MetadataBlock, const size_t BlockLen);
+
+    /** bytes of the expanded and copied records and of the delta bases */
+    size_t PrivateMetadataSize() const noexcept;
+
     void SetupForStep(size_t Step, size_t WriterCount);
     // return from QueueGet is true if a sync is needed to fill the data
     bool QueueGet(core::VariableBase &variable, void *DestData, const core::Selection &selection,
@@ -84,6 +106,20 @@ public:
     void FinalizeGets(std::vector<ReadRequest> &);
     void FinalizeDerivedGets(std::vector<ReadRequest> &);
     void ClearGetState();
+    /** True if FinalizeGet of this read runs an operator on the data */
+    bool NeedsDecompression(const ReadRequest &Read) const;
+
+    /** Threads the engine decompresses blocks with, also passed on to the
+     * operators as "nthreads" for their own intra-block parallelism */
+    size_t m_DecompressThreads = 0;
+
+    /** Bytes of partially read operated blocks kept between PerformGets for
+     * tighter accuracies, see m_PrefixCache */
+    size_t m_PrefixCacheSize = 64 * 1024 * 1024;
+
+    /** Threads FinalizeGet may split a large copy into the user's memory
+     * over, set by the engine when it is not finalizing reads in parallel */
+    size_t m_CopyThreads = 1;
 
     MinVarInfo *AllRelativeStepsMinBlocksInfo(const VariableBase &var);
     MinVarInfo *AllStepsMinBlocksInfo(const VariableBase &var);
@@ -146,6 +182,7 @@ private:
         DataType Type;
         int ElementSize = 0;
         size_t MinMaxOffset = SIZE_MAX;
+        size_t LevelsOffset = SIZE_MAX; // accuracy levels of the operator, if any
         size_t *GlobalDims = NULL;
         size_t LastTSAdded = SIZE_MAX;
         size_t FirstTSSeen = SIZE_MAX;
@@ -202,6 +239,12 @@ private:
 
     size_t m_LastAttrStep = MaxSizeT; // invalid timestep for start
 
+    // delta-encoded metadata: the last record of each writer rank, and the
+    // records rebuilt from deltas or copied out of read only memory, which
+    // are decoded in place like blocks
+    std::vector<std::vector<char>> m_MetadataDeltaBase;
+    std::deque<std::vector<char>> m_ExpandedMetadata;
+
     std::unordered_map<std::string, BP5VarRec *> VarByName;
     std::unordered_map<void *, BP5VarRec *> VarByKey;
 
@@ -231,7 +274,7 @@ private:
     BP5VarRec *CreateVarRec(const char *ArrayName);
     void ReverseDimensions(size_t *Dimensions, size_t count, size_t times);
     const char *BreakdownVarName(const char *Name, DataType *type_p, int *element_size_p);
-    void BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax);
+    void BreakdownFieldType(const char *FieldType, bool &Operator, bool &MinMax, bool &Levels);
     void BreakdownArrayName(const char *Name, char **base_name_p, DataType *type_p,
                             int *element_size_p, FMFormat *Format);
     void BreakdownV1ArrayName(const char *Name, char **base_name_p, DataType *type_p,
@@ -250,6 +293,9 @@ private:
                         size_t RelStep, const core::Selection &selection);
     bool QueueGetSingleRemote(core::VariableBase &variable, void *DestData, size_t RelStep,
                               size_t StepCount, const core::Selection &selection);
+    /** Redirects a Get with a level of detail to the coarse companion variable */
+    bool QueueGetLevelOfDetail(core::VariableBase &variable, void *DestData,
+                               const core::Selection &selection, bool dataIsRemote);
     void StructQueueReadChecks(core::VariableStruct *variable, BP5VarRec *VarRec);
 
     void *GetMetadataBase(BP5VarRec *VarRec, size_t Step, size_t WriterRank) const;
@@ -259,9 +305,45 @@ private:
     size_t CurTimestep = 0;
 
     /* We assume operators are not thread-safe, call Decompress() one at a time
+     * unless Operator::IsInverseThreadSafe() says otherwise
      */
     std::mutex mutexDecompress;
 
+    /* Decompression targets, cache line aligned. With DecompressThreads they
+     * are recycled across the FinalizeGet calls of one PerformGets instead of
+     * allocated for every block, ClearGetState frees them
+     */
+    struct DecompressBuffer
+    {
+        void *AllocatedPtr = nullptr;
+        char *Ptr = nullptr;
+        size_t Size = 0;
+    };
+    std::vector<DecompressBuffer> m_DecompressBuffers;
+    std::mutex mutexDecompressBuffers;
+    DecompressBuffer AcquireDecompressBuffer(const size_t Size);
+    void ReleaseDecompressBuffer(DecompressBuffer &Buffer);
+    void ReleaseDecompressBuffers();
+
+    /* Operated blocks read only up to the prefix needed for the requested
+     * accuracy, kept so that a tighter request reads just the rest.
+     * Key is (VarRec, Timestep, WriterRank, BlockID), protected by mutexDecompress.
+     * ClearGetState drops the least recently used entries beyond m_PrefixCacheSize bytes.
+     */
+    struct PrefixCacheEntry
+    {
+        std::vector<char> Data;
+        bool Complete = false; // the whole block was needed, drop in ClearGetState()
+        size_t LastUse = 0;
+    };
+    std::map<std::tuple<void *, size_t, size_t, size_t>, PrefixCacheEntry> m_PrefixCache;
+    size_t m_PrefixCacheBytes = 0;
+    size_t m_PrefixCacheClock = 0;
+
+    /* set StartOffset, ReadLength and CachedLength of a read of an operated block */
+    void SetOperatorReadRange(ReadRequest &RR, const BP5ArrayRequest &Req,
+                              const MetaArrayRecOperator *writer_meta_base, const size_t Block);
+
 public:
     VariableBase *GetVariableBaseFromBP5VarRec(void *VarRec)
     {
@@ -523,6 +523,7 @@ BP5Serializer::BP5WriterRec BP5Serializer::CreateWriterRec(void *Variable, const
     Rec->DimCount = (int)DimCount;
     Rec->Type = (int)Type;
     Rec->OperatorType = NULL;
+    Rec->LevelsOffset = SIZE_MAX;
     char *TextStructID = NULL;
     if (Type == DataType::Struct)
     {
@@ -605,12 +606,22 @@ BP5Serializer::BP5WriterRec BP5Serializer::CreateWriterRec(void *Variable, const
 
         const char *ArrayTypeName = "MetaArray";
         int FieldSize = sizeof(MetaArrayRec);
+        bool AccuracyLevels = false;
         if (VB->m_Operations.size())
         {
             ArrayTypeName = "MetaArrayOp";
             FieldSize = sizeof(MetaArrayRecOperator);
+            // only the element sizes of float, double and their complex types
+            AccuracyLevels = VB->m_Operations[0]->HasAccuracyLevels() &&
+                             ((ElemSize == 4) || (ElemSize == 8) || (ElemSize == 16));
         }
-        if ((m_StatsLevel > 0) && !NeverMinMax)
+        if (AccuracyLevels && ((m_StatsLevel == 0) || NeverMinMax))
+        {
+            Rec->LevelsOffset = offsetof(MetaArrayRecOperatorLv, Levels);
+            AddSimpleField(&Info.MetaFields, &Info.MetaFieldCount, LongName, "MetaArrayOpLv",
+                           sizeof(MetaArrayRecOperatorLv));
+        }
+        else if ((m_StatsLevel > 0) && !NeverMinMax)
         {
             char MMArrayName[40] = {0};
             strcat(MMArrayName, ArrayTypeName);
@@ -634,6 +645,12 @@ BP5Serializer::BP5WriterRec BP5Serializer::CreateWriterRec(void *Variable, const
             }
             Rec->MinMaxOffset = FieldSize;
             FieldSize += sizeof(char *);
+            if (AccuracyLevels)
+            {
+                strcat(MMArrayName, "Lv");
+                Rec->LevelsOffset = offsetof(MetaArrayRecOperatorMMLv, Levels);
+                FieldSize = sizeof(MetaArrayRecOperatorMMLv);
+            }
             AddSimpleField(&Info.MetaFields, &Info.MetaFieldCount, LongName, MMArrayName,
                            FieldSize);
         }
@@ -656,6 +673,28 @@ BP5Serializer::BP5WriterRec BP5Serializer::CreateWriterRec(void *Variable, const
     return Rec;
 }
 
+void BP5Serializer::AppendAccuracyLevels(MetaArrayRec *MetaEntry, const size_t LevelsOffset,
+                                         const std::vector<std::pair<double, size_t>> &Levels)
+{
+    MetaAccuracyLevels *Entry = (MetaAccuracyLevels *)(((char *)MetaEntry) + LevelsOffset);
+    const size_t Block = MetaEntry->BlockCount - 1;
+    const size_t NewCount = Entry->LevelCount + Levels.size();
+    Entry->BlockLevels =
+        (size_t *)realloc(Entry->BlockLevels, MetaEntry->BlockCount * sizeof(size_t));
+    Entry->BlockLevels[Block] = Levels.size();
+    if (Levels.size())
+    {
+        Entry->LevelError = (double *)realloc(Entry->LevelError, NewCount * sizeof(double));
+        Entry->LevelLength = (size_t *)realloc(Entry->LevelLength, NewCount * sizeof(size_t));
+        for (size_t i = 0; i < Levels.size(); i++)
+        {
+            Entry->LevelError[Entry->LevelCount + i] = Levels[i].first;
+            Entry->LevelLength[Entry->LevelCount + i] = Levels[i].second;
+        }
+    }
+    Entry->LevelCount = NewCount;
+}
+
 size_t *BP5Serializer::CopyDims(const size_t Count, const size_t *Vals)
 {
     size_t *Ret = (size_t *)malloc(Count * sizeof(Ret[0]));
@@ -699,6 +738,8 @@ void BP5Serializer::DumpDeferredBlocks(bool forceCopyDeferred)
         MetaEntry->DataBlockLocation[Def.BlockID] = DataOffset;
     }
     DeferredExterns.clear();
+    // the data of deferred Puts is only guaranteed to be there until now
+    CollectPendingMinMax();
 }
 
 static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type, MinMaxStruct &MinMax,
@@ -731,6 +772,86 @@ static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type, M
         MinMax.MaxUnion.field_##N = *res.second;                                                   \
     }
     ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+}
+
+// elements of a block each background Min/Max task gets at least
+static const size_t MinMaxElemsPerTask = 1000000;
+
+/* starts Tasks background computations of the Min/Max of consecutive slices
+ * of a block in host memory */
+static std::vector<std::future<MinMaxStruct>> StartMinMax(const void *Data, const size_t ElemCount,
+                                                          const DataType Type,
+                                                          const size_t ElemSize,
+                                                          const size_t Tasks)
+{
+    std::vector<std::future<MinMaxStruct>> Parts;
+    const size_t PerTask = ElemCount / Tasks;
+    for (size_t t = 0; t < Tasks; ++t)
+    {
+        const char *Start = static_cast<const char *>(Data) + t * PerTask * ElemSize;
+        const size_t Count = (t == Tasks - 1) ? ElemCount - t * PerTask : PerTask;
+        Parts.push_back(std::async(std::launch::async, [Start, Count, Type]() {
+            MinMaxStruct MinMax;
+            GetMinMax(Start, Count, Type, MinMax, MemorySpace::Host);
+            return MinMax;
+        }));
+    }
+    return Parts;
+}
+
+/* waits for the slices of a block and combines their Min/Max */
+static MinMaxStruct JoinMinMax(std::vector<std::future<MinMaxStruct>> &Parts, const DataType Type)
+{
+    MinMaxStruct MinMax = Parts[0].get();
+    for (size_t t = 1; t < Parts.size(); ++t)
+    {
+        const MinMaxStruct Part = Parts[t].get();
+        if (Type == DataType::Struct)
+        {
+        }
+#define pertype(T, N)                                                                              \
+    else if (Type == helper::GetDataType<T>())                                                     \
+    {                                                                                              \
+        if (Part.MinUnion.field_##N < MinMax.MinUnion.field_##N)                                   \
+            MinMax.MinUnion.field_##N = Part.MinUnion.field_##N;                                   \
+        if (MinMax.MaxUnion.field_##N < Part.MaxUnion.field_##N)                                   \
+            MinMax.MaxUnion.field_##N = Part.MaxUnion.field_##N;                                   \
+    }
+        ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+    }
+    return MinMax;
+}
+
+size_t BP5Serializer::StatsTasks(const size_t ElemCount, const MemorySpace MemSpace) const
+{
+    if (m_StatsThreads <= 1 || MemSpace != MemorySpace::Host || ElemCount < MinMaxElemsPerTask)
+    {
+        return 0;
+    }
+    return std::min<size_t>(m_StatsThreads, ElemCount / MinMaxElemsPerTask);
+}
+
+void BP5Serializer::FinishPendingMinMax(PendingMinMax &Pending)
+{
+    const MinMaxStruct MinMax = JoinMinMax(Pending.Parts, Pending.Type);
+    MetaArrayRecMM *MetaEntry = (MetaArrayRecMM *)((char *)(MetadataBuf) + Pending.MetaOffset);
+    void **MMPtrLoc = (void **)(((char *)MetaEntry) + Pending.MinMaxOffset);
+    auto ElemSize = helper::GetDataTypeSize(Pending.Type);
+
+    memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (Pending.BlockNum)), &MinMax.MinUnion, ElemSize);
+    memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (Pending.BlockNum) + 1), &MinMax.MaxUnion,
+           ElemSize);
+}
+
+void BP5Serializer::CollectPendingMinMax()
+{
+    for (auto &Pending : PendingMinMaxes)
+    {
+        FinishPendingMinMax(Pending);
+    }
+    PendingMinMaxes.clear();
 }
 
 void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Type, size_t ElemSize,
@@ -825,16 +946,29 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
 
         MinMaxStruct MinMax;
         MinMax.Init(Type);
+        std::vector<std::pair<double, size_t>> AccuracyLevels;
         bool DerivedWithoutStats = false;
 #ifdef ADIOS2_HAVE_DERIVED_VARIABLE
         DerivedWithoutStats = VD && (VD->GetDerivedType() == DerivedVarType::ExpressionString);
 #endif
         bool DoMinMax =
             ((m_StatsLevel > 0) && !DerivedWithoutStats && TypeHasMinMax((DataType)Rec->Type));
+        // large blocks get their Min/Max in the background, while the data
+        // is copied or compressed below
+        std::vector<std::future<MinMaxStruct>> MinMaxParts;
         if (DoMinMax && !Span)
         {
-            GetMinMax(Data, ElemCount, (DataType)Rec->Type, MinMax, MemSpace);
+            const size_t Tasks = StatsTasks(ElemCount, MemSpace);
+            if (Tasks)
+            {
+                MinMaxParts = StartMinMax(Data, ElemCount, (DataType)Rec->Type, ElemSize, Tasks);
+            }
+            else
+            {
+                GetMinMax(Data, ElemCount, (DataType)Rec->Type, MinMax, MemSpace);
+            }
         }
+        const bool MinMaxPending = !MinMaxParts.empty();
 
         if (Rec->OperatorType)
         {
@@ -857,6 +991,8 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
             VB->m_Operations[0]->AddExtraParameters(operatorParams);
             CompressedSize = VB->m_Operations[0]->Operate((const char *)Data, tmpOffsets, tmpCount,
                                                           (DataType)Rec->Type, CompressedData);
+            if (CompressedSize && (Rec->LevelsOffset != SIZE_MAX))
+                AccuracyLevels = VB->m_Operations[0]->GetAccuracyLevels();
             // if the operator was not applied
             if (CompressedSize == 0)
                 CompressedSize = helper::CopyMemoryWithOpHeader(
@@ -903,6 +1039,8 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
                 OpEntry->DataBlockSize = (size_t *)malloc(sizeof(size_t));
                 OpEntry->DataBlockSize[0] = CompressedSize;
             }
+            if (Rec->LevelsOffset != SIZE_MAX)
+                AppendAccuracyLevels(MetaEntry, Rec->LevelsOffset, AccuracyLevels);
             if (Offsets)
                 MetaEntry->Offsets = CopyDims(DimCount, Offsets);
             else
@@ -911,7 +1049,12 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
             {
                 void **MMPtrLoc = (void **)(((char *)MetaEntry) + Rec->MinMaxOffset);
                 *MMPtrLoc = (void *)malloc(ElemSize * 2);
-                if (!Span)
+                if (MinMaxPending)
+                {
+                    PendingMinMaxes.push_back({std::move(MinMaxParts), (DataType)Rec->Type,
+                                               Rec->MetaOffset, Rec->MinMaxOffset, 0});
+                }
+                else if (!Span)
                 {
                     memcpy(*MMPtrLoc, &MinMax.MinUnion, ElemSize);
                     memcpy(((char *)*MMPtrLoc) + ElemSize, &MinMax.MaxUnion, ElemSize);
@@ -949,11 +1092,19 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
                     (size_t *)realloc(OpEntry->DataBlockSize, OpEntry->BlockCount * sizeof(size_t));
                 OpEntry->DataBlockSize[OpEntry->BlockCount - 1] = CompressedSize;
             }
+            if (Rec->LevelsOffset != SIZE_MAX)
+                AppendAccuracyLevels(MetaEntry, Rec->LevelsOffset, AccuracyLevels);
             if (DoMinMax)
             {
                 void **MMPtrLoc = (void **)(((char *)MetaEntry) + Rec->MinMaxOffset);
                 *MMPtrLoc = (void *)realloc(*MMPtrLoc, MetaEntry->BlockCount * ElemSize * 2);
-                if (!Span)
+                if (MinMaxPending)
+                {
+                    PendingMinMaxes.push_back({std::move(MinMaxParts), (DataType)Rec->Type,
+                                               Rec->MetaOffset, Rec->MinMaxOffset,
+                                               MetaEntry->BlockCount - 1});
+                }
+                else if (!Span)
                 {
                     memcpy(((char *)*MMPtrLoc) + ElemSize * (2 * (MetaEntry->BlockCount - 1)),
                            &MinMax.MinUnion, ElemSize);
@@ -977,6 +1128,12 @@ void BP5Serializer::Marshal(void *Variable, const char *Name, const DataType Typ
                 MetaEntry->Offsets =
                     AppendDims(MetaEntry->Offsets, PreviousDBCount, DimCount, Offsets);
         }
+        if (MinMaxPending && Sync)
+        {
+            // the application may reuse the data once a sync Put returns
+            FinishPendingMinMax(PendingMinMaxes.back());
+            PendingMinMaxes.pop_back();
+        }
     }
 }
 
@@ -1256,7 +1413,17 @@ void BP5Serializer::ProcessDeferredMinMax()
         MinMaxStruct MinMax;
         MinMax.Init(Def.Type);
         void *Ptr = reinterpret_cast<void *>(GetPtr(Def.Data.bufferIdx, Def.Data.posInBuffer));
-        GetMinMax(Ptr, Def.ElemCount, Def.Type, MinMax, Def.MemSpace);
+        const size_t Tasks = StatsTasks(Def.ElemCount, Def.MemSpace);
+        if (Tasks)
+        {
+            auto Parts = StartMinMax(Ptr, Def.ElemCount, Def.Type,
+                                     helper::GetDataTypeSize(Def.Type), Tasks);
+            MinMax = JoinMinMax(Parts, Def.Type);
+        }
+        else
+        {
+            GetMinMax(Ptr, Def.ElemCount, Def.Type, MinMax, Def.MemSpace);
+        }
 
         MetaArrayRecMM *MetaEntry = (MetaArrayRecMM *)((char *)(MetadataBuf) + Def.MetaOffset);
         void **MMPtrLoc = (void **)(((char *)MetaEntry) + Def.MinMaxOffset);
@@ -1336,6 +1503,13 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep, bool forc
             {"MetaArrayMM16", MetaArrayRecMM16ListPtr, sizeof(MetaArrayRecMM), NULL},
             {"MetaArrayOpMM16", MetaArrayRecOperatorMM16ListPtr, sizeof(MetaArrayRecOperatorMM),
              NULL},
+            {"MetaArrayOpLv", MetaArrayRecOperatorLvListPtr, sizeof(MetaArrayRecOperatorLv), NULL},
+            {"MetaArrayOpMM4Lv", MetaArrayRecOperatorMM4LvListPtr,
+             sizeof(MetaArrayRecOperatorMMLv), NULL},
+            {"MetaArrayOpMM8Lv", MetaArrayRecOperatorMM8LvListPtr,
+             sizeof(MetaArrayRecOperatorMMLv), NULL},
+            {"MetaArrayOpMM16Lv", MetaArrayRecOperatorMM16LvListPtr,
+             sizeof(MetaArrayRecOperatorMMLv), NULL},
             {NULL, NULL, 0, NULL}};
         struct_list[0].format_name = "MetaData";
         struct_list[0].field_list = Info.MetaFields;
@@ -1410,6 +1584,12 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep, bool forc
     CollectFinalShapeValues();
 
     void *MetaDataBlock = FFSencode(MetaEncodeBuffer, Info.MetaFormat, MetadataBuf, &MetaDataSize);
+    if (m_MetadataDeltaKeyframe > 0)
+    {
+        DeltaEncodeMetadata(static_cast<const char *>(MetaDataBlock), MetaDataSize);
+        MetaDataBlock = m_MetadataDeltaBlock.data();
+        MetaDataSize = m_MetadataDeltaBlock.size();
+    }
     BufferFFS *Metadata = new BufferFFS(MetaEncodeBuffer, MetaDataBlock, MetaDataSize);
 
     BufferFFS *AttrData = NULL;
@@ -1491,6 +1671,27 @@ BP5Serializer::TimestepInfo BP5Serializer::CloseTimestep(int timestep, bool forc
     return Ret;
 }
 
+void BP5Serializer::DeltaEncodeMetadata(const char *Record, const size_t Size)
+{
+    bool Keyframe = (m_MetadataDeltaCount++ % m_MetadataDeltaKeyframe == 0) ||
+                    (m_MetadataDeltaBase.size() != Size);
+    m_MetadataDeltaBlock.assign(MetadataTagSize, 0);
+    if (!Keyframe)
+    {
+        EncodeMetadataDelta(m_MetadataDeltaBase.data(), Record, Size, m_MetadataDeltaBlock);
+        Keyframe = (m_MetadataDeltaBlock.size() >= MetadataTagSize + Size);
+    }
+    if (Keyframe)
+    {
+        m_MetadataDeltaBlock.resize(MetadataTagSize);
+        m_MetadataDeltaBlock.insert(m_MetadataDeltaBlock.end(), Record, Record + Size);
+    }
+    PutMetadataTag(m_MetadataDeltaBlock.data(), Keyframe ? MetadataKeyframe : MetadataDelta, Size);
+    // metadata aggregation sends whole 8 byte words
+    m_MetadataDeltaBlock.resize((m_MetadataDeltaBlock.size() + 7) & ~static_cast<size_t>(7), 0);
+    m_MetadataDeltaBase.assign(Record, Record + Size);
+}
+
 std::vector<char> BP5Serializer::CopyMetadataToContiguous(
     const std::vector<BP5Base::MetaMetaInfoBlock> NewMetaMetaBlocks,
     const std::vector<core::iovec> &MetaEncodeBuffers,
@@ -21,6 +21,7 @@
 #pragma warning(disable : 4250)
 #endif
 
+#include <future>
 #include <unordered_map>
 
 namespace adios2
@@ -134,9 +135,19 @@ public:
 
     int m_StatsLevel = 1;
 
+    /* Min/Max of large blocks in host memory are computed by up to this many
+     * background tasks, overlapping the copy of the data, and collected when
+     * the deferred blocks are dumped. 0 or 1 computes them in Marshal */
+    unsigned int m_StatsThreads = 1;
+
     /* Variables to help appending to existing file */
     size_t m_PreMetaMetadataFileLength = 0;
 
+    /* 0: metadata blocks are the encoded records. K > 0: blocks are tagged,
+     * every K-th one is a keyframe and the others are deltas against the
+     * previous record when that is smaller */
+    size_t m_MetadataDeltaKeyframe = 0;
+
     size_t m_BufferAlign = 1; // align buffers in memory
     // force buffer sizes to integer multiples of block size.
     // size once was sizeof(max_align_t), changed for predictability across platforms
@@ -155,6 +166,7 @@ private:
         int DimCount;
         int Type;
         size_t MinMaxOffset;
+        size_t LevelsOffset; // SIZE_MAX if the operator has no accuracy levels
     } *BP5WriterRec;
 
     struct FFSWriterMarshalBase
@@ -197,6 +209,23 @@ private:
     };
     std::vector<DeferredSpanMinMax> DefSpanMinMax;
 
+    struct PendingMinMax
+    {
+        std::vector<std::future<MinMaxStruct>> Parts;
+        DataType Type;
+        size_t MetaOffset;
+        size_t MinMaxOffset;
+        size_t BlockNum;
+    };
+    std::vector<PendingMinMax> PendingMinMaxes;
+
+    /* number of background tasks for the Min/Max of a block, 0 to compute
+     * it right away */
+    size_t StatsTasks(const size_t ElemCount, const MemorySpace MemSpace) const;
+    void FinishPendingMinMax(PendingMinMax &Pending);
+    /* waits for all background Min/Max and stores them in the metadata */
+    void CollectPendingMinMax();
+
     BP5AttrStruct *PendingAttrs = nullptr;
 
     FFSWriterMarshalBase Info;
@@ -210,6 +239,13 @@ private:
 
     size_t m_PriorDataBufferSizeTotal = 0;
 
+    /* the previous metadata record, and the tagged block sent in place of
+     * the current one, valid until the next CloseTimestep */
+    std::vector<char> m_MetadataDeltaBase;
+    std::vector<char> m_MetadataDeltaBlock;
+    size_t m_MetadataDeltaCount = 0;
+    void DeltaEncodeMetadata(const char *Record, const size_t Size);
+
     BP5WriterRec LookupWriterRec(void *Key) const;
     BP5WriterRec CreateWriterRec(void *Variable, const char *Name, DataType Type, size_t ElemSize,
                                  size_t DimCount);
@@ -234,6 +270,8 @@ private:
     char *BuildArrayDBCountName(const char *base_name, const int type, const int element_size);
     char *BuildArrayBlockCountName(const char *base_name, const int type, const int element_size);
     char *TranslateADIOS2Type2FFS(const DataType Type);
+    void AppendAccuracyLevels(MetaArrayRec *MetaEntry, const size_t LevelsOffset,
+                              const std::vector<std::pair<double, size_t>> &Levels);
     size_t *CopyDims(const size_t Count, const size_t *Vals);
     size_t *AppendDims(size_t *OldDims, const size_t OldCount, const size_t Count,
                        const size_t *Vals);
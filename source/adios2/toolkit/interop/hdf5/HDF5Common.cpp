@@ -109,7 +109,10 @@ void HDF5Common::ParseParameters(core::IO &io)
         if (itKey != io.m_Parameters.end())
         {
             if (itKey->second == "yes" || itKey->second == "true")
+            {
                 m_MPI->set_dxpl_mpio(m_PropertyTxfID, H5FD_MPIO_COLLECTIVE);
+                m_CollectiveIO = true;
+            }
         }
 
         itKey = io.m_Parameters.find(PARAMETER_HAS_IDLE_WRITER_RANK);
@@ -121,6 +124,7 @@ void HDF5Common::ParseParameters(core::IO &io)
     }
 
     m_ChunkVarNames.clear();
+    m_DatasetLayouts.clear();
     m_ChunkPID = -1;
     m_ChunkDim = 0;
 
@@ -205,6 +209,7 @@ void HDF5Common::Append(const std::string &name, helper::Comm const &comm)
         if (mpi && mpi->init(comm, m_PropertyListId, &m_CommRank, &m_CommSize))
         {
             m_MPI = mpi;
+            m_Comm = &comm;
         }
     }
 
@@ -252,6 +257,7 @@ void HDF5Common::Init(const std::string &name, helper::Comm const &comm, bool to
         if (mpi && mpi->init(comm, m_PropertyListId, &m_CommRank, &m_CommSize))
         {
             m_MPI = mpi;
+            m_Comm = &comm;
         }
     }
 
@@ -835,6 +841,9 @@ void HDF5Common::Close()
         return;
     }
 
+    // writes not performed by the engine are dropped, not attempted here
+    DiscardDeferredWrites();
+
     WriteAdiosSteps();
 
     if (m_GroupId >= 0)
@@ -1047,10 +1056,16 @@ hid_t HDF5Common::GetTypeStringScalar(const std::string &input)
     return type;
 }
 
-void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type, hid_t filespaceID,
-                               std::vector<hid_t> &datasetChain)
+const HDF5Common::DatasetLayout &HDF5Common::GetDatasetLayout(const std::string &varName)
 {
-    std::vector<std::string> list;
+    auto it = m_DatasetLayouts.find(varName);
+    if (it != m_DatasetLayouts.end())
+    {
+        return it->second;
+    }
+
+    DatasetLayout layout;
+    std::vector<std::string> &list = layout.Path;
     char delimiter = '/';
     int delimiterLength = 1;
     std::string s = std::string(varName);
@@ -1067,6 +1082,22 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type, hid_t f
     }
     list.push_back(s);
 
+    if (-1 != m_ChunkPID)
+    {
+        if (m_ChunkVarNames.size() == 0) // applies to all var
+            layout.CreateProperty = m_ChunkPID;
+        else if (m_ChunkVarNames.find(varName) != m_ChunkVarNames.end())
+            layout.CreateProperty = m_ChunkPID;
+    }
+    return m_DatasetLayouts.emplace(varName, std::move(layout)).first->second;
+}
+
+void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type, hid_t filespaceID,
+                               std::vector<hid_t> &datasetChain)
+{
+    const DatasetLayout &layout = GetDatasetLayout(varName);
+    const std::vector<std::string> &list = layout.Path;
+
     hid_t topId = m_GroupId;
     if (list.size() > 1)
     {
@@ -1084,14 +1115,7 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type, hid_t f
         }
     }
 
-    hid_t varCreateProperty = H5P_DEFAULT;
-    if (-1 != m_ChunkPID)
-    {
-        if (m_ChunkVarNames.size() == 0) // applies to all var
-            varCreateProperty = m_ChunkPID;
-        else if (m_ChunkVarNames.find(varName) != m_ChunkVarNames.end())
-            varCreateProperty = m_ChunkPID;
-    }
+    hid_t varCreateProperty = layout.CreateProperty;
 
     /*
     hid_t dsetID = H5Dcreate(topId, list.back().c_str(), h5Type, filespaceID,
@@ -1114,6 +1138,113 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type, hid_t f
     datasetChain.push_back(dsetID);
 }
 
+hid_t HDF5Common::GetStepDataset(const std::string &varName, hid_t h5Type, hid_t filespaceID)
+{
+    auto it = m_StepDatasets.find(varName);
+    if (it != m_StepDatasets.end())
+    {
+        return it->second.back();
+    }
+    std::vector<hid_t> chain;
+    CreateDataset(varName, h5Type, filespaceID, chain);
+    if (chain.back() < 0)
+    {
+        HDF5DatasetGuard g(chain);
+        helper::Throw<std::ios_base::failure>("Toolkit", "interop::hdf5::HDF5Common",
+                                              "GetStepDataset",
+                                              "unable to create dataset " + varName);
+    }
+    return m_StepDatasets.emplace(varName, std::move(chain)).first->second.back();
+}
+
+void HDF5Common::CloseStepDatasets()
+{
+    for (auto &it : m_StepDatasets)
+    {
+        HDF5DatasetGuard g(it.second);
+    }
+    m_StepDatasets.clear();
+}
+
+void HDF5Common::DiscardDeferredWrites()
+{
+    for (auto &w : m_DeferredWrites)
+    {
+        if (w.MemSpace != H5S_ALL)
+            H5Sclose(w.MemSpace);
+        if (w.FileSpace != H5S_ALL)
+            H5Sclose(w.FileSpace);
+    }
+    m_DeferredWrites.clear();
+    CloseStepDatasets();
+}
+
+void HDF5Common::PerformWrites()
+{
+#if H5_VERSION_GE(1, 14, 0)
+    // collective transfers need the same calls on every rank, so all ranks
+    // must pick the same path, also those with nothing to write
+    bool writeMulti = (m_DeferredWrites.size() > 1);
+    if (m_CollectiveIO && m_Comm && m_CommSize > 1)
+    {
+        const int local = writeMulti ? 1 : 0;
+        int all = 0;
+        m_Comm->Allreduce(&local, &all, 1, helper::Comm::Op::Min);
+        writeMulti = (all != 0);
+    }
+#endif
+
+    if (m_DeferredWrites.empty())
+    {
+        CloseStepDatasets();
+        return;
+    }
+
+    herr_t status = 0;
+#if H5_VERSION_GE(1, 14, 0)
+    if (writeMulti)
+    {
+        // one (collective) transfer for all datasets of this flush
+        const size_t count = m_DeferredWrites.size();
+        std::vector<hid_t> datasets, memTypes, memSpaces, fileSpaces;
+        std::vector<const void *> buffers;
+        datasets.reserve(count);
+        memTypes.reserve(count);
+        memSpaces.reserve(count);
+        fileSpaces.reserve(count);
+        buffers.reserve(count);
+        for (const auto &w : m_DeferredWrites)
+        {
+            datasets.push_back(w.Dataset);
+            memTypes.push_back(w.MemType);
+            memSpaces.push_back(w.MemSpace);
+            fileSpaces.push_back(w.FileSpace);
+            buffers.push_back(w.Data);
+        }
+        status = H5Dwrite_multi(count, datasets.data(), memTypes.data(), memSpaces.data(),
+                                fileSpaces.data(), m_PropertyTxfID, buffers.data());
+    }
+    else
+#endif
+    {
+        for (const auto &w : m_DeferredWrites)
+        {
+            if (H5Dwrite(w.Dataset, w.MemType, w.MemSpace, w.FileSpace, m_PropertyTxfID, w.Data) <
+                0)
+            {
+                status = -1;
+            }
+        }
+    }
+
+    DiscardDeferredWrites();
+    if (status < 0)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "interop::hdf5::HDF5Common",
+                                              "PerformWrites", "HDF5 file Write failed");
+    }
+}
+
 void HDF5Common::StoreADIOSName(const std::string adiosName, hid_t dsetID)
 {
     hid_t attrSpace = H5Screate(H5S_SCALAR);
@@ -1863,7 +1994,8 @@ void HDF5Common::CheckVariableOperations(const core::VariableBase &variable) con
 }
 
 #define declare_template_instantiation(T)                                                          \
-    template void HDF5Common::Write(core::Variable<T> &, const T *);
+    template void HDF5Common::Write(core::Variable<T> &, const T *);                               \
+    template void HDF5Common::WriteDeferred(core::Variable<T> &, const T *);
 
 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
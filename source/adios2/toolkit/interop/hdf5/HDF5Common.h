@@ -14,6 +14,8 @@
 #include <hdf5.h>
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/common/ADIOSTypes.h"
@@ -135,6 +137,21 @@ public:
     template <class T>
     void Write(core::Variable<T> &variable, const T *values);
 
+    /*
+     * Creates (or reuses) the dataset and selections for a Put now, but only
+     * queues the data transfer. values must stay valid until PerformWrites()
+     */
+    template <class T>
+    void WriteDeferred(core::Variable<T> &variable, const T *values);
+
+    /*
+     * Issues all queued writes, in one H5Dwrite_multi call if the HDF5
+     * library supports it, then closes the datasets opened for them.
+     * Collective when the transfer is collective: the ranks agree on using
+     * H5Dwrite_multi, it is used only if every rank has several writes
+     */
+    void PerformWrites();
+
     /*
      * This function will define a non string variable to HDF5
      * note that define a dataset in HDF5 means allocate space and place an
@@ -260,8 +277,10 @@ private:
     size_t m_NumAdiosSteps = 0;
 
     MPI_API const *m_MPI = nullptr;
+    helper::Comm const *m_Comm = nullptr; // the engine's, set with m_MPI
     int m_CommRank = 0;
     int m_CommSize = 1;
+    bool m_CollectiveIO = false;
 
     template <class T>
     void AddBlockInfo(const core::Variable<T> &varaible, hid_t parentId);
@@ -278,6 +297,35 @@ private:
     // Some write rank can be idle. This causes conflict with HDF5 collective
     // requirement in functions Guard this by load vars in beginStep
     bool m_IdleWriterOn = false;
+
+    /* one queued H5Dwrite, the spaces are owned here */
+    struct DeferredWrite
+    {
+        hid_t Dataset = -1;
+        hid_t MemType = -1;
+        hid_t MemSpace = H5S_ALL;
+        hid_t FileSpace = H5S_ALL;
+        const void *Data = nullptr;
+        std::vector<char> Copy; // contiguous copy if the Put had a memory selection
+    };
+    std::vector<DeferredWrite> m_DeferredWrites;
+
+    // datasets of the current step kept open for more deferred blocks,
+    // each entry is the chain from CreateDataset (groups, then dataset)
+    std::unordered_map<std::string, std::vector<hid_t>> m_StepDatasets;
+
+    /* group path and creation property of a variable, same in every step */
+    struct DatasetLayout
+    {
+        std::vector<std::string> Path;
+        hid_t CreateProperty = H5P_DEFAULT;
+    };
+    std::unordered_map<std::string, DatasetLayout> m_DatasetLayouts;
+
+    const DatasetLayout &GetDatasetLayout(const std::string &varName);
+    hid_t GetStepDataset(const std::string &varName, hid_t h5Type, hid_t filespaceID);
+    void CloseStepDatasets();
+    void DiscardDeferredWrites();
 };
 
 } // end namespace interop
@@ -260,6 +260,70 @@ void HDF5Common::Write(core::Variable<T> &variable, const T *values)
     H5Sclose(memSpace);
 }
 
+template <class T>
+void HDF5Common::WriteDeferred(core::Variable<T> &variable, const T *values)
+{
+    if (std::is_same<T, std::string>::value)
+    {
+        // the string datatype depends on the value, write it now
+        Write(variable, values);
+        return;
+    }
+
+    CheckWriteGroup();
+    CheckVariableOperations(variable);
+    size_t dimSize = std::max(variable.m_Shape.size(), variable.m_Count.size());
+
+    DeferredWrite w;
+    w.MemType = GetHDF5Type<T>();
+    w.Data = values;
+
+    if (dimSize == 0)
+    {
+        hid_t filespaceID = H5Screate(H5S_SCALAR);
+        HDF5TypeGuard g0(filespaceID, E_H5_SPACE);
+        w.Dataset = GetStepDataset(variable.m_Name, w.MemType, filespaceID);
+        m_DeferredWrites.push_back(std::move(w));
+        return;
+    }
+
+    std::vector<hsize_t> dimsf, count, offset;
+    GetHDF5SpaceSpec(variable, dimsf, count, offset);
+
+    size_t max_int = static_cast<size_t>(std::numeric_limits<int>::max());
+    if (dimSize > max_int)
+    {
+        helper::Throw<std::overflow_error>("Toolkit", "interop::hdf5::HDF5Common",
+                                           "WriteDeferred",
+                                           "dimSize is too large "
+                                           "to be represented by an int");
+    }
+
+    {
+        hid_t fileSpace = H5Screate_simple(static_cast<int>(dimSize), dimsf.data(), NULL);
+        HDF5TypeGuard fs(fileSpace, E_H5_SPACE);
+        w.Dataset = GetStepDataset(variable.m_Name, w.MemType, fileSpace);
+    }
+
+    w.MemSpace = H5Screate_simple(static_cast<int>(dimSize), count.data(), NULL);
+    w.FileSpace = H5Dget_space(w.Dataset);
+    H5Sselect_hyperslab(w.FileSpace, H5S_SELECT_SET, offset.data(), NULL, count.data(), NULL);
+
+    if (!variable.m_MemoryStart.empty())
+    {
+        auto blockSize = helper::GetTotalSize(variable.m_Count);
+        w.Copy.resize(blockSize * sizeof(T));
+        T *k = reinterpret_cast<T *>(w.Copy.data());
+
+        adios2::Dims zero(variable.m_Start.size(), 0);
+        helper::CopyMemoryBlock(k, zero, variable.m_Count, true, values, zero, variable.m_Count,
+                                true, false, Dims(), Dims(), variable.m_MemoryStart,
+                                variable.m_MemoryCount);
+        w.Data = w.Copy.data();
+    }
+    m_DeferredWrites.push_back(std::move(w));
+}
+
 template <class T>
 void HDF5Common::AddStats(const core::Variable<T> &variable, hid_t parentId, std::vector<T> &stats)
 {
@@ -16,7 +16,7 @@ namespace adios2
 namespace profiling
 {
 
-void IOChrono::Start(const std::string process) noexcept
+void IOChrono::Start(const std::string &process) noexcept
 {
     if (m_IsActive)
     {
@@ -33,7 +33,7 @@ void IOChrono::Start(const std::string process) noexcept
     }
 }
 
-void IOChrono::Stop(const std::string process)
+void IOChrono::Stop(const std::string &process)
 {
     if (m_IsActive)
     {
@@ -94,10 +94,93 @@ JSONProfiler::JSONProfiler(helper::Comm const &comm) : m_Comm(comm)
     m_RankMPI = m_Comm.Rank();
 }
 
-void JSONProfiler::AddTimerWatch(const std::string &name, const bool trace)
+TraceEventID JSONProfiler::AddTimerWatch(const std::string &name, const bool trace)
 {
     const TimeUnit timerUnit = DefaultTimeUnitEnum;
-    m_Profiler.m_Timers.emplace(name, profiling::Timer(name, timerUnit, trace));
+    auto it = m_Profiler.m_Timers.emplace(name, profiling::Timer(name, timerUnit, trace)).first;
+    const TraceEventID id = Intern(name);
+    m_TimersByID[id] = &it->second;
+    return id;
+}
+
+TraceEventID JSONProfiler::Intern(const std::string &process)
+{
+    auto it = m_IDs.find(process);
+    if (it != m_IDs.end())
+    {
+        return it->second;
+    }
+    const TraceEventID id = m_Tracer.Intern(process);
+    m_IDs.emplace(process, id);
+    if (id >= m_TimersByID.size())
+    {
+        m_TimersByID.resize(id + 1, nullptr);
+        m_BytesByID.resize(id + 1, nullptr);
+    }
+    return id;
+}
+
+void JSONProfiler::Start(const TraceEventID id)
+{
+    if (id >= m_TimersByID.size())
+    {
+        m_TimersByID.resize(id + 1, nullptr);
+        m_BytesByID.resize(id + 1, nullptr);
+    }
+    Timer *&timer = m_TimersByID[id];
+    if (timer)
+    {
+        timer->Resume();
+    }
+    else
+    {
+        // first use, let IOChrono add the timer if it isn't watched yet
+        const std::string process = m_Tracer.EventName(id);
+        m_Profiler.Start(process);
+        auto it = m_Profiler.m_Timers.find(process);
+        if (it != m_Profiler.m_Timers.end())
+        {
+            timer = &it->second;
+        }
+    }
+    m_Tracer.Begin(id);
+}
+
+void JSONProfiler::Stop(const TraceEventID id)
+{
+    m_Tracer.End(id);
+    Timer *timer = (id < m_TimersByID.size() ? m_TimersByID[id] : nullptr);
+    if (timer)
+    {
+        try
+        {
+            timer->Pause();
+        }
+        catch (...)
+        {
+            std::cout << "Timer \"" << timer->m_Process << "\" wasn't started." << std::endl;
+        }
+    }
+    else
+    {
+        m_Profiler.Stop(m_Tracer.EventName(id));
+    }
+}
+
+void JSONProfiler::AddBytes(const TraceEventID id, size_t bytes)
+{
+    if (id >= m_BytesByID.size())
+    {
+        m_TimersByID.resize(id + 1, nullptr);
+        m_BytesByID.resize(id + 1, nullptr);
+    }
+    size_t *&counter = m_BytesByID[id];
+    if (!counter)
+    {
+        counter = &m_Profiler.m_Bytes[m_Tracer.EventName(id)];
+    }
+    *counter += bytes;
+    m_Tracer.Counter(id, bytes);
 }
 
 std::string JSONProfiler::GetRankProfilingJSON(
@@ -19,6 +19,7 @@
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/helper/adiosComm.h"
 #include "adios2/toolkit/profiling/iochrono/Timer.h"
+#include "adios2/toolkit/profiling/iochrono/TraceRecorder.h"
 
 namespace adios2
 {
@@ -50,13 +51,13 @@ public:
     ~IOChrono() = default;
 
     /** Start existing process in m_Timers */
-    void Start(const std::string process) noexcept;
+    void Start(const std::string &process) noexcept;
 
     /**
      * Stop existing process in m_Timers
      * @throws std::invalid_argument if Start wasn't called
      * */
-    void Stop(const std::string process);
+    void Stop(const std::string &process);
 };
 
 class JSONProfiler
@@ -64,14 +65,33 @@ class JSONProfiler
 public:
     JSONProfiler(helper::Comm const &comm);
     void Gather();
-    void AddTimerWatch(const std::string &, const bool trace = false);
+    /** Adds a timer, returns its ID, see Intern */
+    TraceEventID AddTimerWatch(const std::string &, const bool trace = false);
 
-    void Start(const std::string process) { m_Profiler.Start(process); };
-    void Stop(const std::string process) { m_Profiler.Stop(process); };
-    void AddBytes(const std::string process, size_t bytes)
-    {
-        m_Profiler.m_Bytes[process] += bytes;
-    };
+    void Start(const std::string &process) { Start(Intern(process)); };
+    void Stop(const std::string &process) { Stop(Intern(process)); };
+    void AddBytes(const std::string &process, size_t bytes) { AddBytes(Intern(process), bytes); };
+
+    /**
+     * Returns the ID of a timer or byte counter name. Using the ID avoids the
+     * name lookup in Start/Stop/AddBytes, intern hot-path names once. Names
+     * seen before are found without locking the trace recorder.
+     */
+    TraceEventID Intern(const std::string &process);
+
+    void Start(const TraceEventID id);
+    void Stop(const TraceEventID id);
+    void AddBytes(const TraceEventID id, size_t bytes);
+
+    /** Start binary tracing of timers and of worker threads using Tracer() */
+    void EnableTrace(const size_t recordsPerThread) { m_Tracer.Enable(recordsPerThread); }
+    bool IsTraceEnabled() const noexcept { return m_Tracer.IsEnabled(); }
+
+    /** Recorder for worker threads, which must not touch the timers */
+    TraceRecorder &Tracer() noexcept { return m_Tracer; }
+
+    /** Binary per-rank trace, see TraceRecorder::Serialize */
+    std::vector<char> GetRankTrace() const { return m_Tracer.Serialize(m_RankMPI); }
 
     std::string GetRankProfilingJSON(
         const std::vector<std::string> &transportsTypes,
@@ -83,21 +103,36 @@ private:
     IOChrono m_Profiler;
     int m_RankMPI = 0;
     helper::Comm const &m_Comm;
+
+    /** interns names for both the timers and the trace */
+    TraceRecorder m_Tracer;
+    /** IDs already interned by this profiler, only used by the engine thread
+     * like m_Profiler, so looked up without m_Tracer's lock */
+    std::unordered_map<std::string, TraceEventID> m_IDs;
+    /** indexed by TraceEventID, bound by AddTimerWatch or on first use, element pointers of
+     * the unordered_maps in m_Profiler stay valid on insertion */
+    std::vector<Timer *> m_TimersByID;
+    std::vector<size_t *> m_BytesByID;
 };
 
 class ProfilerGuard
 {
 public:
     explicit ProfilerGuard(JSONProfiler &host, const std::string &tag)
+    : m_HostProfiler(host), m_Tag(host.Intern(tag))
+    {
+        m_HostProfiler.Start(m_Tag);
+    }
+    explicit ProfilerGuard(JSONProfiler &host, const TraceEventID tag)
     : m_HostProfiler(host), m_Tag(tag)
     {
-        m_HostProfiler.Start(tag);
+        m_HostProfiler.Start(m_Tag);
     }
     ~ProfilerGuard() { m_HostProfiler.Stop(m_Tag); }
 
 private:
     JSONProfiler &m_HostProfiler;
-    std::string m_Tag;
+    const TraceEventID m_Tag;
 };
 } // end namespace profiling
 } // end namespace adios
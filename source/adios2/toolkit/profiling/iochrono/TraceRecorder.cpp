@@ -0,0 +1,207 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TraceRecorder.cpp
+ */
+
+#include "TraceRecorder.h"
+
+#include "adios2/helper/adiosMemory.h"
+#include "adios2/helper/adiosSystem.h"
+
+#include <cstring>
+
+namespace adios2
+{
+namespace profiling
+{
+
+constexpr const char *TraceRecorder::Magic;
+constexpr uint32_t TraceRecorder::Version;
+
+namespace
+{
+std::atomic<uint64_t> TraceRecorderSerial(0);
+
+/** last ring used by this thread, valid while Serial matches its recorder */
+struct LocalRingCache
+{
+    uint64_t Serial = 0;
+    void *Ring = nullptr;
+};
+thread_local LocalRingCache t_RingCache;
+} // end anonymous namespace
+
+/* Single producer ring: only the owning thread writes records and Head,
+ * Serialize reads them once the producers are done. Once full, the oldest
+ * records are overwritten. */
+struct TraceRecorder::ThreadRing
+{
+    ThreadRing(const size_t capacity, const uint32_t thread) : Records(capacity), Thread(thread) {}
+
+    std::vector<TraceRecord> Records;
+    std::atomic<uint64_t> Head{0};
+    const uint32_t Thread;
+};
+
+TraceRecorder::TraceRecorder()
+: m_Serial(++TraceRecorderSerial), m_Start(std::chrono::steady_clock::now()),
+  m_StartWall(std::chrono::system_clock::now())
+{
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+TraceEventID TraceRecorder::Intern(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_EventIDs.find(name);
+    if (it != m_EventIDs.end())
+    {
+        return it->second;
+    }
+    const TraceEventID id = static_cast<TraceEventID>(m_EventNames.size());
+    m_EventNames.push_back(name);
+    m_EventIDs.emplace(name, id);
+    return id;
+}
+
+std::string TraceRecorder::EventName(const TraceEventID id) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (id < m_EventNames.size())
+    {
+        return m_EventNames[id];
+    }
+    return std::string();
+}
+
+void TraceRecorder::Enable(const size_t recordsPerThread)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_RecordsPerThread = recordsPerThread;
+    }
+    m_Enabled.store(recordsPerThread > 0, std::memory_order_relaxed);
+}
+
+TraceRecorder::ThreadRing *TraceRecorder::LocalRing() noexcept
+{
+    if (t_RingCache.Serial == m_Serial)
+    {
+        return static_cast<ThreadRing *>(t_RingCache.Ring);
+    }
+
+    ThreadRing *ring = nullptr;
+    try
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        const std::thread::id self = std::this_thread::get_id();
+        auto it = m_ThreadIndex.find(self);
+        if (it != m_ThreadIndex.end())
+        {
+            ring = m_Rings[it->second].get();
+        }
+        else
+        {
+            const size_t index = m_Rings.size();
+            m_Rings.emplace_back(
+                new ThreadRing(m_RecordsPerThread, static_cast<uint32_t>(index)));
+            m_ThreadIndex.emplace(self, index);
+            ring = m_Rings.back().get();
+        }
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+
+    t_RingCache.Serial = m_Serial;
+    t_RingCache.Ring = ring;
+    return ring;
+}
+
+void TraceRecorder::Record(const TraceEventID id, const uint8_t phase,
+                           const uint64_t bytes) noexcept
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    ThreadRing *ring = LocalRing();
+    if (ring == nullptr || ring->Records.empty())
+    {
+        return;
+    }
+
+    const uint64_t head = ring->Head.load(std::memory_order_relaxed);
+    TraceRecord &record = ring->Records[head % ring->Records.size()];
+    record.Timestamp = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                             m_Start)
+            .count());
+    record.Bytes = bytes;
+    record.Event = id;
+    record.Thread = ring->Thread;
+    record.Phase = phase;
+    ring->Head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<char> TraceRecorder::Serialize(const int rank) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    uint64_t nRecords = 0;
+    uint64_t dropped = 0;
+    for (const auto &ring : m_Rings)
+    {
+        const uint64_t head = ring->Head.load(std::memory_order_acquire);
+        const uint64_t capacity = ring->Records.size();
+        nRecords += (head < capacity ? head : capacity);
+        dropped += (head > capacity ? head - capacity : 0);
+    }
+
+    std::vector<char> buffer;
+    buffer.reserve(64 + m_EventNames.size() * 24 + nRecords * sizeof(TraceRecord));
+
+    buffer.insert(buffer.end(), Magic, Magic + 8);
+    helper::InsertToBuffer(buffer, &Version);
+    const uint32_t recordSize = static_cast<uint32_t>(sizeof(TraceRecord));
+    helper::InsertToBuffer(buffer, &recordSize);
+    const int32_t rank32 = static_cast<int32_t>(rank);
+    helper::InsertToBuffer(buffer, &rank32);
+    const uint8_t flags[4] = {static_cast<uint8_t>(helper::IsLittleEndian() ? 1 : 0), 0, 0, 0};
+    helper::InsertToBuffer(buffer, flags, 4);
+    const uint64_t startWall = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(m_StartWall.time_since_epoch())
+            .count());
+    helper::InsertToBuffer(buffer, &startWall);
+    helper::InsertToBuffer(buffer, &dropped);
+
+    const uint64_t nNames = m_EventNames.size();
+    helper::InsertToBuffer(buffer, &nNames);
+    for (const auto &name : m_EventNames)
+    {
+        const uint32_t length = static_cast<uint32_t>(name.size());
+        helper::InsertToBuffer(buffer, &length);
+        buffer.insert(buffer.end(), name.begin(), name.end());
+    }
+
+    helper::InsertToBuffer(buffer, &nRecords);
+    for (const auto &ring : m_Rings)
+    {
+        const uint64_t head = ring->Head.load(std::memory_order_acquire);
+        const uint64_t capacity = ring->Records.size();
+        // oldest surviving record first
+        const uint64_t first = (head > capacity ? head - capacity : 0);
+        for (uint64_t i = first; i < head; ++i)
+        {
+            helper::InsertToBuffer(buffer, &ring->Records[i % capacity]);
+        }
+    }
+    return buffer;
+}
+
+} // end namespace profiling
+} // end namespace adios2
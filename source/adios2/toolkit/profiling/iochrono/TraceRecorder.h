@@ -0,0 +1,140 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TraceRecorder.h : low-overhead binary event recorder. Event names are
+ * interned once into small integer IDs, every thread appends fixed-size
+ * records to its own ring buffer without taking a lock, and the rings are
+ * serialized into a compact per-rank trace at the end of the run.
+ * source/utils/adios2_trace2json.py converts the traces of all ranks into
+ * the Chrome Trace / Perfetto JSON format.
+ */
+
+#ifndef ADIOS2_TOOLKIT_PROFILING_IOCHRONO_TRACERECORDER_H_
+#define ADIOS2_TOOLKIT_PROFILING_IOCHRONO_TRACERECORDER_H_
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+/// \endcond
+
+#include "adios2/common/ADIOSConfig.h"
+
+namespace adios2
+{
+namespace profiling
+{
+
+using TraceEventID = uint32_t;
+
+/** One fixed-size trace entry, written as-is to the trace file */
+struct TraceRecord
+{
+    /** nanoseconds since the recorder was created */
+    uint64_t Timestamp;
+    /** bytes moved by the event, 0 if not applicable */
+    uint64_t Bytes;
+    TraceEventID Event;
+    /** recorder-local thread index, 0 is the first thread that recorded */
+    uint32_t Thread;
+    /** 'B' begin, 'E' end, 'C' byte counter */
+    uint8_t Phase;
+    uint8_t Padding[7];
+};
+
+class TraceRecorder
+{
+public:
+    /** Magic string at the start of every trace file */
+    static constexpr const char *Magic = "ADIOS2TR";
+    static constexpr uint32_t Version = 1;
+
+    TraceRecorder();
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+    /** Returns the ID of an event name, registering it on first use.
+     * Thread-safe, but takes a lock: call it once and keep the ID. */
+    TraceEventID Intern(const std::string &name);
+
+    /** Name registered for id, empty if unknown */
+    std::string EventName(const TraceEventID id) const;
+
+    /** Start recording, each thread keeps its last recordsPerThread events */
+    void Enable(const size_t recordsPerThread);
+
+    bool IsEnabled() const noexcept { return m_Enabled.load(std::memory_order_relaxed); }
+
+    void Begin(const TraceEventID id) noexcept { Record(id, 'B', 0); }
+    void End(const TraceEventID id, const uint64_t bytes = 0) noexcept { Record(id, 'E', bytes); }
+    void Counter(const TraceEventID id, const uint64_t bytes) noexcept { Record(id, 'C', bytes); }
+
+    /** Appends one record to the calling thread's ring, no-op if disabled */
+    void Record(const TraceEventID id, const uint8_t phase, const uint64_t bytes) noexcept;
+
+    /**
+     * Binary trace of all threads. Must not race with Record, i.e. call it
+     * after worker threads are joined.
+     * <pre>
+     * char[8]  Magic
+     * uint32   Version, uint32 sizeof(TraceRecord), int32 rank,
+     * uint8    IsLittleEndian, uint8[3] padding
+     * uint64   recorder start, ns since the Unix epoch
+     * uint64   dropped (overwritten) records
+     * uint64   number of names, then per name: uint32 length + characters
+     * uint64   number of records, then the TraceRecord array
+     * </pre>
+     */
+    std::vector<char> Serialize(const int rank) const;
+
+private:
+    struct ThreadRing;
+
+    std::atomic<bool> m_Enabled{false};
+    size_t m_RecordsPerThread = 0;
+
+    /** distinguishes recorders in the thread-local ring cache */
+    const uint64_t m_Serial;
+
+    const std::chrono::steady_clock::time_point m_Start;
+    const std::chrono::system_clock::time_point m_StartWall;
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<std::string, TraceEventID> m_EventIDs;
+    std::vector<std::string> m_EventNames;
+    std::unordered_map<std::thread::id, size_t> m_ThreadIndex;
+    std::vector<std::unique_ptr<ThreadRing>> m_Rings;
+
+    ThreadRing *LocalRing() noexcept;
+};
+
+/** Records a Begin at construction and an End, with bytes, at destruction */
+class TraceGuard
+{
+public:
+    TraceGuard(TraceRecorder &recorder, const TraceEventID id, const uint64_t bytes = 0) noexcept
+    : m_Recorder(recorder), m_ID(id), m_Bytes(bytes)
+    {
+        m_Recorder.Begin(m_ID);
+    }
+    ~TraceGuard() { m_Recorder.End(m_ID, m_Bytes); }
+
+private:
+    TraceRecorder &m_Recorder;
+    const TraceEventID m_ID;
+    const uint64_t m_Bytes;
+};
+
+} // end namespace profiling
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_PROFILING_IOCHRONO_TRACERECORDER_H_ */
@@ -112,6 +112,12 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
                 Params->QueueLimit, Stream->Filename);
     }
     Stream->QueueFullPolicy = (SstQueueFullPolicy)Params->QueueFullPolicy;
+    if (Params->QueueDecimation < 1)
+    {
+        fprintf(stderr, "Invalid QueueDecimation parameter value (%d) for SST Stream %s\n",
+                Params->QueueDecimation, Stream->Filename);
+        Params->QueueDecimation = 1;
+    }
     Stream->RegistrationMethod = (SstRegistrationMethod)Params->RegistrationMethod;
     if (Params->DataTransport != NULL)
     {
@@ -238,7 +244,7 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
 
 static char *SstRegStr[] = {"File", "Screen", "Cloud"};
 static char *SstMarshalStr[] = {"FFS", "BP", "BP5"};
-static char *SstQueueFullStr[] = {"Block", "Discard"};
+static char *SstQueueFullStr[] = {"Block", "Discard", "DropOldest"};
 static char *SstCompressStr[] = {"None", "ZFP"};
 static char *SstCommPatternStr[] = {"Min", "Peer"};
 static char *SstPreloadModeStr[] = {"Off", "On", "Auto"};
@@ -256,6 +262,9 @@ extern void CP_dumpParams(SstStream Stream, struct _SstParams *Params, int Reade
         fprintf(stderr, "Param -   QueueLimit=%d %s\n", Params->QueueLimit,
                 (Params->QueueLimit == 0) ? "(unlimited)" : "");
         fprintf(stderr, "Param -   QueueFullPolicy=%s\n", SstQueueFullStr[Params->QueueFullPolicy]);
+        fprintf(stderr, "Param -   QueueMemoryLimit=%zu %s\n", Params->QueueMemoryLimit,
+                (Params->QueueMemoryLimit == 0) ? "(unlimited)" : "");
+        fprintf(stderr, "Param -   QueueDecimation=%d\n", Params->QueueDecimation);
         fprintf(stderr, "Param -   StepDistributionMode=%s\n",
                 SstStepDistributionModeStr[Params->StepDistributionMode]);
     }
@@ -429,6 +438,7 @@ static FMField MetaDataPlusDPInfoList[] = {
     {"Formats", "*FFSFormatBlock", sizeof(struct FFSFormatBlock),
      FMOffset(struct _MetadataPlusDPInfo *, Formats)},
     {"DP_TimestepInfo", "*DP_STRUCT", 0, FMOffset(struct _MetadataPlusDPInfo *, DP_TimestepInfo)},
+    {"DataSize", "integer", sizeof(size_t), FMOffset(struct _MetadataPlusDPInfo *, DataSize)},
     {NULL, NULL, 0, 0}};
 
 static FMField FFSFormatBlockList[] = {
@@ -502,6 +512,9 @@ static FMField ReturnMetadataInfoList[] = {
     {"ReaderCount", "integer", sizeof(int), FMOffset(struct _ReturnMetadataInfo *, ReaderCount)},
     {"ReaderStatus", "integer[ReaderCount]", sizeof(enum StreamStatus),
      FMOffset(struct _ReturnMetadataInfo *, ReaderStatus)},
+    {"DropCount", "integer", sizeof(int), FMOffset(struct _ReturnMetadataInfo *, DropCount)},
+    {"DropList", "integer[DropCount]", sizeof(ssize_t),
+     FMOffset(struct _ReturnMetadataInfo *, DropList)},
     {"Msg", "timestepMetadata", sizeof(struct _TimestepMetadataMsg),
      FMOffset(struct _ReturnMetadataInfo *, Msg)},
     {NULL, NULL, 0, 0}};
@@ -629,6 +642,7 @@ static void replaceFormatNameInFieldList(FMStructDescList l, const char *orig, c
                     while (l[i].field_list[index].field_name != NULL)
                     {
                         l[i].field_list[index] = l[i].field_list[index + 1];
+                        index++;
                     }
                     j--; /* we've replaced this element, make sure we process
                             the one we replaced it with */
@@ -1086,6 +1100,15 @@ extern void DoStreamSummary(SstStream Stream)
                    Stream->Stats.TimestepsCreated);
         CP_verbose(Stream, SummaryVerbose, "\tTimesteps Delivered = %zu\n",
                    Stream->Stats.TimestepsDelivered);
+        CP_verbose(Stream, SummaryVerbose, "\tTimesteps Discarded = %zu\n",
+                   Stream->Stats.TimestepsDiscarded);
+        CP_verbose(Stream, SummaryVerbose, "\tMax Reader Lag (timesteps) = %zu\n",
+                   Stream->Stats.MaxReaderLag);
+        for (int i = 0; i < Stream->ReaderCount; i++)
+        {
+            CP_verbose(Stream, SummaryVerbose, "\t\tReader %d Max Lag (timesteps) = %zu\n", i,
+                       Stream->Readers[i]->MaxLag);
+        }
     }
     else if (Stream->Role == ReaderRole)
     {
@@ -103,6 +103,7 @@ typedef struct _WS_ReaderInfo
     SstPreloadModeType PreloadMode;
     ssize_t PreloadModeActiveTimestep;
     ssize_t OldestUnreleasedTimestep;
+    size_t MaxLag; /* largest lag behind the writer seen, rank 0 only */
     size_t FormatSentCount;
     struct _SentTimestepRec *SentTimestepList;
     void *DP_WSR_Stream;
@@ -133,6 +134,7 @@ typedef struct _CPTimestepEntry
     int InProgressFlag;
     int Expired;
     int PreciousTimestep;
+    size_t DataSize; /* data bytes of the whole cohort, rank 0 only */
     void **DP_TimestepInfo;
     int DPRegistered;
     SstData MetadataArray;
@@ -180,6 +182,7 @@ struct _SstStream
     ssize_t LastReleasedTimestep;
     CPTimestepList QueuedTimesteps;
     int QueuedTimestepCount;
+    size_t QueuedDataBytes;
     int QueueLimit;
     SstQueueFullPolicy QueueFullPolicy;
     ssize_t LastProvidedTimestep;
@@ -298,6 +301,7 @@ struct _MetadataPlusDPInfo
     SstData AttributeData;
     FFSFormatList Formats;
     void *DP_TimestepInfo;
+    size_t DataSize;
 };
 
 /*
@@ -453,6 +457,8 @@ typedef struct _ReturnMetadataInfo
     ReleaseRecPtr LockDefnsList;
     int LockDefnsCount;
     enum StreamStatus *ReaderStatus;
+    int DropCount;
+    ssize_t *DropList;
 } *ReturnMetadataInfo;
 
 /*
@@ -284,6 +284,7 @@ static void RemoveQueueEntries(SstStream Stream)
             }
 
             Stream->QueuedTimestepCount--;
+            Stream->QueuedDataBytes -= ItemToFree->DataSize;
             if (ItemToFree->MetaDataSendCount)
             {
                 Stream->Stats.TimestepsDelivered++;
@@ -1927,6 +1928,227 @@ static void ProcessLockDefnsList(SstStream Stream, ReturnMetadataInfo Metadata)
     STREAM_MUTEX_UNLOCK(Stream);
 }
 
+/*
+ * Is the queue beyond QueueLimit or QueueMemoryLimit if the timesteps in
+ * DropList were gone?  The memory limit never rejects the only timestep in
+ * the queue, a single step larger than the budget would block forever.
+ * (ASSUME LOCKED, rank 0 only)
+ */
+static int QueueOverLimit(SstStream Stream, ssize_t *DropList, int DropCount)
+{
+    STREAM_ASSERT_LOCKED(Stream);
+    int Count = Stream->QueuedTimestepCount;
+    size_t Bytes = Stream->QueuedDataBytes;
+    CPTimestepList List = Stream->QueuedTimesteps;
+    while (List)
+    {
+        for (int i = 0; i < DropCount; i++)
+        {
+            if ((List->Timestep == DropList[i]) && !List->Expired)
+            {
+                Count--;
+                Bytes -= List->DataSize;
+            }
+        }
+        List = List->Next;
+    }
+    if ((Stream->QueueLimit > 0) && (Count > Stream->QueueLimit))
+    {
+        return 1;
+    }
+    if ((Stream->ConfigParams->QueueMemoryLimit > 0) && (Count > 1) &&
+        (Bytes > Stream->ConfigParams->QueueMemoryLimit))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Decide on rank 0 what happens to the newly queued timestep when the queue
+ * is beyond its limits.  Returns the discard decision for Timestep, and in
+ * *DropListPtr the older timesteps that must go to make room for it.
+ *
+ * With QueueDecimation N > 1, only every Nth timestep gets a chance to enter a
+ * full queue, the others are discarded without blocking.  The remaining ones
+ * follow QueueFullPolicy:
+ *   Block      - wait for readers to release timesteps
+ *   Discard    - discard the new timestep (drop newest)
+ *   DropOldest - expire the oldest timesteps no reader holds a reference to,
+ *                discard the new timestep if that isn't enough
+ * (ASSUME LOCKED, rank 0 only)
+ */
+static int QueueFullDecision(SstStream Stream, ssize_t Timestep, ssize_t **DropListPtr,
+                             int *DropCountPtr)
+{
+    STREAM_ASSERT_LOCKED(Stream);
+    ssize_t *DropList = NULL;
+    int DropCount = 0;
+    int Decimation = Stream->ConfigParams->QueueDecimation;
+
+    *DropListPtr = NULL;
+    *DropCountPtr = 0;
+    CP_verbose(Stream, TraceVerbose,
+               "Testing Discard Condition, Queued Timestep Count %d, "
+               "QueueLimit %d, Queued Data Bytes %zu, QueueMemoryLimit %zu\n",
+               Stream->QueuedTimestepCount, Stream->QueueLimit, Stream->QueuedDataBytes,
+               Stream->ConfigParams->QueueMemoryLimit);
+    if (!QueueOverLimit(Stream, NULL, 0))
+    {
+        return 0;
+    }
+    if ((Decimation > 1) && (Timestep % Decimation != 0))
+    {
+        CP_verbose(Stream, PerStepVerbose,
+                   "Queue full, decimation %d discards timestep %zd\n", Decimation, Timestep);
+        return 1;
+    }
+    switch (Stream->QueueFullPolicy)
+    {
+    case SstQueueFullBlock:
+        while (QueueOverLimit(Stream, NULL, 0))
+        {
+            CP_verbose(Stream, PerStepVerbose, "Blocking on QueueFull condition\n");
+            STREAM_CONDITION_WAIT(Stream);
+        }
+        return 0;
+    case SstQueueFullDropOldest:
+    {
+        /* the queue is newest first, the candidates are picked from the tail */
+        int Candidates = 0;
+        CPTimestepList List = Stream->QueuedTimesteps;
+        while (List)
+        {
+            Candidates++;
+            List = List->Next;
+        }
+        DropList = malloc(sizeof(DropList[0]) * Candidates);
+        while (QueueOverLimit(Stream, DropList, DropCount))
+        {
+            CPTimestepList Oldest = NULL;
+            List = Stream->QueuedTimesteps;
+            while (List)
+            {
+                int AlreadyDropped = 0;
+                for (int i = 0; i < DropCount; i++)
+                {
+                    AlreadyDropped |= (DropList[i] == List->Timestep);
+                }
+                if ((List->Timestep != Timestep) && (List->ReferenceCount == 0) &&
+                    !List->InProgressFlag && !List->PreciousTimestep && !List->Expired &&
+                    !AlreadyDropped)
+                {
+                    Oldest = List;
+                }
+                List = List->Next;
+            }
+            if (!Oldest)
+            {
+                break;
+            }
+            CP_verbose(Stream, PerStepVerbose,
+                       "Queue full, dropping oldest unreferenced timestep %zd\n",
+                       Oldest->Timestep);
+            DropList[DropCount++] = Oldest->Timestep;
+        }
+        if (QueueOverLimit(Stream, DropList, DropCount))
+        {
+            /* nothing left to evict, give up on the new one instead */
+            free(DropList);
+            return 1;
+        }
+        if (DropCount == 0)
+        {
+            free(DropList);
+            DropList = NULL;
+        }
+        *DropListPtr = DropList;
+        *DropCountPtr = DropCount;
+        return 0;
+    }
+    case SstQueueFullDiscard:
+    default:
+        return 1;
+    }
+}
+
+/*
+ * Expire the timesteps rank 0 dropped to make room in the queue.
+ */
+static void ProcessDropList(SstStream Stream, ReturnMetadataInfo Metadata)
+{
+    if (Metadata->DropCount == 0)
+    {
+        return;
+    }
+    STREAM_MUTEX_LOCK(Stream);
+    for (int i = 0; i < Metadata->DropCount; i++)
+    {
+        CPTimestepList List = Stream->QueuedTimesteps;
+        while (List)
+        {
+            if ((List->Timestep == Metadata->DropList[i]) && !List->Expired)
+            {
+                CP_verbose(Stream, PerRankVerbose, "Writer dropping timestep %zd from the queue\n",
+                           List->Timestep);
+                List->Expired = 1;
+                /* a reserve timestep the readers already released was
+                 * delivered, only count the ones no reader ever got */
+                if (List->MetaDataSendCount == 0)
+                {
+                    Stream->Stats.TimestepsDiscarded++;
+                }
+            }
+            List = List->Next;
+        }
+    }
+    RemoveQueueEntries(Stream);
+    STREAM_MUTEX_UNLOCK(Stream);
+}
+
+/*
+ * Per reader lag, the number of timesteps provided that this reader hasn't
+ * released yet.  Each reader gets a counter of its own, the largest lag of
+ * any reader is kept for the stream summary.  (ASSUME LOCKED, rank 0 only)
+ */
+static void UpdateReaderLagStats(SstStream Stream)
+{
+    STREAM_ASSERT_LOCKED(Stream);
+    size_t MaxLag = 0;
+    for (int i = 0; i < Stream->ReaderCount; i++)
+    {
+        if (Stream->Readers[i]->ReaderStatus != Established)
+        {
+            continue;
+        }
+        size_t Lag = 0;
+        if (Stream->LastProvidedTimestep > Stream->Readers[i]->LastReleasedTimestep)
+        {
+            Lag = Stream->LastProvidedTimestep - Stream->Readers[i]->LastReleasedTimestep;
+        }
+        CP_verbose(Stream, PerStepVerbose, "Reader %d lags %zu timesteps behind the writer\n", i,
+                   Lag);
+        char CounterName[64];
+        snprintf(CounterName, sizeof(CounterName), "Reader %d lag (timesteps)", i);
+        PERFSTUBS_SAMPLE_COUNTER(CounterName, (double)Lag);
+        if (Lag > Stream->Readers[i]->MaxLag)
+        {
+            Stream->Readers[i]->MaxLag = Lag;
+        }
+        if (Lag > MaxLag)
+        {
+            MaxLag = Lag;
+        }
+    }
+    if (MaxLag > Stream->Stats.MaxReaderLag)
+    {
+        Stream->Stats.MaxReaderLag = MaxLag;
+    }
+    PERFSTUBS_SAMPLE_COUNTER("Max reader lag (timesteps)", MaxLag);
+    PERFSTUBS_SAMPLE_COUNTER("Queued timesteps", Stream->QueuedTimestepCount);
+    PERFSTUBS_SAMPLE_COUNTER("Queued data bytes", Stream->QueuedDataBytes);
+}
+
 /*
  *
 Protocol notes:
@@ -1953,17 +2175,27 @@ Upon TimestepProvision:
                 all meta data
 
         (RANK 0 only)
-        if (blockingMode) {
-                LOCK
-                while (overall queue length > limit) {
-                        WAIT (implict unlock)
+        LOCK
+        if (overall queue length or data size > limit) {
+                if (decimating and not an Nth timestep) {
+                        discard this timestep
+                } else if (blockingMode) {
+                        while (overall queue length or data size > limit) {
+                                WAIT (implict unlock)
+                        }
+                } else if (dropOldestMode) {
+                        add oldest unreferenced timesteps to drop list
+                        until under limit, otherwise discard this timestep
+                } else {
+                        discard this timestep
                 }
-                UNLOCK
         }
+        UNLOCK
 
 
         Distribute from rank 0:
                 this timestep discard decision.
+                drop list
                 if (not discard && not CommMin) aggregated metadata
                 release list
                 Waiting reader count
@@ -1987,6 +2219,7 @@ Upon TimestepProvision:
         if (rank != 0)
            handle release timestep list
         }
+        expire timesteps in drop list
         UNLOCK
         Handle new readers
 
@@ -2093,6 +2326,7 @@ extern void SstInternalProvideTimestep(SstStream Stream, SstData LocalMetadata,
     Md.Metadata = (SstData)LocalMetadata;
     Md.AttributeData = (SstData)AttributeData;
     Md.DP_TimestepInfo = DP_TimestepInfo;
+    Md.DataSize = Data ? Data->DataSize : 0;
 
     if (Data)
     {
@@ -2142,28 +2376,17 @@ extern void SstInternalProvideTimestep(SstStream Stream, SstData LocalMetadata,
         void *MetadataFreeValue;
         STREAM_MUTEX_LOCK(Stream);
         ArrivingReader = Stream->ReaderRegisterQueue;
-        QueueMaintenance(Stream);
-        if (Stream->QueueFullPolicy == SstQueueFullDiscard)
+        Entry->DataSize = 0;
+        for (int i = 0; i < Stream->CohortSize; i++)
         {
-            CP_verbose(Stream, TraceVerbose,
-                       "Testing Discard Condition, Queued Timestep Count %d, "
-                       "QueueLimit %d\n",
-                       Stream->QueuedTimestepCount, Stream->QueueLimit);
-            QueueMaintenance(Stream);
-            if (Stream->QueuedTimestepCount > Stream->QueueLimit)
-            {
-                DiscardThisTimestep = 1;
-            }
-        }
-        else
-        {
-            while ((Stream->QueueLimit > 0) && (Stream->QueuedTimestepCount > Stream->QueueLimit))
-            {
-                CP_verbose(Stream, PerStepVerbose, "Blocking on QueueFull condition\n");
-                STREAM_CONDITION_WAIT(Stream);
-            }
+            Entry->DataSize += pointers[i]->DataSize;
         }
+        Stream->QueuedDataBytes += Entry->DataSize;
+        QueueMaintenance(Stream);
         memset(&TimestepMetaData, 0, sizeof(TimestepMetaData));
+        DiscardThisTimestep = QueueFullDecision(Stream, Timestep, &TimestepMetaData.DropList,
+                                                &TimestepMetaData.DropCount);
+        UpdateReaderLagStats(Stream);
         TimestepMetaData.PendingReaderCount = 0;
         while (ArrivingReader)
         {
@@ -2200,6 +2423,8 @@ extern void SstInternalProvideTimestep(SstStream Stream, SstData LocalMetadata,
             free(TimestepMetaData.ReleaseList);
         if (TimestepMetaData.LockDefnsList)
             free(TimestepMetaData.LockDefnsList);
+        if (TimestepMetaData.DropList)
+            free(TimestepMetaData.DropList);
         free(TimestepMetaData.Msg.Metadata);
         free(TimestepMetaData.Msg.AttributeData);
     }
@@ -2234,6 +2459,7 @@ extern void SstInternalProvideTimestep(SstStream Stream, SstData LocalMetadata,
     {
         ProcessReleaseList(Stream, ReturnData);
     }
+    ProcessDropList(Stream, ReturnData);
     ActOnTSLockStatus(Stream, Timestep);
     PERFSTUBS_TIMER_START(timerTS, "provide timestep operations");
     if (ReturnData->DiscardThisTimestep)
@@ -2256,6 +2482,7 @@ extern void SstInternalProvideTimestep(SstStream Stream, SstData LocalMetadata,
 
         Entry->Expired = 1;
         Entry->ReferenceCount = 0;
+        Stream->Stats.TimestepsDiscarded++;
         QueueMaintenance(Stream);
         STREAM_MUTEX_UNLOCK(Stream);
     }
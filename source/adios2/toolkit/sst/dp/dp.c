@@ -27,6 +27,9 @@ extern CP_DP_Interface LoadDaosDP();
 #ifdef ADIOS2_HAVE_MPI
 extern CP_DP_Interface LoadMpiDP();
 #endif /* ADIOS2_HAVE_MPI */
+#ifdef SST_HAVE_SHM
+extern CP_DP_Interface LoadShmDP();
+#endif /* SST_HAVE_SHM */
 extern CP_DP_Interface LoadEVpathDP();
 
 typedef struct _DPElement
@@ -83,6 +86,10 @@ CP_DP_Interface SelectDP(CP_Services Svcs, void *CP_Stream, struct _SstParams *P
     List = AddDPPossibility(Svcs, CP_Stream, List, LoadMpiDP(), "mpi", Params);
 #endif /* ADIOS2_HAVE_MPI */
 
+#ifdef SST_HAVE_SHM
+    List = AddDPPossibility(Svcs, CP_Stream, List, LoadShmDP(), "shm", Params);
+#endif /* SST_HAVE_SHM */
+
     int SelectedDP = -1;
     int BestPriority = -1;
     int BestPrioDP = -1;
@@ -0,0 +1,697 @@
+/**
+ * ADIOS is freely available under the terms of the BSD license described
+ * in the COPYING file in the top level directory of this source distribution.
+ *
+ * shm_dp.c
+ *
+ * POSIX shared memory Data plane transport for ADIOS2 SST
+ *
+ * Intended for readers and writers that run on the same node.  Each writer
+ * rank places the data block of every timestep in its own POSIX shared memory
+ * segment.  Readers map the segment of the writer rank they need to read from
+ * and serve ReadRemoteMemory with a plain memcpy, so no request or reply ever
+ * goes through the network stack.
+ *
+ * Data scheme of the main data structures introduced here:
+ *
+ * +-------------+     +-------------------+ +----------------+
+ * | ShmStreamWR |     | ShmStreamWPR      | | ShmStreamRD    |
+ * | (Writer)    |     | (WriterPerReader) | | (Reader)       |
+ * |             |     |                   | |                |
+ * | + TimeSteps |     | + StreamWR        | | + WriterCohort |
+ * |   (SLIST)   |     |                   | |   (Array)      |
+ * |             |     |                   | | + Mappings     |
+ * |             |     |                   | |   (SLIST)      |
+ * +-------------+     +-------------------+ +----------------+
+ *
+ * Segment lifetime: the writer creates the segment in ProvideTimeStep and
+ * unlinks it in ReleaseTimeStep, which the control plane only calls once every
+ * reader is done with the timestep.  Readers keep their mapping until
+ * RSReleaseTimestep, the kernel keeps the pages alive until the last mapping
+ * is gone.
+ */
+
+#include "dp_interface.h"
+#include "sst_data.h"
+#include <adios2-perfstubs-interface.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/queue.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SHM_DP_HOSTNAME_LEN 64
+#define SHM_DP_PREFIX_LEN 64
+#define SHM_DP_SEGMENT_NAME_LEN (SHM_DP_PREFIX_LEN + 32)
+#define QUOTE(name) #name
+#define MACRO_TO_STR(name) QUOTE(name)
+
+/*****Stream Basic Structures ***********************************************/
+
+typedef struct _ShmReaderContactInfo
+{
+    char HostName[SHM_DP_HOSTNAME_LEN];
+    void *StreamRS;
+} *ShmReaderContactInfo;
+
+typedef struct _ShmWriterContactInfo
+{
+    char HostName[SHM_DP_HOSTNAME_LEN];
+    char SegmentPrefix[SHM_DP_PREFIX_LEN];
+    void *StreamWPR;
+} *ShmWriterContactInfo;
+
+/* Base Stream class, used implicitly */
+typedef struct _ShmStream
+{
+    void *CP_Stream;
+    int Rank;
+    char HostName[SHM_DP_HOSTNAME_LEN];
+} ShmStream;
+
+/**
+ * A reader side mapping of the segment of one writer rank for one timestep.
+ */
+typedef struct _ShmMappingEntry
+{
+    size_t TimeStep;
+    int WriterRank;
+    char *Addr;
+    size_t Size;
+    STAILQ_ENTRY(_ShmMappingEntry) entries;
+} *ShmMappingEntry;
+
+/**
+ * Readers Stream.
+ */
+typedef struct _ShmStreamRD
+{
+    ShmStream Stream;
+    SstStats Stats;
+
+    int WriterCohortSize;
+    struct _ShmReaderContactInfo MyContactInfo;
+    struct _ShmWriterContactInfo *CohortWriterInfo;
+
+    STAILQ_HEAD(MappingsListHead, _ShmMappingEntry) Mappings;
+    pthread_mutex_t MutexMappings;
+} *ShmStreamRD;
+
+typedef struct _ShmTimeStepsEntry
+{
+    size_t TimeStep;
+    char SegmentName[SHM_DP_SEGMENT_NAME_LEN];
+    char *Addr;
+    size_t Size;
+    STAILQ_ENTRY(_ShmTimeStepsEntry) entries;
+} *ShmTimeStepsEntry;
+
+/**
+ * Writers Stream.
+ */
+typedef struct _ShmStreamWR
+{
+    ShmStream Stream;
+
+    char SegmentPrefix[SHM_DP_PREFIX_LEN];
+    STAILQ_HEAD(ShmTimeStepsListHead, _ShmTimeStepsEntry) TimeSteps;
+    pthread_mutex_t MutexTS;
+} *ShmStreamWR;
+
+/**
+ * WritersPerReader streams.
+ */
+typedef struct _ShmStreamWPR
+{
+    struct _ShmStreamWR *StreamWR;
+    int ReaderCohortSize;
+    struct _ShmWriterContactInfo MyContactInfo;
+} *ShmStreamWPR;
+
+/**
+ * The read already happened in ShmReadRemoteMemory, the handle just carries
+ * the result to ShmWaitForCompletion.
+ */
+typedef struct _ShmCompletionHandle
+{
+    void *CPStream;
+    int DestinationRank;
+    size_t TimeStep;
+    size_t Length;
+    int Success;
+} *ShmCompletionHandle;
+
+static FMField ShmReaderContactList[] = {
+    {"HostName", "char[" MACRO_TO_STR(SHM_DP_HOSTNAME_LEN) "]", sizeof(char),
+     FMOffset(ShmReaderContactInfo, HostName)},
+    {"reader_ID", "integer", sizeof(void *), FMOffset(ShmReaderContactInfo, StreamRS)},
+    {NULL, NULL, 0, 0}};
+
+static FMStructDescRec ShmReaderContactStructs[] = {
+    {"ShmReaderContactInfo", ShmReaderContactList, sizeof(struct _ShmReaderContactInfo), NULL},
+    {NULL, NULL, 0, NULL}};
+
+static FMField ShmWriterContactList[] = {
+    {"HostName", "char[" MACRO_TO_STR(SHM_DP_HOSTNAME_LEN) "]", sizeof(char),
+     FMOffset(ShmWriterContactInfo, HostName)},
+    {"SegmentPrefix", "char[" MACRO_TO_STR(SHM_DP_PREFIX_LEN) "]", sizeof(char),
+     FMOffset(ShmWriterContactInfo, SegmentPrefix)},
+    {"writer_ID", "integer", sizeof(void *), FMOffset(ShmWriterContactInfo, StreamWPR)},
+    {NULL, NULL, 0, 0}};
+
+static FMStructDescRec ShmWriterContactStructs[] = {
+    {"ShmWriterContactInfo", ShmWriterContactList, sizeof(struct _ShmWriterContactInfo), NULL},
+    {NULL, NULL, 0, NULL}};
+
+/*****Internal functions*****************************************************/
+
+static void GetHostName(char *HostName)
+{
+    memset(HostName, 0, SHM_DP_HOSTNAME_LEN);
+    if (gethostname(HostName, SHM_DP_HOSTNAME_LEN - 1) != 0)
+    {
+        strcpy(HostName, "unknown");
+    }
+}
+
+static void SegmentName(char *Name, const char *Prefix, size_t TimeStep)
+{
+    snprintf(Name, SHM_DP_SEGMENT_NAME_LEN, "%s_%zu", Prefix, TimeStep);
+}
+
+/**
+ * Maps the segment of writer rank Rank for TimeStep, reusing the mapping if
+ * a previous read of the same timestep already created it.  Must be called
+ * with MutexMappings held.
+ */
+static ShmMappingEntry GetMapping(CP_Services Svcs, ShmStreamRD Stream, int Rank, size_t TimeStep)
+{
+    ShmMappingEntry Entry = NULL;
+    STAILQ_FOREACH(Entry, &Stream->Mappings, entries)
+    {
+        if (Entry->TimeStep == TimeStep && Entry->WriterRank == Rank)
+        {
+            return Entry;
+        }
+    }
+
+    char Name[SHM_DP_SEGMENT_NAME_LEN];
+    SegmentName(Name, Stream->CohortWriterInfo[Rank].SegmentPrefix, TimeStep);
+
+    int fd = shm_open(Name, O_RDONLY, 0);
+    if (fd == -1)
+    {
+        Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                      "Failed to open shared memory segment %s: %s\n", Name, strerror(errno));
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                      "Failed to stat shared memory segment %s: %s\n", Name, strerror(errno));
+        close(fd);
+        return NULL;
+    }
+
+    Entry = calloc(sizeof(struct _ShmMappingEntry), 1);
+    Entry->TimeStep = TimeStep;
+    Entry->WriterRank = Rank;
+    Entry->Size = (size_t)st.st_size;
+    if (Entry->Size > 0)
+    {
+        void *Addr = mmap(NULL, Entry->Size, PROT_READ, MAP_SHARED, fd, 0);
+        if (Addr == MAP_FAILED)
+        {
+            Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                          "Failed to map shared memory segment %s: %s\n", Name, strerror(errno));
+            close(fd);
+            free(Entry);
+            return NULL;
+        }
+        Entry->Addr = Addr;
+    }
+    close(fd);
+
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose,
+                  "Mapped shared memory segment %s, size %zu\n", Name, Entry->Size);
+
+    STAILQ_INSERT_TAIL(&Stream->Mappings, Entry, entries);
+    return Entry;
+}
+
+static void ReleaseSegment(ShmTimeStepsEntry Entry)
+{
+    if (Entry->Addr)
+    {
+        munmap(Entry->Addr, Entry->Size);
+    }
+    shm_unlink(Entry->SegmentName);
+    free(Entry);
+}
+
+/*****Public accessible functions********************************************/
+
+/**
+ * ShmInitReader.
+ *
+ * Called by the control plane collectively during the early stages of Open on
+ * the reader side.  The only contact information a reader needs to provide is
+ * the node it runs on.
+ */
+static DP_RS_Stream ShmInitReader(CP_Services Svcs, void *CP_Stream, void **ReaderContactInfoPtr,
+                                  struct _SstParams *Params, attr_list WriterContact,
+                                  SstStats Stats)
+{
+    ShmStreamRD Stream = calloc(sizeof(struct _ShmStreamRD), 1);
+    SMPI_Comm comm = Svcs->getMPIComm(CP_Stream);
+
+    Stream->Stream.CP_Stream = CP_Stream;
+    Stream->Stats = Stats;
+    SMPI_Comm_rank(comm, &Stream->Stream.Rank);
+    GetHostName(Stream->Stream.HostName);
+
+    STAILQ_INIT(&Stream->Mappings);
+    pthread_mutex_init(&Stream->MutexMappings, NULL);
+
+    memcpy(Stream->MyContactInfo.HostName, Stream->Stream.HostName, SHM_DP_HOSTNAME_LEN);
+    Stream->MyContactInfo.StreamRS = Stream;
+    *ReaderContactInfoPtr = &Stream->MyContactInfo;
+
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose,
+                  "SHM dataplane reader initialized, reader rank %d on host %s\n",
+                  Stream->Stream.Rank, Stream->Stream.HostName);
+
+    return Stream;
+}
+
+/**
+ * ShmInitWriter.
+ *
+ * Called by the control plane collectively during the early stages of Open on
+ * the writer side.  Picks the name prefix of the segments this writer rank
+ * will create, unique per process, rank and stream.
+ */
+static DP_WS_Stream ShmInitWriter(CP_Services Svcs, void *CP_Stream, struct _SstParams *Params,
+                                  attr_list DPAttrs, SstStats Stats)
+{
+    static int StreamCounter = 0;
+    ShmStreamWR Stream = calloc(sizeof(struct _ShmStreamWR), 1);
+    SMPI_Comm comm = Svcs->getMPIComm(CP_Stream);
+
+    Stream->Stream.CP_Stream = CP_Stream;
+    SMPI_Comm_rank(comm, &Stream->Stream.Rank);
+    GetHostName(Stream->Stream.HostName);
+
+    STAILQ_INIT(&Stream->TimeSteps);
+    pthread_mutex_init(&Stream->MutexTS, NULL);
+
+    snprintf(Stream->SegmentPrefix, SHM_DP_PREFIX_LEN, "/adios2_sst_%ld_%d_%d", (long)getpid(),
+             Stream->Stream.Rank, __sync_fetch_and_add(&StreamCounter, 1));
+
+    Svcs->verbose(CP_Stream, DPTraceVerbose,
+                  "ShmInitWriter initialized addr=%p, segment prefix %s\n", Stream,
+                  Stream->SegmentPrefix);
+
+    return (void *)Stream;
+}
+
+/**
+ * ShmInitWriterPerReader.
+ *
+ * Called by the control plane collectively when accepting a new reader
+ * connection.  Hands the segment prefix and host name of this writer rank to
+ * the reader cohort.
+ */
+static DP_WSR_Stream ShmInitWriterPerReader(CP_Services Svcs, DP_WS_Stream WS_Stream_v,
+                                            int readerCohortSize, CP_PeerCohort PeerCohort,
+                                            void **providedReaderInfo_v,
+                                            void **WriterContactInfoPtr)
+{
+    ShmStreamWR StreamWR = (ShmStreamWR)WS_Stream_v;
+    ShmStreamWPR StreamWPR = calloc(sizeof(struct _ShmStreamWPR), 1);
+    ShmReaderContactInfo *providedReaderInfo = (ShmReaderContactInfo *)providedReaderInfo_v;
+
+    StreamWPR->StreamWR = StreamWR;
+    StreamWPR->ReaderCohortSize = readerCohortSize;
+
+    for (int i = 0; i < readerCohortSize; i++)
+    {
+        if (strncmp(providedReaderInfo[i]->HostName, StreamWR->Stream.HostName,
+                    SHM_DP_HOSTNAME_LEN) != 0)
+        {
+            Svcs->verbose(StreamWR->Stream.CP_Stream, DPCriticalVerbose,
+                          "SHM dataplane: reader rank %d runs on host %s, writer rank %d on "
+                          "host %s, reads from this writer will fail\n",
+                          i, providedReaderInfo[i]->HostName, StreamWR->Stream.Rank,
+                          StreamWR->Stream.HostName);
+        }
+    }
+
+    memcpy(StreamWPR->MyContactInfo.HostName, StreamWR->Stream.HostName, SHM_DP_HOSTNAME_LEN);
+    memcpy(StreamWPR->MyContactInfo.SegmentPrefix, StreamWR->SegmentPrefix, SHM_DP_PREFIX_LEN);
+    StreamWPR->MyContactInfo.StreamWPR = StreamWPR;
+    *WriterContactInfoPtr = &StreamWPR->MyContactInfo;
+
+    return StreamWPR;
+}
+
+/**
+ * ShmProvideWriterDataToReader
+ *
+ * Last step of the Writer/Reader handshake, keeps a copy of the contact
+ * information of every writer rank.
+ */
+static void ShmProvideWriterDataToReader(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
+                                         int writerCohortSize, CP_PeerCohort PeerCohort,
+                                         void **providedWriterInfo_v)
+{
+    ShmStreamRD StreamRS = (ShmStreamRD)RS_Stream_v;
+    ShmWriterContactInfo *providedWriterInfo = (ShmWriterContactInfo *)providedWriterInfo_v;
+
+    StreamRS->WriterCohortSize = writerCohortSize;
+
+    /* * Copy of writer contact information (original will not be preserved) */
+    StreamRS->CohortWriterInfo = malloc(sizeof(struct _ShmWriterContactInfo) * writerCohortSize);
+    for (int i = 0; i < writerCohortSize; i++)
+    {
+        memcpy(&StreamRS->CohortWriterInfo[i], providedWriterInfo[i],
+               sizeof(struct _ShmWriterContactInfo));
+    }
+}
+
+/**
+ * ShmReadRemoteMemory.
+ *
+ * Called by the control plane on the reader side to request timestep data from
+ * writer rank Rank.  The segment is mapped on first use for the timestep and
+ * the requested range is copied right away, WaitForCompletion only reports the
+ * result.
+ */
+static void *ShmReadRemoteMemory(CP_Services Svcs, DP_RS_Stream Stream_v, int Rank, size_t TimeStep,
+                                 size_t Offset, size_t Length, void *Buffer, void *DP_TimeStepInfo)
+{
+    ShmStreamRD Stream = (ShmStreamRD)Stream_v;
+    ShmCompletionHandle ret = calloc(sizeof(struct _ShmCompletionHandle), 1);
+    ShmWriterContactInfo TargetContact = &Stream->CohortWriterInfo[Rank];
+
+    ret->CPStream = Stream->Stream.CP_Stream;
+    ret->DestinationRank = Rank;
+    ret->TimeStep = TimeStep;
+    ret->Length = Length;
+
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose,
+                  "Reader (rank %d) reading shared memory for TimeStep %zu "
+                  "from Rank %d, Offset=%zu, Length=%zu\n",
+                  Stream->Stream.Rank, TimeStep, Rank, Offset, Length);
+
+    if (strncmp(TargetContact->HostName, Stream->Stream.HostName, SHM_DP_HOSTNAME_LEN) != 0)
+    {
+        Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                      "SHM dataplane cannot read from writer rank %d on host %s, "
+                      "this reader runs on host %s\n",
+                      Rank, TargetContact->HostName, Stream->Stream.HostName);
+        return ret;
+    }
+
+    PERFSTUBS_TIMER_START_FUNC(timer);
+    pthread_mutex_lock(&Stream->MutexMappings);
+    ShmMappingEntry Mapping = GetMapping(Svcs, Stream, Rank, TimeStep);
+    pthread_mutex_unlock(&Stream->MutexMappings);
+
+    if (Mapping && (Offset + Length <= Mapping->Size))
+    {
+        if (Length > 0)
+        {
+            memcpy(Buffer, Mapping->Addr + Offset, Length);
+        }
+        Stream->Stats->DataBytesReceived += Length;
+        ret->Success = 1;
+    }
+    else if (Mapping)
+    {
+        Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                      "Read of Offset=%zu, Length=%zu is out of the bounds of the %zu bytes "
+                      "of TimeStep %zu from Rank %d\n",
+                      Offset, Length, Mapping->Size, TimeStep, Rank);
+    }
+    PERFSTUBS_TIMER_STOP_FUNC(timer);
+
+    return ret;
+}
+
+/**
+ * ShmWaitForCompletion.
+ *
+ * The copy is done by ShmReadRemoteMemory, return its outcome.
+ */
+static int ShmWaitForCompletion(CP_Services Svcs, void *Handle_v)
+{
+    const ShmCompletionHandle Handle = (ShmCompletionHandle)Handle_v;
+    const int Ret = Handle->Success;
+
+    if (Ret)
+    {
+        Svcs->verbose(Handle->CPStream, DPTraceVerbose,
+                      "Memory read to rank %d of TimeStep %zu and length %zu has completed\n",
+                      Handle->DestinationRank, Handle->TimeStep, Handle->Length);
+    }
+    else
+    {
+        Svcs->verbose(Handle->CPStream, DPCriticalVerbose,
+                      "Shared memory read to rank %d of TimeStep %zu has FAILED\n",
+                      Handle->DestinationRank, Handle->TimeStep);
+    }
+    free(Handle);
+    return Ret;
+}
+
+/**
+ * ShmProvideTimeStep.
+ *
+ * Called by the control plane collectively on the writer side to "give" the
+ * data plane new data.  The data block is copied into a new shared memory
+ * segment that lives until ShmReleaseTimeStep.
+ */
+static void ShmProvideTimeStep(CP_Services Svcs, DP_WS_Stream Stream_v, struct _SstData *Data,
+                               struct _SstData *LocalMetadata, size_t TimeStep,
+                               void **TimeStepInfoPtr)
+{
+    ShmStreamWR Stream = (ShmStreamWR)Stream_v;
+    ShmTimeStepsEntry Entry = calloc(sizeof(struct _ShmTimeStepsEntry), 1);
+
+    Entry->TimeStep = TimeStep;
+    Entry->Size = Data->DataSize;
+    SegmentName(Entry->SegmentName, Stream->SegmentPrefix, TimeStep);
+
+    PERFSTUBS_TIMER_START_FUNC(timer);
+    int fd = shm_open(Entry->SegmentName, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+        Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                      "Failed to create shared memory segment %s: %s\n", Entry->SegmentName,
+                      strerror(errno));
+        free(Entry);
+        PERFSTUBS_TIMER_STOP_FUNC(timer);
+        return;
+    }
+    if (Entry->Size > 0)
+    {
+        void *Addr = MAP_FAILED;
+        if (ftruncate(fd, (off_t)Entry->Size) == 0)
+        {
+            Addr = mmap(NULL, Entry->Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        if (Addr == MAP_FAILED)
+        {
+            Svcs->verbose(Stream->Stream.CP_Stream, DPCriticalVerbose,
+                          "Failed to size or map shared memory segment %s of %zu bytes: %s\n",
+                          Entry->SegmentName, Entry->Size, strerror(errno));
+            close(fd);
+            shm_unlink(Entry->SegmentName);
+            free(Entry);
+            PERFSTUBS_TIMER_STOP_FUNC(timer);
+            return;
+        }
+        Entry->Addr = Addr;
+        memcpy(Entry->Addr, Data->block, Entry->Size);
+    }
+    close(fd);
+    PERFSTUBS_TIMER_STOP_FUNC(timer);
+
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose,
+                  "Providing TimeStep %zu in shared memory segment %s, size %zu\n", TimeStep,
+                  Entry->SegmentName, Entry->Size);
+
+    pthread_mutex_lock(&Stream->MutexTS);
+    STAILQ_INSERT_TAIL(&Stream->TimeSteps, Entry, entries);
+    pthread_mutex_unlock(&Stream->MutexTS);
+}
+
+/**
+ * ShmReleaseTimeStep.
+ *
+ * Called by the control plane on the writer side once every reader is done
+ * with TimeStep.  Unlinking the segment only removes its name, readers that
+ * still map it keep a valid view until they unmap it.
+ */
+static void ShmReleaseTimeStep(CP_Services Svcs, DP_WS_Stream Stream_v, size_t TimeStep)
+{
+    ShmStreamWR Stream = (ShmStreamWR)Stream_v;
+    ShmTimeStepsEntry Entry = NULL;
+
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose, "Releasing timestep %zu\n", TimeStep);
+
+    pthread_mutex_lock(&Stream->MutexTS);
+    STAILQ_FOREACH(Entry, &Stream->TimeSteps, entries)
+    {
+        if (Entry->TimeStep == TimeStep)
+        {
+            break;
+        }
+    }
+    if (Entry)
+    {
+        STAILQ_REMOVE(&Stream->TimeSteps, Entry, _ShmTimeStepsEntry, entries);
+    }
+    pthread_mutex_unlock(&Stream->MutexTS);
+
+    if (Entry)
+    {
+        ReleaseSegment(Entry);
+    }
+}
+
+/**
+ * ShmRSReleaseTimeStep.
+ *
+ * Called by the control plane on the reader side when TimeStep will not be
+ * read anymore, drops the mappings of that timestep.
+ */
+static void ShmRSReleaseTimeStep(CP_Services Svcs, DP_RS_Stream Stream_v, size_t TimeStep)
+{
+    ShmStreamRD Stream = (ShmStreamRD)Stream_v;
+    ShmMappingEntry Entry = NULL;
+
+    pthread_mutex_lock(&Stream->MutexMappings);
+    Entry = STAILQ_FIRST(&Stream->Mappings);
+    while (Entry)
+    {
+        ShmMappingEntry Next = STAILQ_NEXT(Entry, entries);
+        if (Entry->TimeStep == TimeStep)
+        {
+            STAILQ_REMOVE(&Stream->Mappings, Entry, _ShmMappingEntry, entries);
+            if (Entry->Addr)
+            {
+                munmap(Entry->Addr, Entry->Size);
+            }
+            free(Entry);
+        }
+        Entry = Next;
+    }
+    pthread_mutex_unlock(&Stream->MutexMappings);
+}
+
+/**
+ * ShmGetPriority.
+ *
+ * Shared memory only works when every reader and writer rank share a node,
+ * which can not be known before the streams connect, so this dataplane is
+ * never picked automatically and must be asked for with DataTransport=shm.
+ */
+static int ShmGetPriority(CP_Services Svcs, void *CP_Stream, struct _SstParams *Params)
+{
+    /* Lower than evpath (1), usable (>= 0) when it is the preferred DP */
+    return 0;
+}
+
+static void ShmNotifyConnFailure(CP_Services Svcs, DP_RS_Stream Stream_v, int FailedPeerRank)
+{
+    ShmStreamRD Stream = (ShmStreamRD)Stream_v;
+    Svcs->verbose(Stream->Stream.CP_Stream, DPTraceVerbose,
+                  "received notification that writer peer "
+                  "%d has failed, failing any pending "
+                  "requests\n",
+                  FailedPeerRank);
+}
+
+static void ShmDestroyWriterPerReader(CP_Services Svcs, DP_WSR_Stream WSR_Stream_v)
+{
+    ShmStreamWPR StreamWPR = (ShmStreamWPR)WSR_Stream_v;
+    free(StreamWPR);
+}
+
+static void ShmDestroyWriter(CP_Services Svcs, DP_WS_Stream WS_Stream_v)
+{
+    ShmStreamWR StreamWR = (ShmStreamWR)WS_Stream_v;
+
+    Svcs->verbose(StreamWR->Stream.CP_Stream, DPTraceVerbose,
+                  "ShmDestroyWriter invoked [rank:%d]\n", StreamWR->Stream.Rank);
+
+    pthread_mutex_lock(&StreamWR->MutexTS);
+    while (!STAILQ_EMPTY(&StreamWR->TimeSteps))
+    {
+        ShmTimeStepsEntry Entry = STAILQ_FIRST(&StreamWR->TimeSteps);
+        STAILQ_REMOVE_HEAD(&StreamWR->TimeSteps, entries);
+        ReleaseSegment(Entry);
+    }
+    pthread_mutex_unlock(&StreamWR->MutexTS);
+
+    pthread_mutex_destroy(&StreamWR->MutexTS);
+    free(StreamWR);
+}
+
+static void ShmDestroyReader(CP_Services Svcs, DP_RS_Stream RS_Stream_v)
+{
+    ShmStreamRD StreamRS = (ShmStreamRD)RS_Stream_v;
+
+    Svcs->verbose(StreamRS->Stream.CP_Stream, DPTraceVerbose,
+                  "ShmDestroyReader invoked [rank:%d]\n", StreamRS->Stream.Rank);
+
+    while (!STAILQ_EMPTY(&StreamRS->Mappings))
+    {
+        ShmMappingEntry Entry = STAILQ_FIRST(&StreamRS->Mappings);
+        STAILQ_REMOVE_HEAD(&StreamRS->Mappings, entries);
+        if (Entry->Addr)
+        {
+            munmap(Entry->Addr, Entry->Size);
+        }
+        free(Entry);
+    }
+    pthread_mutex_destroy(&StreamRS->MutexMappings);
+    free(StreamRS->CohortWriterInfo);
+    free(StreamRS);
+}
+
+extern CP_DP_Interface LoadShmDP()
+{
+    static struct _CP_DP_Interface shmDPInterface = {
+        .ReaderContactFormats = ShmReaderContactStructs,
+        .WriterContactFormats = ShmWriterContactStructs,
+        .initReader = ShmInitReader,
+        .initWriter = ShmInitWriter,
+        .initWriterPerReader = ShmInitWriterPerReader,
+        .provideWriterDataToReader = ShmProvideWriterDataToReader,
+        .readRemoteMemory = (CP_DP_ReadRemoteMemoryFunc)ShmReadRemoteMemory,
+        .waitForCompletion = ShmWaitForCompletion,
+        .provideTimestep = (CP_DP_ProvideTimestepFunc)ShmProvideTimeStep,
+        .releaseTimestep = ShmReleaseTimeStep,
+        .RSReleaseTimestep = ShmRSReleaseTimeStep,
+        .getPriority = ShmGetPriority,
+        .destroyReader = ShmDestroyReader,
+        .destroyWriter = ShmDestroyWriter,
+        .destroyWriterPerReader = ShmDestroyWriterPerReader,
+        .notifyConnFailure = ShmNotifyConnFailure,
+    };
+
+    shmDPInterface.DPName = "shm";
+    return &shmDPInterface;
+}
@@ -67,7 +67,8 @@ typedef enum
 typedef enum
 {
     SstQueueFullBlock = 0,
-    SstQueueFullDiscard = 1
+    SstQueueFullDiscard = 1,
+    SstQueueFullDropOldest = 2
 } SstQueueFullPolicy;
 
 typedef enum
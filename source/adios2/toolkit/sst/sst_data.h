@@ -51,6 +51,8 @@ typedef struct _SstStats
     size_t PreloadTimestepsReceived;
     size_t BytesRead;
     double RunningFanIn;
+    size_t TimestepsDiscarded;
+    size_t MaxReaderLag;
 } *SstStats;
 
 #define SST_FOREACH_PARAMETER_TYPE_4ARGS(MACRO)                                                    \
@@ -65,6 +67,8 @@ typedef struct _SstStats
     MACRO(QueueLimit, Int, int, 0)                                                                 \
     MACRO(ReserveQueueLimit, Int, int, 0)                                                          \
     MACRO(QueueFullPolicy, QueueFullPolicy, size_t, 0)                                             \
+    MACRO(QueueMemoryLimit, ByteUnits, size_t, 0)                                                  \
+    MACRO(QueueDecimation, Int, int, 1)                                                            \
     MACRO(IsRowMajor, IsRowMajor, int, 0)                                                          \
     MACRO(FirstTimestepPrecious, Bool, int, 0)                                                     \
     MACRO(ControlTransport, String, char *, NULL)                                                  \
@@ -104,6 +104,8 @@ void Transport::Flush()
 
 size_t Transport::GetSize() { return 0; }
 
+std::string Transport::GetVersion() { return std::string(); }
+
 void Transport::ProfilerWriteBytes(size_t bytes) noexcept
 {
     if (m_Profiler.m_IsActive)
@@ -132,6 +132,13 @@ public:
      */
     virtual size_t GetSize();
 
+    /**
+     * Returns a token that changes when the file is rewritten, like its
+     * modification time or ETag
+     * @return empty if the transport can't tell
+     */
+    virtual std::string GetVersion();
+
     /** flushes current contents to physical medium without closing */
     virtual void Flush();
 
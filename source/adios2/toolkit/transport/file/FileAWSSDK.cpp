@@ -14,6 +14,16 @@
 #include "adios2/helper/adiosString.h"
 #include "adios2/helper/adiosSystem.h"
 
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompletedPart.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+
+#include <algorithm>
 #include <cstdio>  // remove
 #include <cstring> // strerror
 #include <errno.h> // errno
@@ -71,6 +81,18 @@ void FileAWSSDK::SetParameters(const Params &params)
 
     helper::SetParameterValueInt("verbose", params, m_Verbose, "");
 
+    uint64_t value;
+    if (helper::GetParameter(params, "part_size", value))
+    {
+        // S3 rejects parts below 5MB except the last one
+        m_PartSize = std::max(static_cast<size_t>(value), static_cast<size_t>(5 * 1024 * 1024));
+    }
+    if (helper::GetParameter(params, "upload_threads", value))
+    {
+        m_UploadThreads = std::max(static_cast<size_t>(value), static_cast<size_t>(1));
+    }
+    helper::SetParameterValue("staging", params, m_StagingPath);
+
     std::string recheckStr = "true";
     helper::SetParameterValue("recheck_metadata", params, recheckStr);
     m_RecheckMetadata = helper::StringTo<bool>(recheckStr, "");
@@ -217,9 +239,22 @@ void FileAWSSDK::Open(const std::string &name, const Mode openMode, const bool a
     {
 
     case Mode::Write:
+        ProfilerStart("open");
+        m_WritePos = 0;
+        m_SeekPos = 0;
+        m_Upload.reset(new S3MultipartUpload(*this, m_Name, m_PartSize, m_UploadThreads));
+        // metadata is rewritten in place, it is only complete at Close
+        if (helper::EndsWith(m_ObjectName, "md.idx") || helper::EndsWith(m_ObjectName, "md.0") ||
+            helper::EndsWith(m_ObjectName, "mmd.0"))
+        {
+            StartStaging();
+        }
+        ProfilerStop("open");
+        break;
+
     case Mode::Append:
         helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "Open",
-                                              "does not support writing yet " + m_Name);
+                                              "does not support appending to " + m_Name);
         break;
 
     case Mode::Read: {
@@ -293,10 +328,233 @@ void FileAWSSDK::OpenChain(const std::string &name, Mode openMode, const helper:
     }
 }
 
+void FileAWSSDK::StartStaging()
+{
+    m_Staged = true;
+    const std::vector<char> buffered = m_Upload->TakeBuffered();
+    if (!m_StagingPath.empty())
+    {
+        std::string const ep = std::regex_replace(m_Endpoint, std::regex("/|:"), "_");
+        m_StageFilePath = m_StagingPath + PathSeparator + ep + PathSeparator + m_BucketName +
+                          PathSeparator + m_ObjectName;
+        const auto lastPathSeparator(m_StageFilePath.find_last_of(PathSeparator));
+        helper::CreateDirectory(m_StageFilePath.substr(0, lastPathSeparator));
+        m_StageFile = new FileFStream(m_Comm);
+        m_StageFile->Open(m_StageFilePath, Mode::Write);
+        if (!buffered.empty())
+        {
+            m_StageFile->Write(buffered.data(), buffered.size(), 0);
+        }
+    }
+    else
+    {
+        m_Stage = buffered;
+    }
+    m_StageSize = buffered.size();
+    m_WritePos = 0;
+}
+
+void FileAWSSDK::Append(const char *buffer, size_t size)
+{
+    m_Upload->Append(buffer, size);
+    m_WritePos += size;
+}
+
+void FileAWSSDK::FinishUpload()
+{
+    if (m_Staged)
+    {
+        if (m_StageFile)
+        {
+            m_StageFile->Close();
+            m_StageFile->Open(m_StageFilePath, Mode::Read);
+            std::vector<char> chunk(std::min(m_StageSize, m_PartSize));
+            for (size_t pos = 0; pos < m_StageSize; pos += chunk.size())
+            {
+                const size_t n = std::min(chunk.size(), m_StageSize - pos);
+                m_StageFile->Read(chunk.data(), n, pos);
+                Append(chunk.data(), n);
+            }
+        }
+        else
+        {
+            Append(m_Stage.data(), m_StageSize);
+            std::vector<char>().swap(m_Stage);
+        }
+    }
+    m_Upload->Finish();
+}
+
+void FileAWSSDK::AbortUpload() noexcept
+{
+    if (m_Upload)
+    {
+        m_Upload->Abort();
+    }
+}
+
+std::string FileAWSSDK::CreateMultipartUpload()
+{
+    Aws::S3::Model::CreateMultipartUploadRequest request;
+    request.SetBucket(m_BucketName);
+    request.SetKey(m_ObjectName);
+    auto outcome = s3Client->CreateMultipartUpload(request);
+    if (!outcome.IsSuccess())
+    {
+        const Aws::S3::S3Error &err = outcome.GetError();
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK",
+                                              "CreateMultipartUpload",
+                                              "'bucket/object'  " + m_Name +
+                                                  " CreateMultipartUpload: " +
+                                                  err.GetExceptionName() + ": " +
+                                                  err.GetMessage());
+    }
+    return outcome.GetResult().GetUploadId();
+}
+
+std::string FileAWSSDK::UploadPart(const std::string &uploadId, const int partNumber,
+                                   const char *data, const size_t size)
+{
+    Aws::Utils::Stream::PreallocatedStreamBuf streamBuf(
+        reinterpret_cast<unsigned char *>(const_cast<char *>(data)), size);
+    Aws::S3::Model::UploadPartRequest request;
+    request.SetBucket(m_BucketName);
+    request.SetKey(m_ObjectName);
+    request.SetUploadId(uploadId);
+    request.SetPartNumber(partNumber);
+    request.SetContentLength(static_cast<long long>(size));
+    request.SetBody(Aws::MakeShared<Aws::IOStream>("FileAWSSDK", &streamBuf));
+    auto outcome = s3Client->UploadPart(request);
+    if (!outcome.IsSuccess())
+    {
+        const Aws::S3::S3Error &err = outcome.GetError();
+        helper::Throw<std::ios_base::failure>(
+            "Toolkit", "transport::file::FileAWSSDK", "UploadPart",
+            "'bucket/object'  " + m_Name + " part " + std::to_string(partNumber) +
+                " UploadPart: " + err.GetExceptionName() + ": " + err.GetMessage());
+    }
+    if (m_Verbose > 1)
+    {
+        std::cout << "FileAWSSDK::UploadPart: " << m_Name << " part " << partNumber
+                  << " size = " << size << std::endl;
+    }
+    return outcome.GetResult().GetETag();
+}
+
+void FileAWSSDK::CompleteMultipartUpload(const std::string &uploadId,
+                                         const std::vector<std::pair<int, std::string>> &parts)
+{
+    Aws::S3::Model::CompletedMultipartUpload completed;
+    for (const auto &part : parts)
+    {
+        Aws::S3::Model::CompletedPart completedPart;
+        completedPart.SetPartNumber(part.first);
+        completedPart.SetETag(part.second);
+        completed.AddParts(completedPart);
+    }
+    Aws::S3::Model::CompleteMultipartUploadRequest request;
+    request.SetBucket(m_BucketName);
+    request.SetKey(m_ObjectName);
+    request.SetUploadId(uploadId);
+    request.SetMultipartUpload(completed);
+    auto outcome = s3Client->CompleteMultipartUpload(request);
+    if (!outcome.IsSuccess())
+    {
+        const Aws::S3::S3Error &err = outcome.GetError();
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "Close",
+                                              "'bucket/object'  " + m_Name +
+                                                  " CompleteMultipartUpload: " +
+                                                  err.GetExceptionName() + ": " +
+                                                  err.GetMessage());
+    }
+}
+
+void FileAWSSDK::AbortMultipartUpload(const std::string &uploadId) noexcept
+{
+    Aws::S3::Model::AbortMultipartUploadRequest request;
+    request.SetBucket(m_BucketName);
+    request.SetKey(m_ObjectName);
+    request.SetUploadId(uploadId);
+    s3Client->AbortMultipartUpload(request);
+}
+
+void FileAWSSDK::PutObject(const char *data, const size_t size)
+{
+    Aws::Utils::Stream::PreallocatedStreamBuf streamBuf(
+        reinterpret_cast<unsigned char *>(const_cast<char *>(data)), size);
+    Aws::S3::Model::PutObjectRequest request;
+    request.SetBucket(m_BucketName);
+    request.SetKey(m_ObjectName);
+    request.SetContentLength(static_cast<long long>(size));
+    request.SetBody(Aws::MakeShared<Aws::IOStream>("FileAWSSDK", &streamBuf));
+    auto outcome = s3Client->PutObject(request);
+    if (!outcome.IsSuccess())
+    {
+        const Aws::S3::S3Error &err = outcome.GetError();
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "Close",
+                                              "'bucket/object'  " + m_Name + " PutObject: " +
+                                                  err.GetExceptionName() + ": " +
+                                                  err.GetMessage());
+    }
+}
+
 void FileAWSSDK::Write(const char *buffer, size_t size, size_t start)
 {
-    helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "Write",
-                                          "does not support writing yet " + m_Name);
+    WaitForOpen();
+    if (m_OpenMode != Mode::Write)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "Write",
+                                              "not open for writing " + m_Name);
+    }
+    const size_t end = m_Staged ? m_StageSize : m_WritePos;
+    const size_t pos = (start != MaxSizeT) ? start : ((m_SeekPos == MaxSizeT) ? end : m_SeekPos);
+
+    ProfilerStart("write");
+    try
+    {
+        if (!m_Staged && pos != m_WritePos)
+        {
+            if (m_Upload->PartsStarted() > 0)
+            {
+                helper::Throw<std::ios_base::failure>(
+                    "Toolkit", "transport::file::FileAWSSDK", "Write",
+                    "cannot write to position " + std::to_string(pos) + " of " + m_Name +
+                        ", the object is uploaded in order and " + std::to_string(m_WritePos) +
+                        " bytes are already written");
+            }
+            // nothing is uploaded yet, keep the object for Close
+            StartStaging();
+        }
+        if (m_Staged)
+        {
+            if (m_StageFile)
+            {
+                m_StageFile->Write(buffer, size, pos);
+            }
+            else
+            {
+                if (pos + size > m_Stage.size())
+                {
+                    m_Stage.resize(pos + size);
+                }
+                std::memcpy(m_Stage.data() + pos, buffer, size);
+            }
+            m_StageSize = std::max(m_StageSize, pos + size);
+        }
+        else
+        {
+            Append(buffer, size);
+        }
+    }
+    catch (...)
+    {
+        ProfilerStop("write");
+        AbortUpload();
+        throw;
+    }
+    ProfilerStop("write");
+    ProfilerWriteBytes(size);
+    m_SeekPos = pos + size;
 }
 
 void FileAWSSDK::Read(char *buffer, size_t size, size_t start)
@@ -386,6 +644,7 @@ size_t FileAWSSDK::GetSize()
     switch (m_OpenMode)
     {
     case Mode::Write:
+        return m_Staged ? m_StageSize : m_WritePos;
     case Mode::Append:
         return 0;
         break;
@@ -397,6 +656,16 @@ size_t FileAWSSDK::GetSize()
     }
 }
 
+std::string FileAWSSDK::GetVersion()
+{
+    WaitForOpen();
+    if (m_OpenMode != Mode::Read || m_IsCached || !head_object.IsSuccess())
+    {
+        return std::string();
+    }
+    return head_object.GetResult().GetETag();
+}
+
 void FileAWSSDK::Flush() {}
 
 void FileAWSSDK::Close()
@@ -409,6 +678,29 @@ void FileAWSSDK::Close()
     ProfilerStart("close");
     errno = 0;
     m_Errno = errno;
+    if (m_OpenMode == Mode::Write && m_IsOpen)
+    {
+        m_IsOpen = false;
+        try
+        {
+            FinishUpload();
+        }
+        catch (...)
+        {
+            AbortUpload();
+            m_Upload.reset();
+            ProfilerStop("close");
+            throw;
+        }
+        m_Upload.reset();
+        if (m_StageFile)
+        {
+            m_StageFile->Close();
+            delete m_StageFile;
+            m_StageFile = nullptr;
+            std::remove(m_StageFilePath.c_str());
+        }
+    }
     if (s3Client)
     {
         delete s3Client;
@@ -446,7 +738,7 @@ void FileAWSSDK::Delete()
 
 void FileAWSSDK::CheckFile(const std::string hint) const
 {
-    if (!m_IsCached && !head_object.IsSuccess())
+    if (m_OpenMode != Mode::Write && !m_IsCached && !head_object.IsSuccess())
     {
         helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileAWSSDK", "CheckFile",
                                               hint);
@@ -13,10 +13,13 @@
 #define ADIOS2_TOOLKIT_TRANSPORT_FILE_AWSSDK_H_
 
 #include <future> //std::async, std::future
+#include <memory>
+#include <vector>
 
 #include "adios2/common/ADIOSConfig.h"
 #include "adios2/toolkit/transport/Transport.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
+#include "adios2/toolkit/transport/file/S3MultipartUpload.h"
 
 #include <aws/core/Aws.h>
 #include <aws/core/utils/logging/LogLevel.h>
@@ -34,7 +37,7 @@ namespace transport
 {
 
 /** File descriptor transport using the AWSSDK IO library */
-class FileAWSSDK : public Transport
+class FileAWSSDK : public Transport, private S3MultipartUpload::Client
 {
 
 public:
@@ -61,6 +64,10 @@ public:
 
     size_t GetSize() final;
 
+    /** ETag of the object read, empty if it was read from the metadata
+     * cache */
+    std::string GetVersion() final;
+
     /** Does nothing, each write is supposed to flush */
     void Flush() final;
 
@@ -109,6 +116,36 @@ private:
     FileFStream *m_CacheFileRead;
     std::string m_CacheFilePath; // full path to file in cache
 
+    /* Writing: m_Upload uploads the object with a multipart upload in parts
+     * of m_PartSize bytes as they fill, by at most m_UploadThreads concurrent
+     * UploadPart calls. Objects written out of order (metadata) are staged in
+     * memory or under m_StagingPath and uploaded at Close. */
+    size_t m_PartSize = 8 * 1024 * 1024;
+    size_t m_UploadThreads = 4;
+    std::string m_StagingPath;
+    bool m_Staged = false;
+    std::vector<char> m_Stage;
+    FileFStream *m_StageFile = nullptr;
+    std::string m_StageFilePath;
+    size_t m_StageSize = 0;
+    size_t m_WritePos = 0; // bytes handed to the upload so far
+    std::unique_ptr<S3MultipartUpload> m_Upload;
+
+    void StartStaging();
+    void Append(const char *buffer, size_t size);
+    /** uploads what is left and completes the object */
+    void FinishUpload();
+    void AbortUpload() noexcept;
+
+    /* the S3 requests of m_Upload */
+    std::string CreateMultipartUpload() final;
+    std::string UploadPart(const std::string &uploadId, const int partNumber, const char *data,
+                           const size_t size) final;
+    void CompleteMultipartUpload(const std::string &uploadId,
+                                 const std::vector<std::pair<int, std::string>> &parts) final;
+    void AbortMultipartUpload(const std::string &uploadId) noexcept final;
+    void PutObject(const char *data, const size_t size) final;
+
     /**
      * Check if m_FileDescriptor is -1 after an operation
      * @param hint exception message
@@ -0,0 +1,624 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileChunkCache.cpp
+ */
+#include "FileChunkCache.h"
+#include "adios2/helper/adiosLog.h"
+#include "adios2/helper/adiosString.h"
+#include "adios2/helper/adiosSystem.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace adios2
+{
+namespace transport
+{
+
+/* The index file is a Header followed by Header::Slots Slots. Slot i of the
+ * index describes bytes [i * ChunkSize, (i + 1) * ChunkSize) of the data
+ * file. Every field is read and written under the index lock */
+struct FileChunkCache::Header
+{
+    char Magic[8];
+    uint64_t Version;
+    uint64_t ChunkSize;
+    uint64_t Slots;
+    uint64_t Tick; ///< LRU clock, advanced on every use of a slot
+};
+
+struct FileChunkCache::Slot
+{
+    uint64_t Key;
+    uint64_t Version; ///< size and version of the file the chunk came from
+    uint64_t Chunk;
+    uint64_t Length;     ///< valid bytes, less than ChunkSize at end of file
+    uint64_t Tick;       ///< last use
+    uint64_t Generation; ///< changes whenever the slot is taken or filled
+    int64_t Owner;       ///< pid of the process filling the slot
+    uint64_t State;
+};
+
+namespace
+{
+
+constexpr char CacheMagic[8] = {'A', 'D', 'C', 'H', 'U', 'N', 'K', '\0'};
+constexpr uint64_t CacheVersion = 2;
+constexpr uint64_t SlotEmpty = 0;
+constexpr uint64_t SlotFilling = 1;
+constexpr uint64_t SlotValid = 2;
+constexpr size_t MaxWays = 16;
+/** most chunks fetched from the inner transport by one request */
+constexpr size_t MaxRunChunks = 16;
+
+uint64_t HashText(const std::string &text)
+{
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a
+    for (const char c : text)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t Mix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL; // splitmix64 finalizer
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+bool OwnerAlive(const int64_t pid)
+{
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+bool PRead(const int fd, char *buffer, size_t size, off_t offset)
+{
+    while (size > 0)
+    {
+        const ssize_t n = pread(fd, buffer, size, offset);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        buffer += n;
+        size -= static_cast<size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+bool PWrite(const int fd, const char *buffer, size_t size, off_t offset)
+{
+    while (size > 0)
+    {
+        const ssize_t n = pwrite(fd, buffer, size, offset);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        buffer += n;
+        size -= static_cast<size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+} // end anonymous namespace
+
+class FileChunkCache::IndexLock
+{
+public:
+    IndexLock(FileChunkCache &cache) : m_Cache(cache)
+    {
+        m_Cache.m_IndexMutex.lock();
+        while (flock(m_Cache.m_IndexFD, LOCK_EX) != 0 && errno == EINTR)
+        {
+        }
+    }
+
+    ~IndexLock()
+    {
+        flock(m_Cache.m_IndexFD, LOCK_UN);
+        m_Cache.m_IndexMutex.unlock();
+    }
+
+private:
+    FileChunkCache &m_Cache;
+};
+
+FileChunkCache::FileChunkCache(helper::Comm const &comm, std::shared_ptr<Transport> inner)
+: Transport("File", inner->m_Library, comm), m_Inner(std::move(inner))
+{
+    m_ReentrantRead = true;
+}
+
+FileChunkCache::~FileChunkCache() { ReleaseCache(); }
+
+void FileChunkCache::SetParameters(const Params &params)
+{
+    helper::SetParameterValue("chunkcache", params, m_Directory);
+    helper::SetParameterValueInt("verbose", params, m_Verbose, "in call to FileChunkCache");
+    std::string value;
+    helper::SetParameterValue("chunkcachesize", params, value);
+    if (!value.empty())
+    {
+        m_Capacity = helper::StringToByteUnits(helper::LowerCase(value),
+                                               "for chunkcachesize transport parameter");
+    }
+    value.clear();
+    helper::SetParameterValue("chunksize", params, value);
+    if (!value.empty())
+    {
+        m_ChunkSize = std::max(helper::StringToByteUnits(helper::LowerCase(value),
+                                                         "for chunksize transport parameter"),
+                               static_cast<size_t>(4096));
+    }
+
+    // whatever selects the server and object goes into the key
+    m_KeyText.clear();
+    for (const auto &p : params)
+    {
+        if (p.first.compare(0, 5, "chunk") != 0 && p.first != "verbose" &&
+            p.first != "profileunits" && p.first != "asyncopen")
+        {
+            m_KeyText += p.first + "=" + p.second + "\n";
+        }
+    }
+}
+
+void FileChunkCache::Open(const std::string &name, const Mode openMode, const bool /*async*/,
+                          const bool /*directio*/)
+{
+    m_Name = name;
+    m_OpenMode = openMode;
+    if (openMode != Mode::Read)
+    {
+        helper::Throw<std::invalid_argument>("Toolkit", "transport::file::FileChunkCache", "Open",
+                                             "the chunk cache only supports Read mode, file " +
+                                                 m_Name);
+    }
+    if (m_Directory.empty())
+    {
+        helper::Throw<std::invalid_argument>("Toolkit", "transport::file::FileChunkCache", "Open",
+                                             "chunkcache directory parameter is required");
+    }
+    m_Key = HashText(m_KeyText + name);
+    m_Hits = 0;
+    m_Misses = 0;
+
+    ProfilerStart("open");
+    // chunks of the file as it was before a rewrite must not be served
+    m_Size = m_Inner->GetSize();
+    m_Version = HashText(std::to_string(m_Size) + "\n" + m_Inner->GetVersion());
+
+    helper::CreateDirectory(m_Directory);
+    const std::string indexPath(m_Directory + PathSeparator + "index");
+    const std::string dataPath(m_Directory + PathSeparator + "chunks");
+    m_IndexFD = open(indexPath.c_str(), O_RDWR | O_CREAT, 0666);
+    if (m_IndexFD >= 0)
+    {
+        m_DataFD = open(dataPath.c_str(), O_RDWR | O_CREAT, 0666);
+    }
+    if (m_IndexFD < 0 || m_DataFD < 0)
+    {
+        ProfilerStop("open");
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache", "Open",
+                                              "couldn't open cache in " + m_Directory + " " +
+                                                  SysErrMsg());
+    }
+
+    std::string error;
+    size_t invalidated = 0;
+    {
+        IndexLock lock(*this);
+        struct stat st;
+        Header header;
+        std::memset(&header, 0, sizeof(header));
+        if (fstat(m_IndexFD, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(Header))
+        {
+            PRead(m_IndexFD, reinterpret_cast<char *>(&header), sizeof(header), 0);
+        }
+
+        const bool create = std::memcmp(header.Magic, CacheMagic, sizeof(CacheMagic)) != 0;
+        if (create)
+        {
+            // a new cache, or one whose creator died before writing the header
+            header.ChunkSize = m_ChunkSize;
+            header.Slots = std::max(m_Capacity / m_ChunkSize, static_cast<size_t>(1));
+        }
+        else if (header.Version != CacheVersion || header.ChunkSize == 0 || header.Slots == 0)
+        {
+            error = "cache in " + m_Directory + " has an unknown layout";
+        }
+        else if (m_Verbose > 0 && (header.ChunkSize != m_ChunkSize ||
+                                   header.Slots != std::max(m_Capacity / m_ChunkSize,
+                                                            static_cast<size_t>(1))))
+        {
+            std::cout << "FileChunkCache::Open: using the existing geometry of " << m_Directory
+                      << ", " << header.Slots << " chunks of " << header.ChunkSize << " bytes"
+                      << std::endl;
+        }
+
+        if (error.empty())
+        {
+            m_ChunkSize = header.ChunkSize;
+            m_IndexBytes = sizeof(Header) + header.Slots * sizeof(Slot);
+            if (create && ftruncate(m_IndexFD, 0) != 0)
+            {
+                error = "couldn't reset index " + SysErrMsg();
+            }
+            else if (ftruncate(m_IndexFD, m_IndexBytes) != 0 ||
+                     ftruncate(m_DataFD, header.Slots * m_ChunkSize) != 0)
+            {
+                error = "couldn't size the cache " + SysErrMsg();
+            }
+        }
+        if (error.empty())
+        {
+            void *map =
+                mmap(nullptr, m_IndexBytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_IndexFD, 0);
+            if (map == MAP_FAILED)
+            {
+                error = "couldn't map index " + SysErrMsg();
+            }
+            else
+            {
+                m_Header = static_cast<Header *>(map);
+                m_Slots = reinterpret_cast<Slot *>(static_cast<char *>(map) + sizeof(Header));
+                if (create)
+                {
+                    header.Version = CacheVersion;
+                    header.Tick = 0;
+                    std::memcpy(header.Magic, CacheMagic, sizeof(CacheMagic));
+                    *m_Header = header;
+                }
+                else
+                {
+                    invalidated = InvalidateStale();
+                }
+            }
+        }
+    }
+    if (!error.empty())
+    {
+        ProfilerStop("open");
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache", "Open",
+                                              error);
+    }
+
+    ProfilerStop("open");
+    m_IsOpen = true;
+    if (m_Verbose > 0)
+    {
+        std::cout << "FileChunkCache::Open: " << m_Name << " through " << m_Directory << ", "
+                  << m_Header->Slots << " chunks of " << m_ChunkSize << " bytes, "
+                  << invalidated << " stale chunks dropped" << std::endl;
+    }
+}
+
+void FileChunkCache::Write(const char * /*buffer*/, size_t /*size*/, size_t /*start*/)
+{
+    helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache", "Write",
+                                          "the chunk cache is read only, file " + m_Name);
+}
+
+void FileChunkCache::Read(char *buffer, size_t size, size_t start)
+{
+    CheckFile("in call to Read");
+    if (size == 0)
+    {
+        return;
+    }
+    const size_t end = start + size;
+    if (end > KnownSize(end))
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache", "Read",
+                                              "couldn't read " + std::to_string(size) +
+                                                  " bytes at " + std::to_string(start) +
+                                                  " beyond the end of file " + m_Name);
+    }
+
+    ProfilerStart("read");
+    const size_t first = start / m_ChunkSize;
+    const size_t last = (end - 1) / m_ChunkSize;
+    std::vector<size_t> missing;
+    for (size_t c = first; c <= last; ++c)
+    {
+        const size_t from = std::max(start, c * m_ChunkSize);
+        const size_t to = std::min(end, (c + 1) * m_ChunkSize);
+        if (!ReadCached(c, from - c * m_ChunkSize, to - from, buffer + (from - start)))
+        {
+            missing.push_back(c);
+        }
+    }
+    m_Hits += last - first + 1 - missing.size();
+    m_Misses += missing.size();
+
+    // runs of consecutive missing chunks are fetched whole by one request
+    std::vector<char> run;
+    for (size_t i = 0; i < missing.size();)
+    {
+        size_t n = 1;
+        while (i + n < missing.size() && n < MaxRunChunks && missing[i + n] == missing[i] + n)
+        {
+            ++n;
+        }
+        const size_t runStart = missing[i] * m_ChunkSize;
+        const size_t runEnd = std::min((missing[i] + n) * m_ChunkSize, KnownSize(end));
+        run.resize(runEnd - runStart);
+        InnerRead(run.data(), run.size(), runStart);
+
+        const size_t from = std::max(start, runStart);
+        const size_t to = std::min(end, runEnd);
+        std::memcpy(buffer + (from - start), run.data() + (from - runStart), to - from);
+        for (size_t k = 0; k < n; ++k)
+        {
+            const size_t offset = k * m_ChunkSize;
+            Insert(missing[i + k], run.data() + offset,
+                   std::min(m_ChunkSize, run.size() - offset));
+        }
+        i += n;
+    }
+    ProfilerStop("read");
+}
+
+size_t FileChunkCache::GetSize()
+{
+    size_t size;
+    if (m_Inner->m_ReentrantRead)
+    {
+        size = m_Inner->GetSize();
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_InnerMutex);
+        size = m_Inner->GetSize();
+    }
+    std::lock_guard<std::mutex> lock(m_SizeMutex);
+    m_Size = size;
+    return size;
+}
+
+void FileChunkCache::Flush() {}
+
+void FileChunkCache::Close()
+{
+    if (!m_IsOpen)
+    {
+        return;
+    }
+    ReleaseCache();
+    m_Inner->Close();
+    m_IsOpen = false;
+}
+
+void FileChunkCache::Delete()
+{
+    helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache", "Delete",
+                                          "the chunk cache is read only, file " + m_Name);
+}
+
+void FileChunkCache::SeekToEnd() { m_Inner->SeekToEnd(); }
+
+void FileChunkCache::SeekToBegin() { m_Inner->SeekToBegin(); }
+
+void FileChunkCache::Seek(const size_t start) { m_Inner->Seek(start); }
+
+size_t FileChunkCache::CurrentPos() { return m_Inner->CurrentPos(); }
+
+void FileChunkCache::Truncate(const size_t /*length*/)
+{
+    helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache",
+                                          "Truncate",
+                                          "the chunk cache is read only, file " + m_Name);
+}
+
+void FileChunkCache::MkDir(const std::string &fileName) { m_Inner->MkDir(fileName); }
+
+// PRIVATE
+size_t FileChunkCache::KnownSize(const size_t end)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_SizeMutex);
+        if (end <= m_Size)
+        {
+            return m_Size;
+        }
+    }
+    // the file may have grown since it was opened
+    return GetSize();
+}
+
+size_t FileChunkCache::SetOf(const size_t chunk, size_t &ways) const
+{
+    const size_t slots = m_Header->Slots;
+    ways = std::min(MaxWays, slots);
+    const size_t sets = slots / ways;
+    return (Mix(m_Key ^ Mix(chunk)) % sets) * ways;
+}
+
+bool FileChunkCache::ReadCached(const size_t chunk, const size_t offset, const size_t size,
+                                char *buffer)
+{
+    size_t ways;
+    const size_t set = SetOf(chunk, ways);
+    size_t slot = MaxSizeT;
+    uint64_t generation = 0;
+    {
+        IndexLock lock(*this);
+        for (size_t i = set; i < set + ways; ++i)
+        {
+            Slot &s = m_Slots[i];
+            if (s.State == SlotValid && s.Key == m_Key && s.Version == m_Version &&
+                s.Chunk == chunk && s.Length >= offset + size)
+            {
+                s.Tick = ++m_Header->Tick;
+                generation = s.Generation;
+                slot = i;
+                break;
+            }
+        }
+    }
+    if (slot == MaxSizeT)
+    {
+        return false;
+    }
+
+    if (!PRead(m_DataFD, buffer, size, static_cast<off_t>(slot * m_ChunkSize + offset)))
+    {
+        return false;
+    }
+    // another process may have taken the slot while we copied
+    IndexLock lock(*this);
+    return m_Slots[slot].Generation == generation;
+}
+
+void FileChunkCache::Insert(const size_t chunk, const char *data, const size_t length)
+{
+    size_t ways;
+    const size_t set = SetOf(chunk, ways);
+    size_t slot = MaxSizeT;
+    uint64_t generation = 0;
+    {
+        IndexLock lock(*this);
+        for (size_t i = set; i < set + ways; ++i)
+        {
+            const Slot &s = m_Slots[i];
+            const bool busy = s.State == SlotFilling && OwnerAlive(s.Owner);
+            if (s.State != SlotEmpty && s.Key == m_Key && s.Chunk == chunk)
+            {
+                if (busy || (s.State == SlotValid && s.Version == m_Version && s.Length >= length))
+                {
+                    return;
+                }
+                // a shorter copy from before the file grew, or a stale one
+                slot = i;
+                break;
+            }
+            if (!busy && (slot == MaxSizeT || s.Tick < m_Slots[slot].Tick))
+            {
+                slot = i;
+            }
+        }
+        if (slot == MaxSizeT)
+        {
+            return;
+        }
+        Slot &s = m_Slots[slot];
+        s.Key = m_Key;
+        s.Version = m_Version;
+        s.Chunk = chunk;
+        s.Length = 0;
+        s.State = SlotFilling;
+        s.Owner = static_cast<int64_t>(getpid());
+        s.Tick = ++m_Header->Tick;
+        generation = ++s.Generation;
+    }
+
+    const bool written = PWrite(m_DataFD, data, length, static_cast<off_t>(slot * m_ChunkSize));
+    IndexLock lock(*this);
+    Slot &s = m_Slots[slot];
+    if (s.Generation == generation && s.State == SlotFilling)
+    {
+        s.State = written ? SlotValid : SlotEmpty;
+        s.Length = written ? length : 0;
+        ++s.Generation;
+    }
+}
+
+size_t FileChunkCache::InvalidateStale() noexcept
+{
+    size_t invalidated = 0;
+    for (size_t i = 0; i < m_Header->Slots; ++i)
+    {
+        Slot &s = m_Slots[i];
+        if (s.State != SlotEmpty && s.Key == m_Key && s.Version != m_Version &&
+            !(s.State == SlotFilling && OwnerAlive(s.Owner)))
+        {
+            s.State = SlotEmpty;
+            s.Length = 0;
+            ++s.Generation;
+            ++invalidated;
+        }
+    }
+    return invalidated;
+}
+
+void FileChunkCache::ReleaseCache() noexcept
+{
+    if (m_Verbose > 0 && m_Header != nullptr)
+    {
+        std::cout << "FileChunkCache::Close: " << m_Name << " " << m_Hits << " chunks from cache, "
+                  << m_Misses << " fetched" << std::endl;
+    }
+    if (m_Header != nullptr)
+    {
+        munmap(m_Header, m_IndexBytes);
+        m_Header = nullptr;
+        m_Slots = nullptr;
+    }
+    if (m_IndexFD >= 0)
+    {
+        close(m_IndexFD);
+        m_IndexFD = -1;
+    }
+    if (m_DataFD >= 0)
+    {
+        close(m_DataFD);
+        m_DataFD = -1;
+    }
+}
+
+void FileChunkCache::InnerRead(char *buffer, size_t size, size_t start)
+{
+    if (m_Inner->m_ReentrantRead)
+    {
+        m_Inner->Read(buffer, size, start);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_InnerMutex);
+        m_Inner->Read(buffer, size, start);
+    }
+}
+
+void FileChunkCache::CheckFile(const std::string hint) const
+{
+    if (!m_IsOpen)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileChunkCache",
+                                              "CheckFile", "file " + m_Name + " not open, " + hint);
+    }
+}
+
+std::string FileChunkCache::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(errno) + ": " + strerror(errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
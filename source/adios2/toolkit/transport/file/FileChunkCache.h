@@ -0,0 +1,153 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileChunkCache.h read-through cache of fixed size chunks in a node local
+ * directory, in front of any read transport
+ */
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILECHUNKCACHE_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILECHUNKCACHE_H_
+
+#include "../Transport.h"
+#include "adios2/common/ADIOSConfig.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/** Wraps an open read transport. Chunks of the file read through it are
+ * kept in a cache directory shared by all processes on the node: a data file
+ * of chunk slots and a memory mapped index of them, locked with flock. Slots
+ * are set associative and evicted least recently used first. A chunk is only
+ * served to readers that opened the same size and version of the file */
+class FileChunkCache : public Transport
+{
+
+public:
+    /** @param inner an open transport, reads of missing chunks go there */
+    FileChunkCache(helper::Comm const &comm, std::shared_ptr<Transport> inner);
+
+    ~FileChunkCache();
+
+    /**
+     * chunkcache: the cache directory, created if needed (required)
+     * chunkcachesize: capacity of a new cache, in bytes or with units
+     *   (default 1GB)
+     * chunksize: chunk size of a new cache (default 4MB). An existing cache
+     *   keeps the geometry it was made with
+     * The other parameters tell apart the same name on different servers
+     */
+    void SetParameters(const Params &parameters) final;
+
+    /** opens or creates the cache, the inner transport is already open */
+    void Open(const std::string &name, const Mode openMode, const bool async = false,
+              const bool directio = false) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = 0) final;
+
+    size_t GetSize() final;
+
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+    void Seek(const size_t start = MaxSizeT) final;
+
+    size_t CurrentPos() final;
+
+    void Truncate(const size_t length) final;
+
+    void MkDir(const std::string &fileName) final;
+
+    /** chunks read from the cache since Open */
+    size_t Hits() const noexcept { return m_Hits; }
+
+    /** chunks fetched from the inner transport since Open */
+    size_t Misses() const noexcept { return m_Misses; }
+
+private:
+    struct Header;
+    struct Slot;
+
+    std::shared_ptr<Transport> m_Inner;
+    /** serializes the inner transport if its Read is not reentrant */
+    std::mutex m_InnerMutex;
+
+    std::string m_Directory;
+    size_t m_Capacity = 1024 * 1024 * 1024;
+    size_t m_ChunkSize = 4 * 1024 * 1024;
+    int m_Verbose = 0;
+    /** hash of the parameters and name identifying the file in the cache */
+    uint64_t m_Key = 0;
+    std::string m_KeyText;
+    /** hash of the size and GetVersion of the file when it was opened, the
+     * chunks of other versions of the file are stale */
+    uint64_t m_Version = 0;
+
+    int m_IndexFD = -1;
+    int m_DataFD = -1;
+    Header *m_Header = nullptr;
+    Slot *m_Slots = nullptr;
+    size_t m_IndexBytes = 0;
+    /** flock only excludes other open file descriptions, threads of this
+     * process take this first */
+    std::mutex m_IndexMutex;
+
+    size_t m_Size = 0;
+    std::mutex m_SizeMutex;
+
+    std::atomic<size_t> m_Hits{0};
+    std::atomic<size_t> m_Misses{0};
+
+    /** exclusive hold of the index, across threads and processes */
+    class IndexLock;
+
+    /** file size, asked again from the inner transport if end is beyond */
+    size_t KnownSize(const size_t end);
+
+    /** copies [offset, offset + size) of chunk into buffer from the cache,
+     * false if the chunk is not there or was evicted while copying */
+    bool ReadCached(const size_t chunk, const size_t offset, const size_t size, char *buffer);
+
+    /** stores a whole chunk of length bytes, a no-op if every slot it
+     * could go to is being filled */
+    void Insert(const size_t chunk, const char *data, const size_t length);
+
+    /** empties the stale slots of this file, under the index lock
+     * @return number of slots emptied */
+    size_t InvalidateStale() noexcept;
+
+    /** first slot of the set chunk maps to, and the number of slots in a set */
+    size_t SetOf(const size_t chunk, size_t &ways) const;
+
+    /** unmaps and closes the cache, the pool closes transports by
+     * destroying them */
+    void ReleaseCache() noexcept;
+
+    void InnerRead(char *buffer, size_t size, size_t start);
+
+    void CheckFile(const std::string hint) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILECHUNKCACHE_H_ */
@@ -8,7 +8,14 @@
  *      Author: Dmitry Ganyushin  ganyushin@gmail.com
  */
 #include "FileHTTP.h"
+#include "adios2/helper/adiosString.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
 #include <cstring>
+#include <future>
+#include <iostream>
 #ifdef _MSC_VER
 #define FD_SETSIZE 1024
 #include <process.h>
@@ -25,30 +32,73 @@
 #include <cstring>
 #ifndef _WIN32
 #include <netdb.h>
+#include <netinet/tcp.h>
 #endif
 #include <unistd.h>
 #endif
+
+#ifdef MSG_NOSIGNAL
+#define HTTP_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define HTTP_SEND_FLAGS 0
+#endif
 namespace adios2
 {
 namespace transport
 {
 
-FileHTTP::FileHTTP(helper::Comm const &comm) : Transport("File", "HTTP", comm) {}
+namespace
+{
 
-FileHTTP::~FileHTTP()
+/** value of a header in a response header lowercased by the caller */
+std::string HeaderValue(const std::string &headers, const std::string &key)
 {
-    if (m_IsOpen)
+    size_t pos = headers.find("\r\n" + key + ":");
+    if (pos == std::string::npos)
     {
+        return "";
     }
+    pos += key.size() + 3;
+    const size_t end = headers.find("\r\n", pos);
+    while (pos < end && (headers[pos] == ' ' || headers[pos] == '\t'))
+    {
+        ++pos;
+    }
+    return headers.substr(pos, end - pos);
 }
 
-void FileHTTP::WaitForOpen()
+} // end anonymous namespace
+
+FileHTTP::FileHTTP(helper::Comm const &comm) : Transport("File", "HTTP", comm)
 {
-    if (m_IsOpening)
+    m_ReentrantRead = true;
+}
+
+FileHTTP::~FileHTTP() { Close(); }
+
+void FileHTTP::SetParameters(const Params &params)
+{
+    helper::SetParameterValue("hostname", params, m_hostname);
+    helper::SetParameterValueInt("port", params, m_server_port, "in call to FileHTTP");
+    helper::SetParameterValueInt("verbose", params, m_Verbose, "in call to FileHTTP");
+    uint64_t value;
+    if (helper::GetParameter(params, "connections", value))
+    {
+        m_MaxConnections = std::max(static_cast<size_t>(value), static_cast<size_t>(1));
+    }
+    if (helper::GetParameter(params, "split_size", value))
+    {
+        m_SplitSize = std::max(static_cast<size_t>(value), static_cast<size_t>(1));
+    }
+    if (helper::GetParameter(params, "readahead", value))
+    {
+        m_ReadAhead = static_cast<size_t>(value);
+    }
+    if (m_Verbose > 0)
     {
-        m_IsOpening = false;
-        CheckFile("couldn't open file " + m_Name + ", in call to POSIX open");
-        m_IsOpen = true;
+        std::cout << "FileHTTP::SetParameters: host = " << m_hostname << ":" << m_server_port
+                  << " connections = " << m_MaxConnections << " split_size = " << m_SplitSize
+                  << " readahead = " << m_ReadAhead << std::endl;
     }
 }
 
@@ -89,6 +139,7 @@ void FileHTTP::Open(const std::string &name, const Mode openMode, const bool asy
     sockaddr_in.sin_addr.s_addr = addr_tmp;
     sockaddr_in.sin_family = AF_INET;
     sockaddr_in.sin_port = htons(m_server_port);
+    m_IsOpen = true;
 
     return;
 }
@@ -195,124 +246,386 @@ void FilePOSIX::WriteV(const core::iovec *iov, const int iovcnt, size_t start)
 }
 #endif
 
-void FileHTTP::Read(char *buffer, size_t size, size_t start)
+SOCKET FileHTTP::AcquireConnection(bool &reused)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ConnectionsMutex);
+        if (!m_Connections.empty())
+        {
+            SOCKET socketFD = m_Connections.back();
+            m_Connections.pop_back();
+            reused = true;
+            return socketFD;
+        }
+    }
+    reused = false;
+    SOCKET socketFD = socket(AF_INET, SOCK_STREAM, m_p_proto);
+    if (socketFD == -1)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP",
+                                              "AcquireConnection", "cannot open socket");
+    }
+    if (connect(socketFD, (struct sockaddr *)&sockaddr_in, sizeof(sockaddr_in)) == -1)
+    {
+        const std::string error = strerror(errno);
+        close(socketFD);
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP",
+                                              "AcquireConnection",
+                                              "cannot connect to " + m_hostname + ":" +
+                                                  std::to_string(m_server_port) + ": " + error);
+    }
+#ifndef _WIN32
+    // requests are small and the reads latency bound
+    int noDelay = 1;
+    setsockopt(socketFD, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+#endif
+    return socketFD;
+}
+
+void FileHTTP::ReleaseConnection(SOCKET socketFD, const bool keepAlive)
+{
+    if (keepAlive)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_ConnectionsMutex);
+        if (m_Connections.size() < m_MaxConnections)
+        {
+            m_Connections.push_back(socketFD);
+            return;
+        }
+    }
+    close(socketFD);
+}
+
+SOCKET FileHTTP::Request(const std::string &request, int &status, std::string &body,
+                         size_t &contentLength, bool &keepAlive, std::string *version)
 {
     /* not using BUFSIZ, the server might use another value for that */
     const size_t BUF_SIZE = 8192;
-    enum CONSTEXPR
+    const size_t MAX_HEADER_LEN = 65536;
+    char buf[BUF_SIZE];
+
+    for (int attempt = 0;; ++attempt)
     {
-        MAX_REQUEST_LEN = 1024
-    };
-    char request[MAX_REQUEST_LEN] = {'\0'};
-    int request_len = snprintf(request, MAX_REQUEST_LEN, request_template.c_str(), m_Name.c_str(),
-                               m_hostname.c_str(), start, start + size - 1);
-    if (request_len >= MAX_REQUEST_LEN)
+        bool reused = false;
+        SOCKET socketFD = AcquireConnection(reused);
+
+        /* Send HTTP request. */
+        size_t nbytes_total = 0;
+        bool closed = false;
+        while (nbytes_total < request.size())
+        {
+            int nbytes_last = (int)send(socketFD, request.data() + nbytes_total,
+                                        (int)(request.size() - nbytes_total), HTTP_SEND_FLAGS);
+            if (nbytes_last <= 0)
+            {
+                closed = true;
+                break;
+            }
+            nbytes_total += nbytes_last;
+        }
+
+        /* Read the response header, a little of the body may come along */
+        std::string response;
+        size_t headerEnd = std::string::npos;
+        while (!closed && headerEnd == std::string::npos)
+        {
+            int nbytes = (int)recv(socketFD, buf, (int)BUF_SIZE, 0);
+            if (nbytes <= 0)
+            {
+                closed = true;
+                break;
+            }
+            response.append(buf, nbytes);
+            headerEnd = response.find("\r\n\r\n");
+            if (headerEnd == std::string::npos && response.size() > MAX_HEADER_LEN)
+            {
+                close(socketFD);
+                helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP",
+                                                      "Request", "response header too long");
+            }
+        }
+        if (closed)
+        {
+            close(socketFD);
+            // the server may drop an idle keep-alive connection at any time
+            if (reused && response.empty() && attempt == 0)
+            {
+                continue;
+            }
+            helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP",
+                                                  "Request",
+                                                  "no response from " + m_hostname + " for " +
+                                                      request.substr(0, request.find('\r')));
+        }
+
+        std::string headers = response.substr(0, headerEnd + 2);
+        std::transform(headers.begin(), headers.end(), headers.begin(), ::tolower);
+        body = response.substr(headerEnd + 4);
+        status = (headers.size() > 12 && headers.compare(0, 5, "http/") == 0)
+                     ? atoi(headers.c_str() + headers.find(' ') + 1)
+                     : 0;
+        const std::string length = HeaderValue(headers, "content-length");
+        contentLength = length.empty() ? MaxSizeT : std::stoull(length);
+        const std::string connection = HeaderValue(headers, "connection");
+        if (version != nullptr)
+        {
+            *version = HeaderValue(headers, "etag");
+            if (version->empty())
+            {
+                *version = HeaderValue(headers, "last-modified");
+            }
+        }
+        keepAlive = (headers.compare(0, 8, "http/1.1") == 0) ? (connection != "close")
+                                                             : (connection == "keep-alive");
+        if (HeaderValue(headers, "transfer-encoding").find("chunked") != std::string::npos)
+        {
+            close(socketFD);
+            helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP",
+                                                  "Request",
+                                                  "chunked responses are not supported, from " +
+                                                      m_hostname);
+        }
+        if (m_Verbose > 1)
+        {
+            std::cout << "FileHTTP::Request [" << request.substr(0, request.find('\r'))
+                      << "] status " << status << " length " << length
+                      << (reused ? " on a kept-alive connection" : "") << std::endl;
+        }
+        return socketFD;
+    }
+}
+
+size_t FileHTTP::ReadRange(char *buffer, size_t size, size_t start, const bool exact)
+{
+    const size_t BUF_SIZE = 8192;
+    const std::string request = "GET " + m_Name + " HTTP/1.1\r\nHost: " + m_hostname +
+                                "\r\nRange: bytes=" + std::to_string(start) + "-" +
+                                std::to_string(start + size - 1) + "\r\n\r\n";
+    int status;
+    std::string body;
+    size_t contentLength;
+    bool keepAlive;
+    SOCKET socketFD = Request(request, status, body, contentLength, keepAlive);
+
+    // 200: the server ignored the range and sends the file from the start
+    size_t skip = 0;
+    size_t wanted = size;
+    if (status == 206)
     {
-        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "Read",
-                                              "request length too long:  " +
-                                                  std::to_string(request_len));
+        if (contentLength != MaxSizeT && (contentLength > size || (exact && contentLength < size)))
+        {
+            close(socketFD);
+            helper::Throw<std::ios_base::failure>(
+                "Toolkit", "transport::file::FileHTTP", "Read",
+                "server sent " + std::to_string(contentLength) + " bytes for a range of " +
+                    std::to_string(size) + " bytes of " + m_Name);
+        }
+        wanted = std::min(size, contentLength);
     }
-    m_socketFileDescriptor = socket(AF_INET, SOCK_STREAM, m_p_proto);
-    if (m_socketFileDescriptor == -1)
+    else if (status == 200)
     {
-        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "Read",
-                                              "cannot open socket");
+        skip = start;
+        if (contentLength != MaxSizeT && skip + wanted > contentLength)
+        {
+            if (exact)
+            {
+                close(socketFD);
+                helper::Throw<std::ios_base::failure>(
+                    "Toolkit", "transport::file::FileHTTP", "Read",
+                    "cannot read " + std::to_string(size) + " bytes at " + std::to_string(start) +
+                        ", past the end of " + m_Name);
+            }
+            wanted = contentLength > skip ? contentLength - skip : 0;
+        }
     }
-    /* Actually connect. */
-    if (connect(m_socketFileDescriptor, (struct sockaddr *)&sockaddr_in, sizeof(sockaddr_in)) == -1)
+    else
     {
+        close(socketFD);
         helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "Read",
-                                              "cannot connect");
+                                              "HTTP status " + std::to_string(status) +
+                                                  " reading " + m_Name + " from " + m_hostname);
     }
-    /* Send HTTP request. */
-    int nbytes_total = 0;
-    while (nbytes_total < request_len)
-    {
-        int nbytes_last =
-            write(m_socketFileDescriptor, request + nbytes_total, request_len - nbytes_total);
-        if (nbytes_last == -1)
+
+    // body bytes [skip, skip + wanted) go to buffer, the rest is dropped
+    size_t pos = 0;
+    auto lf_Consume = [&](const char *data, size_t n) {
+        if (pos + n > skip && pos < skip + wanted)
         {
-            helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "Read",
-                                                  "cannot send request");
+            const size_t from = std::max(pos, skip);
+            const size_t to = std::min(pos + n, skip + wanted);
+            std::memcpy(buffer + from - skip, data + from - pos, to - from);
         }
-        nbytes_total += nbytes_last;
-    }
+        pos += n;
+    };
+    lf_Consume(body.data(), body.size());
 
-    /* Read the response. */
-    size_t bytes_recd = 0;
-    while (bytes_recd < size)
+    char scratch[BUF_SIZE];
+    while (pos < skip + wanted)
     {
-        size_t remaining = size - bytes_recd;
-        int read_len = (int)(remaining < BUF_SIZE ? remaining : BUF_SIZE);
-        nbytes_total = read(m_socketFileDescriptor, buffer + bytes_recd, read_len);
-        if (nbytes_total == -1)
+        int nbytes;
+        if (pos < skip)
         {
+            nbytes = (int)recv(socketFD, scratch, (int)std::min(skip - pos, BUF_SIZE), 0);
+            if (nbytes > 0)
+            {
+                pos += nbytes;
+            }
+        }
+        else
+        {
+            // straight into the destination
+            const size_t remaining = std::min(skip + wanted - pos, (size_t)INT_MAX);
+            nbytes = (int)recv(socketFD, buffer + pos - skip, (int)remaining, 0);
+            if (nbytes > 0)
+            {
+                pos += nbytes;
+            }
+        }
+        if (nbytes <= 0)
+        {
+            close(socketFD);
             helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "Read",
                                                   "cannot get response");
         }
-        bytes_recd += nbytes_total;
     }
 
-    close(m_socketFileDescriptor);
-    return;
+    // unread body bytes leave the connection unusable for the next request
+    ReleaseConnection(socketFD, keepAlive && contentLength == pos);
+    return wanted;
 }
 
-size_t FileHTTP::GetSize()
+void FileHTTP::Read(char *buffer, size_t size, size_t start)
 {
-    char request_template[] = "GET %s HTTP/1.1\r\nHost: %s\r\nContent-Length: bytes\r\n\r\n";
-    enum CONSTEXPR
+    if (size == 0)
+    {
+        return;
+    }
+
+    if (size < m_ReadAhead)
     {
-        MAX_REQUEST_LEN = 1024,
-        BUF_SIZE = 128
+        // small reads nearby are served from one larger request
+        size_t generation;
+        {
+            std::lock_guard<std::mutex> lockGuard(m_WindowMutex);
+            if (start >= m_WindowStart && start + size <= m_WindowStart + m_Window.size())
+            {
+                std::memcpy(buffer, m_Window.data() + start - m_WindowStart, size);
+                return;
+            }
+            generation = m_WindowGeneration;
+        }
+        // fetched without the lock, other threads keep reading meanwhile
+        std::vector<char> window(m_ReadAhead);
+        window.resize(ReadRange(window.data(), m_ReadAhead, start, false));
+        if (size > window.size())
+        {
+            helper::Throw<std::ios_base::failure>(
+                "Toolkit", "transport::file::FileHTTP", "Read",
+                "cannot read " + std::to_string(size) + " bytes at " + std::to_string(start) +
+                    ", past the end of " + m_Name);
+        }
+        std::memcpy(buffer, window.data(), size);
+        std::lock_guard<std::mutex> lockGuard(m_WindowMutex);
+        // unless GetSize dropped the window while this one was fetched
+        if (generation == m_WindowGeneration)
+        {
+            m_Window.swap(window);
+            m_WindowStart = start;
+        }
+        return;
+    }
+
+    const size_t pieces = std::min(m_MaxConnections, size / m_SplitSize);
+    if (pieces < 2)
+    {
+        ReadRange(buffer, size, start);
+        return;
+    }
+
+    // concurrent range requests, each on a connection of its own
+    auto lf_Piece = [&](const size_t piece) {
+        const size_t from = piece * size / pieces;
+        const size_t to = (piece + 1) * size / pieces;
+        ReadRange(buffer + from, to - from, start + from);
     };
-    char request[MAX_REQUEST_LEN];
-    char buffer[BUF_SIZE] = {'\0'};
-    int request_len =
-        snprintf(request, MAX_REQUEST_LEN, request_template, m_Name.c_str(), m_hostname.c_str());
-    if (request_len >= MAX_REQUEST_LEN)
+    std::vector<std::future<void>> futures;
+    for (size_t piece = 1; piece < pieces; ++piece)
     {
-        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "GetSize",
-                                              "request length too long:  " +
-                                                  std::to_string(request_len));
+        futures.push_back(std::async(std::launch::async, lf_Piece, piece));
     }
-    m_socketFileDescriptor = socket(AF_INET, SOCK_STREAM, m_p_proto);
-    if (m_socketFileDescriptor == -1)
+    std::exception_ptr error;
+    try
     {
-        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "GetSize",
-                                              "cannot bind socket");
+        lf_Piece(0);
     }
-    /* Actually connect. */
-    if (connect(m_socketFileDescriptor, (struct sockaddr *)&sockaddr_in, sizeof(sockaddr_in)) == -1)
+    catch (...)
     {
-        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "GetSize",
-                                              "cannot connect");
+        error = std::current_exception();
     }
-    /* Send HTTP request. */
-    int nbytes_total = 0;
-    while (nbytes_total < request_len)
+    for (auto &f : futures)
     {
-        int nbytes_last =
-            write(m_socketFileDescriptor, request + nbytes_total, request_len - nbytes_total);
-        if (nbytes_last == -1)
+        try
         {
-            helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "GetSize",
-                                                  "sending request failed");
+            f.get();
         }
-        nbytes_total += nbytes_last;
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
     }
+}
 
-    /* Read the response. */
-    while ((nbytes_total = read(m_socketFileDescriptor, buffer, BUF_SIZE)) > 0)
-        ;
-    if (nbytes_total == -1)
+size_t FileHTTP::GetSize()
+{
+    const std::string request =
+        "HEAD " + m_Name + " HTTP/1.1\r\nHost: " + m_hostname + "\r\n\r\n";
+    int status;
+    std::string body;
+    size_t contentLength;
+    bool keepAlive;
+    SOCKET socketFD = Request(request, status, body, contentLength, keepAlive);
+    if (status != 200 || contentLength == MaxSizeT)
     {
+        close(socketFD);
         helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FileHTTP", "GetSize",
-                                              "receiving response failed");
+                                              "no size for " + m_Name + " from " + m_hostname +
+                                                  ", HTTP status " + std::to_string(status));
+    }
+    // a HEAD response has no body
+    ReleaseConnection(socketFD, keepAlive && body.empty());
+    {
+        // the file was written since, bytes may have been rewritten in place
+        std::lock_guard<std::mutex> lockGuard(m_WindowMutex);
+        if (contentLength != m_WindowFileSize)
+        {
+            m_Window.clear();
+            m_WindowStart = 0;
+            m_WindowFileSize = contentLength;
+            ++m_WindowGeneration;
+        }
     }
-    close(m_socketFileDescriptor);
-    size_t result = atoi(buffer);
+    return contentLength;
+}
 
-    return result;
+std::string FileHTTP::GetVersion()
+{
+    const std::string request =
+        "HEAD " + m_Name + " HTTP/1.1\r\nHost: " + m_hostname + "\r\n\r\n";
+    int status;
+    std::string body;
+    size_t contentLength;
+    bool keepAlive;
+    std::string version;
+    SOCKET socketFD = Request(request, status, body, contentLength, keepAlive, &version);
+    ReleaseConnection(socketFD, keepAlive && body.empty());
+    return status == 200 ? version : std::string();
 }
 
 void FileHTTP::Flush()
@@ -321,13 +634,22 @@ void FileHTTP::Flush()
      * slows down IO performance */
 }
 
-void FileHTTP::Close() { return; }
+void FileHTTP::Close()
+{
+    std::lock_guard<std::mutex> lockGuard(m_ConnectionsMutex);
+    for (auto socketFD : m_Connections)
+    {
+        close(socketFD);
+    }
+    m_Connections.clear();
+    m_IsOpen = false;
+}
 
 void FileHTTP::Delete() { return; }
 
 void FileHTTP::CheckFile(const std::string hint) const
 {
-    if (m_socketFileDescriptor == -1)
+    if (!m_IsOpen)
     {
         helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::FilePOSIX", "CheckFile",
                                               hint + SysErrMsg());
@@ -18,6 +18,9 @@
 #endif
 #include "../Transport.h"
 #include "adios2/common/ADIOSConfig.h"
+
+#include <mutex>
+#include <vector>
 #ifdef _MSC_VER
 #include <process.h>
 #include <time.h>
@@ -42,7 +45,8 @@ class Comm;
 namespace transport
 {
 
-/** File descriptor transport using the POSIX IO library */
+/** Read-only transport over plain HTTP/1.1 range requests. Connections are
+ * kept alive in a small pool and shared by concurrent Read calls */
 class FileHTTP : public Transport
 {
 
@@ -51,6 +55,18 @@ public:
 
     ~FileHTTP();
 
+    /**
+     * hostname, port: the server (default localhost:9999)
+     * connections: most connections kept open, and reads in flight for one
+     *   large Read (default 8)
+     * split_size: a Read of at least twice this many bytes is split into
+     *   concurrent range requests of at least this size (default 4MB)
+     * readahead: a smaller Read fetches this many bytes, later Reads inside
+     *   them do not go to the server until GetSize reports a new size
+     *   (default 0, off)
+     */
+    void SetParameters(const Params &parameters) final;
+
     void Open(const std::string &name, const Mode openMode, const bool async = false,
               const bool directio = false) final;
 
@@ -68,6 +84,9 @@ public:
 
     size_t GetSize() final;
 
+    /** ETag, or Last-Modified if the server sends no ETag */
+    std::string GetVersion() final;
+
     /** Does nothing, each write is supposed to flush */
     void Flush() final;
 
@@ -88,24 +107,47 @@ public:
     void MkDir(const std::string &fileName) final;
 
 private:
-    /** POSIX file handle returned by Open */
-    SOCKET m_socketFileDescriptor = -1;
     int m_Errno = 0;
-    bool m_IsOpening = false;
-    /* if filename is very lomg, we can get lout from array boundaries */
-    std::string request_template = "GET %s HTTP/1.1\r\nHost: %s\r\nRange: bytes=%d-%d\r\n\r\n";
     std::string m_hostname = "localhost";
     int m_server_port = 9999;
     struct sockaddr_in sockaddr_in;
     /* protocol number */
     int m_p_proto;
 
-    /**
-     * Check if m_FileDescriptor is -1 after an operation
-     * @param hint exception message
-     */
+    size_t m_MaxConnections = 8;
+    size_t m_SplitSize = 4 * 1024 * 1024;
+    size_t m_ReadAhead = 0;
+    int m_Verbose = 0;
+
+    /** idle keep-alive connections */
+    std::vector<SOCKET> m_Connections;
+    std::mutex m_ConnectionsMutex;
+
+    /** the last readahead window, dropped when GetSize sees another file
+     * size, the generation tells a fetch in flight that it was dropped */
+    std::vector<char> m_Window;
+    size_t m_WindowStart = 0;
+    size_t m_WindowFileSize = 0;
+    size_t m_WindowGeneration = 0;
+    std::mutex m_WindowMutex;
+
+    /** an idle connection from the pool, or a new one */
+    SOCKET AcquireConnection(bool &reused);
+    /** back into the pool if the server keeps it open, else closed */
+    void ReleaseConnection(SOCKET socket, const bool keepAlive);
+
+    /** one range GET straight into buffer, returns the bytes received,
+     * fewer than size only if !exact and the file ends before */
+    size_t ReadRange(char *buffer, size_t size, size_t start, const bool exact = true);
+
+    /** sends request and reads the response header on a pooled connection,
+     * which the caller releases. body gets the bytes received past the
+     * header, contentLength is MaxSizeT if the server did not send it.
+     * version, if given, gets the ETag or Last-Modified header */
+    SOCKET Request(const std::string &request, int &status, std::string &body,
+                   size_t &contentLength, bool &keepAlive, std::string *version = nullptr);
+
     void CheckFile(const std::string hint) const;
-    void WaitForOpen();
     std::string SysErrMsg() const;
 };
 
@@ -555,6 +555,24 @@ size_t FilePOSIX::GetSize()
     return static_cast<size_t>(fileStat.st_size);
 }
 
+std::string FilePOSIX::GetVersion()
+{
+    struct stat fileStat;
+    WaitForOpen();
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        return std::string();
+    }
+    std::string version = std::to_string(fileStat.st_ino) + ":" +
+                          std::to_string(static_cast<int64_t>(fileStat.st_mtime));
+#if defined(__APPLE__)
+    version += "." + std::to_string(fileStat.st_mtimespec.tv_nsec);
+#elif !defined(_MSC_VER)
+    version += "." + std::to_string(fileStat.st_mtim.tv_nsec);
+#endif
+    return version;
+}
+
 void FilePOSIX::Flush()
 {
     /* Turn this off now because BP3/BP4 calls manager Flush and this syncing
@@ -49,6 +49,9 @@ public:
 
     size_t GetSize() final;
 
+    /** inode and modification time */
+    std::string GetVersion() final;
+
     /** Does nothing, each write is supposed to flush */
     void Flush() final;
 
@@ -0,0 +1,158 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * S3MultipartUpload.cpp
+ */
+#include "S3MultipartUpload.h"
+#include "adios2/helper/adiosLog.h"
+
+#include <algorithm>
+#include <ios> //std::ios_base::failure
+
+namespace adios2
+{
+namespace transport
+{
+
+S3MultipartUpload::S3MultipartUpload(Client &client, const std::string &name,
+                                     const size_t partSize, const size_t threads)
+: m_Client(client), m_Name(name), m_PartSize(std::max(partSize, static_cast<size_t>(1))),
+  m_Threads(std::max(threads, static_cast<size_t>(1)))
+{
+}
+
+S3MultipartUpload::~S3MultipartUpload()
+{
+    if (!m_UploadId.empty() || !m_Uploads.empty())
+    {
+        Abort();
+    }
+}
+
+void S3MultipartUpload::Append(const char *buffer, size_t size)
+{
+    while (size > 0)
+    {
+        if (m_Part.capacity() < m_PartSize)
+        {
+            m_Part.reserve(m_PartSize);
+        }
+        const size_t n = std::min(size, m_PartSize - m_Part.size());
+        m_Part.insert(m_Part.end(), buffer, buffer + n);
+        buffer += n;
+        size -= n;
+        if (m_Part.size() == m_PartSize)
+        {
+            UploadPart();
+        }
+    }
+}
+
+std::vector<char> S3MultipartUpload::TakeBuffered()
+{
+    std::vector<char> buffered;
+    std::swap(buffered, m_Part);
+    return buffered;
+}
+
+void S3MultipartUpload::UploadPart()
+{
+    if (m_UploadId.empty())
+    {
+        m_UploadId = m_Client.CreateMultipartUpload();
+    }
+    if (m_PartNumber == 10000)
+    {
+        helper::Throw<std::ios_base::failure>("Toolkit", "transport::file::S3MultipartUpload",
+                                              "UploadPart",
+                                              "S3 allows at most 10000 parts, increase part_size "
+                                              "to write " +
+                                                  m_Name);
+    }
+
+    // a bounded number of parts in flight, the writer waits for the oldest
+    while (m_Uploads.size() >= m_Threads)
+    {
+        auto upload = std::move(m_Uploads.front());
+        m_Uploads.pop_front();
+        upload.get();
+    }
+
+    const int partNumber = ++m_PartNumber;
+    std::vector<char> part;
+    std::swap(part, m_Part);
+    {
+        std::lock_guard<std::mutex> lockGuard(m_UploadMutex);
+        if (!m_FreeParts.empty())
+        {
+            m_Part = std::move(m_FreeParts.back());
+            m_FreeParts.pop_back();
+            m_Part.clear();
+        }
+    }
+
+    auto lf_Upload = [this, partNumber](std::vector<char> data) {
+        const std::string etag =
+            m_Client.UploadPart(m_UploadId, partNumber, data.data(), data.size());
+        std::lock_guard<std::mutex> lockGuard(m_UploadMutex);
+        m_CompletedParts.emplace_back(partNumber, etag);
+        m_FreeParts.push_back(std::move(data));
+    };
+    m_Uploads.push_back(std::async(std::launch::async, lf_Upload, std::move(part)));
+}
+
+void S3MultipartUpload::Finish()
+{
+    if (m_Aborted)
+    {
+        // the failure was reported by the call that aborted
+        return;
+    }
+    if (m_UploadId.empty())
+    {
+        // smaller than one part, a single PutObject
+        m_Client.PutObject(m_Part.data(), m_Part.size());
+        m_Part.clear();
+        return;
+    }
+
+    if (!m_Part.empty())
+    {
+        UploadPart();
+    }
+    while (!m_Uploads.empty())
+    {
+        auto upload = std::move(m_Uploads.front());
+        m_Uploads.pop_front();
+        upload.get();
+    }
+
+    std::sort(m_CompletedParts.begin(), m_CompletedParts.end());
+    m_Client.CompleteMultipartUpload(m_UploadId, m_CompletedParts);
+    m_UploadId.clear();
+}
+
+void S3MultipartUpload::Abort() noexcept
+{
+    m_Aborted = true;
+    for (auto &upload : m_Uploads)
+    {
+        try
+        {
+            upload.get();
+        }
+        catch (...)
+        {
+        }
+    }
+    m_Uploads.clear();
+    if (!m_UploadId.empty())
+    {
+        m_Client.AbortMultipartUpload(m_UploadId);
+        m_UploadId.clear();
+    }
+}
+
+} // end namespace transport
+} // end namespace adios2
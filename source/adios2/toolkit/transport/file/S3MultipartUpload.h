@@ -0,0 +1,93 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * S3MultipartUpload.h parts and concurrency of an S3 multipart upload, the
+ * requests themselves are made by the transport through a Client
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_S3MULTIPARTUPLOAD_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_S3MULTIPARTUPLOAD_H_
+
+#include <deque>
+#include <future> //std::async, std::future
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace adios2
+{
+namespace transport
+{
+
+/** Cuts the bytes appended to an object into parts of partSize bytes and
+ * uploads each full part in the background, at most threads at a time.
+ * An object smaller than one part is written with a single PutObject. */
+class S3MultipartUpload
+{
+public:
+    /** The S3 requests of one object. Each throws std::ios_base::failure if
+     * the request fails, UploadPart is called concurrently for different
+     * parts. */
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+        /** @return the upload id */
+        virtual std::string CreateMultipartUpload() = 0;
+        /** @return the ETag of the part */
+        virtual std::string UploadPart(const std::string &uploadId, const int partNumber,
+                                       const char *data, const size_t size) = 0;
+        /** parts are (part number, ETag) in increasing part number */
+        virtual void
+        CompleteMultipartUpload(const std::string &uploadId,
+                                const std::vector<std::pair<int, std::string>> &parts) = 0;
+        virtual void AbortMultipartUpload(const std::string &uploadId) noexcept = 0;
+        virtual void PutObject(const char *data, const size_t size) = 0;
+    };
+
+    S3MultipartUpload(Client &client, const std::string &name, const size_t partSize,
+                      const size_t threads);
+
+    ~S3MultipartUpload();
+
+    void Append(const char *buffer, size_t size);
+
+    /** uploads what is left and completes the object, does nothing after
+     * Abort */
+    void Finish();
+
+    /** waits for the parts in flight and aborts the upload, the object is
+     * not written */
+    void Abort() noexcept;
+
+    /** parts handed to UploadPart so far */
+    int PartsStarted() const noexcept { return m_PartNumber; }
+
+    /** the appended bytes not yet in a part, only before the first part */
+    std::vector<char> TakeBuffered();
+
+private:
+    Client &m_Client;
+    const std::string m_Name;
+    const size_t m_PartSize;
+    const size_t m_Threads;
+    bool m_Aborted = false;
+
+    std::vector<char> m_Part; // the part being filled
+    std::vector<std::vector<char>> m_FreeParts;
+    std::string m_UploadId;
+    int m_PartNumber = 0;
+    std::vector<std::pair<int, std::string>> m_CompletedParts;
+    std::deque<std::future<void>> m_Uploads;
+    std::mutex m_UploadMutex; // m_FreeParts, m_CompletedParts
+
+    /** uploads m_Part as the next part in the background */
+    void UploadPart();
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_S3MULTIPARTUPLOAD_H_ */
@@ -35,6 +35,7 @@
 
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileChunkCache.h"
 #include "adios2/toolkit/transport/file/FileHTTP.h"
 #endif
 #ifdef ADIOS2_HAVE_OPENSSL
@@ -735,6 +736,21 @@ std::shared_ptr<Transport> TransportMan::OpenFileTransport(const std::string &fi
         transport->Open(fileName, openMode, lf_GetAsyncOpen("false", parameters),
                         lf_GetDirectIO("false", parameters));
     }
+
+#ifndef _WIN32
+    // reads of any library can go through the node local chunk cache
+    if (openMode == Mode::Read && parameters.count("chunkcache") == 1)
+    {
+        auto cache = std::make_shared<transport::FileChunkCache>(m_Comm, transport);
+        if (profile)
+        {
+            cache->InitProfiler(openMode, lf_GetTimeUnits(DefaultTimeUnit, parameters));
+        }
+        cache->SetParameters(parameters);
+        cache->Open(fileName, openMode);
+        transport = cache;
+    }
+#endif
     return transport;
 }
 
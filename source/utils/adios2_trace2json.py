@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Convert the binary per-rank traces written by the BP5 engine
+# (ProfileTraceRecords parameter) into one Chrome Trace / Perfetto JSON file.
+# Load the output in chrome://tracing or https://ui.perfetto.dev
+#
+import argparse
+import glob
+import json
+import struct
+from os.path import exists, isdir, join
+
+MAGIC = b"ADIOS2TR"
+RECORD_FIELDS = "QQIIB7x"
+
+
+def SetupArgs():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--output", "-o", default="trace.json",
+                        help="output JSON file, default=trace.json")
+    parser.add_argument("FILES", nargs="+",
+                        help="trace files, or directories containing *.trace files")
+    args = parser.parse_args()
+    return args
+
+
+def ExpandFileNames(args):
+    files = []
+    for name in args.FILES:
+        if isdir(name):
+            files.extend(sorted(glob.glob(join(name, "*.trace"))))
+        elif exists(name):
+            files.append(name)
+        else:
+            print("ERROR: File " + name + " does not exist", flush=True)
+            exit(1)
+    return files
+
+
+def ReadTrace(fileName):
+    with open(fileName, "rb") as f:
+        data = f.read()
+    if data[0:8] != MAGIC:
+        print("ERROR: " + fileName + " is not an ADIOS2 trace file", flush=True)
+        exit(1)
+    endian = "<" if data[20] == 1 else ">"
+    version, recordSize, rank = struct.unpack_from(endian + "IIi", data, 8)
+    if version != 1:
+        print("ERROR: unsupported trace version " + str(version) + " in " + fileName,
+              flush=True)
+        exit(1)
+    pos = 24
+    startWall, dropped, nNames = struct.unpack_from(endian + "QQQ", data, pos)
+    pos += 24
+    names = []
+    for _ in range(nNames):
+        (length,) = struct.unpack_from(endian + "I", data, pos)
+        pos += 4
+        names.append(data[pos:pos + length].decode("utf-8", "replace"))
+        pos += length
+    (nRecords,) = struct.unpack_from(endian + "Q", data, pos)
+    pos += 8
+    fmt = endian + RECORD_FIELDS
+    records = []
+    for _ in range(nRecords):
+        records.append(struct.unpack_from(fmt, data, pos))
+        pos += recordSize
+    return {"rank": rank, "start": startWall, "dropped": dropped,
+            "names": names, "records": records}
+
+
+def ToChromeEvents(trace, offsetNs):
+    rank = trace["rank"]
+    names = trace["names"]
+    events = [{"name": "process_name", "ph": "M", "pid": rank,
+               "args": {"name": "rank " + str(rank)}}]
+    threads = set()
+    counters = {}
+    for (timestamp, nbytes, event, thread, phase) in trace["records"]:
+        name = names[event] if event < len(names) else str(event)
+        ts = (timestamp + offsetNs) / 1000.0
+        threads.add(thread)
+        if phase == ord("C"):
+            counters[name] = counters.get(name, 0) + nbytes
+            events.append({"name": name, "ph": "C", "ts": ts, "pid": rank,
+                           "args": {"bytes": counters[name]}})
+        else:
+            e = {"name": name, "ph": chr(phase), "ts": ts, "pid": rank,
+                 "tid": thread}
+            if nbytes:
+                e["args"] = {"bytes": nbytes}
+            events.append(e)
+    for thread in sorted(threads):
+        events.append({"name": "thread_name", "ph": "M", "pid": rank,
+                       "tid": thread, "args": {"name": "thread " + str(thread)}})
+    return events
+
+
+if __name__ == "__main__":
+
+    args = SetupArgs()
+    traces = [ReadTrace(f) for f in ExpandFileNames(args)]
+    if not traces:
+        print("ERROR: no trace files found", flush=True)
+        exit(1)
+
+    # align ranks on the wall clock time their recorders were started
+    first = min(t["start"] for t in traces)
+    events = []
+    for t in traces:
+        if t["dropped"]:
+            print("rank {0}: {1} oldest records were overwritten, increase "
+                  "ProfileTraceRecords to keep them".format(t["rank"], t["dropped"]))
+        events.extend(ToChromeEvents(t, t["start"] - first))
+
+    with open(args.output, "w") as out:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, out)
+    print("Wrote " + str(len(events)) + " events to " + args.output)
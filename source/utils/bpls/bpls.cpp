@@ -21,10 +21,14 @@
 #include "verinfo.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cinttypes>
+#include <condition_variable>
 #include <cstdio>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -123,7 +127,8 @@ std::vector<std::regex> varregex;
 #endif
 int ncols = 6; // how many values to print in one row (only for -p)
 int verbose = 0;
-FILE *outf; // file to print to or stdout
+int nthreads = 1;        // number of threads to list variables with
+thread_local FILE *outf; // file to print to or stdout (per listing thread)
 char commentchar;
 
 // help function
@@ -185,6 +190,9 @@ void display_help()
            "                             L2 norm = 0.0, Linf = inf\n"
 
            "  --show-derived             Show the expression string for derived vars\n"
+           "  --threads   | -j <N>       Use N threads to list variables (with -l/-D, not -d)\n"
+           "                               Only for engines with metadata-only queries "
+           "(BP5)\n"
            "  --transport-parameters | -T         Specify File transport "
            "parameters\n"
            "                                      e.g. \"Library=stdio\"\n"
@@ -670,6 +678,9 @@ int bplsMain(int argc, char *argv[])
     arg.AddArgument("-P", argT::SPACE_ARGUMENT, &engine_params, "");
     arg.AddBooleanArgument("--show-derived", &show_derived_expr,
                            "Show the expression string for derived variables");
+    arg.AddArgument("--threads", argT::SPACE_ARGUMENT, &nthreads,
+                    "| -j N    Number of threads to list variables with");
+    arg.AddArgument("-j", argT::SPACE_ARGUMENT, &nthreads, "");
 
     if (!arg.Parse())
     {
@@ -775,6 +786,7 @@ void init_globals()
     nmasks = 0;
     vfile = NULL;
     verbose = 0;
+    nthreads = 1;
     ncols = 6; // by default when printing ascii, print "X Y", not X: Y1 Y2...
     dump = false;
     output_xml = false;
@@ -1099,69 +1111,237 @@ int doList_vars(core::Engine *fp, core::IO *io)
             maxtypelen = len;
     }
 
+    if (nthreads > 1 && !dump && !timestep && !filestream && threadedListingSupported(fp))
+    {
+        int retval = doList_entries_threaded(fp, io, entries, maxlen, maxtypelen);
+        entries.clear();
+        return retval;
+    }
+
     /* VARIABLES */
     for (const auto &entrypair : entries)
     {
         int retval = 0;
         const std::string &name = entrypair.first;
         const Entry &entry = entrypair.second;
-        bool matches = matchesAMask(name.c_str());
-        if (matches)
+        if (matchesAMask(name.c_str()))
         {
             nEntriesMatched++;
+            retval = printEntry(fp, io, name, entry, maxlen, maxtypelen);
+        }
+
+        if (retval && retval != 10) // do not return after unsupported type
+            return retval;
+    }
 
-            // print definition of variable
-            fprintf(outf, "%c %-*s  %-*s", commentchar, maxtypelen,
-                    ToString(entry.typeName).c_str(), maxlen, name.c_str());
-            if (!entry.isVar)
+    entries.clear();
+    return 0;
+}
+
+int printEntry(core::Engine *fp, core::IO *io, const std::string &name, const Entry &entry,
+               int maxlen, int maxtypelen)
+{
+    int retval = 0;
+    // print definition of variable
+    fprintf(outf, "%c %-*s  %-*s", commentchar, maxtypelen, ToString(entry.typeName).c_str(),
+            maxlen, name.c_str());
+    if (!entry.isVar)
+    {
+        // list (and print) attribute
+        if (longopt || dump)
+        {
+            fprintf(outf, "  attr   = ");
+            if (entry.typeName == DataType::Struct)
             {
-                // list (and print) attribute
-                if (longopt || dump)
-                {
-                    fprintf(outf, "  attr   = ");
-                    if (entry.typeName == DataType::Struct)
-                    {
-                        // not supported
-                    }
+                // not supported
+            }
 #define declare_template_instantiation(T)                                                          \
     else if (entry.typeName == helper::GetDataType<T>())                                           \
     {                                                                                              \
         core::Attribute<T> *a = static_cast<core::Attribute<T> *>(entry.attr);                     \
         retval = printAttributeValue(fp, io, a);                                                   \
     }
-                    ADIOS2_FOREACH_ATTRIBUTE_STDTYPE_1ARG(declare_template_instantiation)
+            ADIOS2_FOREACH_ATTRIBUTE_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
-                    fprintf(outf, "\n");
-                    matches = false; // already printed
-                }
-                else
-                {
-                    fprintf(outf, "  attr\n");
-                }
-            }
-            else
-            {
-                if (entry.typeName == DataType::Struct)
-                {
-                    // not supported
-                }
+            fprintf(outf, "\n");
+        }
+        else
+        {
+            fprintf(outf, "  attr\n");
+        }
+    }
+    else
+    {
+        if (entry.typeName == DataType::Struct)
+        {
+            // not supported
+        }
 #define declare_template_instantiation(T)                                                          \
     else if (entry.typeName == helper::GetDataType<T>())                                           \
     {                                                                                              \
         core::Variable<T> *v = static_cast<core::Variable<T> *>(entry.var);                        \
         retval = printVariableInfo(fp, io, v);                                                     \
     }
-                ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
+    }
+    return retval;
+}
+
+bool threadedListingSupported(core::Engine *fp)
+{
+    // BP5 answers MinBlocksInfo/VarShape/VariableMinMax from the installed
+    // metadata without touching engine state, so they can run concurrently
+    return fp->m_EngineType == "BP5Reader";
+}
+
+bool entryNeedsDataRead(const Entry &entry)
+{
+    // a single global value is printed with a Get() in -l mode, which is not
+    // thread-safe, so it is listed by the main thread
+    if (!entry.isVar || !longopt)
+    {
+        return false;
+    }
+    const core::VariableBase *v = entry.var;
+    return v->m_SingleValue && v->m_ShapeID != ShapeID::GlobalArray &&
+           v->GetAvailableStepsCount() == 1;
+}
+
+int doList_entries_threaded(core::Engine *fp, core::IO *io, const EntryMap &entries, int maxlen,
+                            int maxtypelen)
+{
+    std::vector<EntryMap::const_iterator> matched;
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        if (matchesAMask(it->first.c_str()))
+        {
+            matched.push_back(it);
+        }
+    }
+    nEntriesMatched += static_cast<int>(matched.size());
+
+    struct Listing
+    {
+        std::string Text;
+        int Retval = 0;
+        bool Rendered = false; ///< false: main thread has to print it
+        bool Ready = false;
+        std::exception_ptr Error; ///< rethrown by the main thread
+    };
+    std::vector<Listing> listings(matched.size());
+    std::atomic<size_t> next(0);
+    std::atomic<bool> stop(false);
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    // each worker renders into its own scratch file, the main thread streams
+    // the results out in name order as soon as they are ready
+    auto lf_Worker = [&]() {
+        FILE *scratch = tmpfile();
+        outf = scratch;
+        while (!stop)
+        {
+            const size_t i = next++;
+            if (i >= matched.size())
+            {
+                break;
             }
+            Listing listing;
+            if (scratch && !entryNeedsDataRead(matched[i]->second))
+            {
+                try
+                {
+                    rewind(scratch);
+                    listing.Retval = printEntry(fp, io, matched[i]->first, matched[i]->second,
+                                                maxlen, maxtypelen);
+                    const long len = ftell(scratch);
+                    rewind(scratch);
+                    listing.Text.resize(static_cast<size_t>(len));
+                    if (len > 0 && fread(&listing.Text[0], 1, listing.Text.size(), scratch) !=
+                                       listing.Text.size())
+                    {
+                        listing.Text.clear();
+                    }
+                    else
+                    {
+                        listing.Rendered = true;
+                    }
+                }
+                catch (...)
+                {
+                    listing.Error = std::current_exception();
+                }
+            }
+            listing.Ready = true;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                listings[i] = std::move(listing);
+            }
+            cv.notify_all();
+        }
+        if (scratch)
+        {
+            fclose(scratch);
         }
+    };
 
-        if (retval && retval != 10) // do not return after unsupported type
-            return retval;
+    std::vector<std::thread> workers;
+    const size_t nWorkers = std::min(static_cast<size_t>(nthreads), matched.size());
+    for (size_t t = 0; t < nWorkers; ++t)
+    {
+        workers.emplace_back(lf_Worker);
     }
 
-    entries.clear();
-    return 0;
+    int retval = 0;
+    std::exception_ptr error;
+    try
+    {
+        for (size_t i = 0; i < matched.size(); ++i)
+        {
+            Listing listing;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return listings[i].Ready; });
+                listing = std::move(listings[i]);
+            }
+            if (listing.Error)
+            {
+                std::rethrow_exception(listing.Error);
+            }
+            if (listing.Rendered)
+            {
+                fwrite(listing.Text.data(), 1, listing.Text.size(), outf);
+                retval = listing.Retval;
+            }
+            else
+            {
+                retval =
+                    printEntry(fp, io, matched[i]->first, matched[i]->second, maxlen, maxtypelen);
+            }
+            if (retval && retval != 10) // do not return after unsupported type
+            {
+                break;
+            }
+            retval = 0;
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    // the workers are joined before an error leaves, as if listed in order
+    stop = true;
+    for (auto &w : workers)
+    {
+        w.join();
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return retval;
 }
 
 template <class T>
@@ -3248,6 +3428,34 @@ Dims get_global_array_signature(core::Engine *fp, core::IO *io, core::Variable<T
         const size_t nsteps = variable->GetAvailableStepsCount();
         bool firstStep = true;
 
+        // metadata-only fast path: the per-step shape without materializing
+        // the blocks of every step. Joined arrays only have the shape of the
+        // last step there, their blocks are scanned instead
+        Dims shape;
+        if (!variable->m_ReadAsJoined && fp->VarShape(*variable, 0, shape))
+        {
+            for (size_t step = 0; step < nsteps; step++)
+            {
+                if ((step > 0 && !fp->VarShape(*variable, step, shape)) || shape.size() != ndim)
+                {
+                    continue;
+                }
+                for (size_t k = 0; k < ndim; k++)
+                {
+                    if (firstStep)
+                    {
+                        dims[k] = shape[k];
+                    }
+                    else if (dims[k] != shape[k])
+                    {
+                        dims[k] = 0;
+                    }
+                }
+                firstStep = false;
+            }
+            return dims;
+        }
+
         // looping over the absolute step indexes
         // is not supported by a simple API function
         auto minBlocks = fp->MinBlocksInfo(*variable, fp->CurrentStep());
@@ -3468,7 +3676,7 @@ std::pair<size_t, Dims> get_local_array_signature(core::Engine *fp, core::IO *io
     return std::make_pair(nblocks, dims);
 }
 
-static int ndigits_dims[32] = {
+static thread_local int ndigits_dims[32] = {
     8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
 };
 template <class T>
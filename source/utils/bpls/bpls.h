@@ -64,6 +64,14 @@ void printSettings(void);
 int doList(std::string path);
 void mergeLists(int nV, char **listV, int nA, char **listA, char **mlist, bool *isVar);
 
+int printEntry(core::Engine *fp, core::IO *io, const std::string &name, const Entry &entry,
+               int maxlen, int maxtypelen);
+bool threadedListingSupported(core::Engine *fp);
+bool entryNeedsDataRead(const Entry &entry);
+int doList_entries_threaded(core::Engine *fp, core::IO *io,
+                            const std::map<std::string, Entry> &entries, int maxlen,
+                            int maxtypelen);
+
 template <class T>
 int printVariableInfo(core::Engine *fp, core::IO *io, core::Variable<T> *variable);
 
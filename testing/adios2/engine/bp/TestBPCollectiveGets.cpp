@@ -0,0 +1,180 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <cstdint>
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPCollectiveGets : public ::testing::Test
+{
+public:
+    BPCollectiveGets() = default;
+};
+
+static double Value(const size_t step, const size_t row, const size_t col)
+{
+    return static_cast<double>(step * 100000 + row * 100 + col);
+}
+
+//******************************************************************************
+// Readers with a different decomposition than the writers, whose selections
+// overlap, must get the same data as with independent Gets
+//******************************************************************************
+
+TEST_F(BPCollectiveGets, OverlappingSelections)
+{
+    int mpiRank = 0, mpiSize = 1;
+    const size_t rowsPerWriter = 10;
+    const size_t nCols = 7;
+    const size_t nSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPCollectiveGets_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPCollectiveGets.bp");
+    adios2::ADIOS adios;
+#endif
+    const size_t nRows = rowsPerWriter * mpiSize;
+
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        const size_t firstRow = rowsPerWriter * mpiRank;
+        auto var = io.DefineVariable<double>("grid", {nRows, nCols}, {firstRow, 0},
+                                             {rowsPerWriter, nCols});
+        auto local = io.DefineVariable<int32_t>("local", {}, {}, {4});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < nSteps; ++step)
+        {
+            std::vector<double> data(rowsPerWriter * nCols);
+            for (size_t r = 0; r < rowsPerWriter; ++r)
+            {
+                for (size_t c = 0; c < nCols; ++c)
+                {
+                    data[r * nCols + c] = Value(step, firstRow + r, c);
+                }
+            }
+            std::vector<int32_t> block(4, static_cast<int32_t>(step * 10 + mpiRank));
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.Put(local, block.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    for (const std::string threads : {"1", "3"})
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO" + threads);
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("Threads", threads);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+
+        // a band of rows that crosses writer blocks and overlaps the
+        // neighbouring readers' bands, and a few columns
+        const size_t band = nRows / mpiSize;
+        const size_t firstRow = (mpiRank * band > 3 ? mpiRank * band - 3 : 0);
+        const size_t lastRow = std::min(nRows, (mpiRank + 1) * band + 4);
+        const size_t firstCol = 1;
+        const size_t cols = nCols - 2;
+
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("grid");
+            ASSERT_TRUE(var);
+            var.SetSelection({{firstRow, firstCol}, {lastRow - firstRow, cols}});
+            std::vector<double> data;
+            reader.Get(var, data);
+
+            // every rank asks for the block of writer 0
+            auto local = io.InquireVariable<int32_t>("local");
+            ASSERT_TRUE(local);
+            local.SetBlockSelection(0);
+            std::vector<int32_t> block;
+            reader.Get(local, block);
+
+            reader.PerformCollectiveGets();
+
+            ASSERT_EQ(data.size(), (lastRow - firstRow) * cols);
+            for (size_t r = 0; r < lastRow - firstRow; ++r)
+            {
+                for (size_t c = 0; c < cols; ++c)
+                {
+                    ASSERT_EQ(data[r * cols + c], Value(step, firstRow + r, firstCol + c));
+                }
+            }
+            ASSERT_EQ(block.size(), 4u);
+            for (const auto v : block)
+            {
+                EXPECT_EQ(v, static_cast<int32_t>(step * 10));
+            }
+            reader.EndStep();
+            ++step;
+        }
+        reader.Close();
+        EXPECT_EQ(step, nSteps);
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
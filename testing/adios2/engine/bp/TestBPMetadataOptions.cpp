@@ -0,0 +1,386 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestBPMetadataOptions.cpp : BP5 options that change how the metadata is
+ * written or read
+ */
+#include <algorithm>
+#include <cstdint>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPMetadataOptions : public ::testing::Test
+{
+public:
+    BPMetadataOptions() = default;
+};
+
+/* Everything the reader learned from the metadata, as text */
+static std::string DescribeMetadata(adios2::ADIOS &adios, const std::string &fname,
+                                    const std::string &metadataThreads,
+                                    const std::string &extraParameters = "")
+{
+    adios2::IO io = adios.DeclareIO("ReadIO" + fname + metadataThreads + extraParameters);
+    io.SetEngine(engineName);
+    io.SetParameters(engineParameters);
+    io.SetParameters(extraParameters);
+    io.SetParameter("MetadataThreads", metadataThreads);
+
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    std::ostringstream out;
+    for (const auto &variable : io.AvailableVariables())
+    {
+        out << variable.first << ":";
+        for (const auto &info : variable.second)
+        {
+            out << " " << info.first << "=" << info.second;
+        }
+        out << "\n";
+    }
+    for (const auto &attribute : io.AvailableAttributes())
+    {
+        out << "attribute " << attribute.first << "\n";
+    }
+
+    auto joined = io.InquireVariable<double>("joined");
+    EXPECT_TRUE(joined);
+    for (size_t step = 0; joined && step < joined.Steps(); ++step)
+    {
+        out << "joined step " << step << ":";
+        for (const auto &block : reader.BlocksInfo(joined, step))
+        {
+            out << " " << block.Start[0] << "/" << block.Count[0];
+        }
+        out << "\n";
+    }
+    reader.Close();
+    return out.str();
+}
+
+/* Writes NSteps steps whose metadata varies from step to step */
+static void WriteSteps(adios2::ADIOS &adios, const std::string &fname, const std::string &ioName,
+                       const std::string &extraParameters, const int mpiRank, const int mpiSize)
+{
+    const size_t Nx = 10;
+    const size_t NSteps = 20;
+    adios2::IO io = adios.DeclareIO(ioName);
+    io.SetEngine(engineName);
+    io.SetParameters(engineParameters);
+    io.SetParameters(extraParameters);
+
+    auto global = io.DefineVariable<double>("global", {Nx * mpiSize}, {Nx * mpiRank}, {Nx});
+    auto joined = io.DefineVariable<double>("joined", {adios2::JoinedDim, 2}, {}, {1, 2});
+    auto local = io.DefineVariable<int32_t>("local", {adios2::LocalValueDim});
+    auto str = io.DefineVariable<std::string>("str");
+    auto scalar = io.DefineVariable<float>("scalar");
+
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    std::vector<double> data(Nx);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            data[i] = static_cast<double>(step * 1000 + mpiRank * Nx + i);
+        }
+        writer.BeginStep();
+        writer.Put(global, data.data());
+        // a different number of rows every step
+        joined.SetSelection({{}, {1 + step % 3, 2}});
+        writer.Put(joined, data.data());
+        writer.Put(local, static_cast<int32_t>(step * mpiSize + mpiRank));
+        if (mpiRank == 0)
+        {
+            writer.Put(str, "step" + std::to_string(step));
+        }
+        if (step % 2 && mpiRank == 0)
+        {
+            writer.Put(scalar, static_cast<float>(step));
+        }
+        if (step == 7)
+        {
+            auto late = io.DefineVariable<int32_t>("late");
+            writer.Put(late, 7);
+            io.DefineAttribute<int32_t>("lateAttribute", 7);
+        }
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+/* Size of a file inside the bp directory, -1 if there is no such file */
+static long long FileSize(const std::string &fname, const std::string &file)
+{
+    std::ifstream in(fname + "/" + file, std::ios::binary | std::ios::ate);
+    return in ? static_cast<long long>(in.tellg()) : -1;
+}
+
+/* The metadataDelta byte of the md.idx header */
+static int MetadataDeltaFlag(const std::string &fname)
+{
+    const std::streamoff metadataDeltaPosition = 42;
+    std::ifstream in(fname + "/md.idx", std::ios::binary);
+    in.seekg(metadataDeltaPosition);
+    char flag = -1;
+    in.read(&flag, 1);
+    return in ? flag : -1;
+}
+
+//******************************************************************************
+// Delta encoded metadata must be smaller and read back the same as plain
+// metadata
+//******************************************************************************
+
+TEST_F(BPMetadataOptions, MetadataDelta)
+{
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPMetadataDelta_mpi.bp");
+    const std::string plainName("ADIOS2BPMetadataPlain_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPMetadataDelta.bp");
+    const std::string plainName("ADIOS2BPMetadataPlain.bp");
+    adios2::ADIOS adios;
+#endif
+    WriteSteps(adios, plainName, "PlainIO", "MetadataDeltaKeyframe=0", mpiRank, mpiSize);
+    WriteSteps(adios, fname, "DeltaIO", "MetadataDeltaKeyframe=4", mpiRank, mpiSize);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    // the index tells the reader, and three of every four steps are deltas
+    EXPECT_EQ(MetadataDeltaFlag(plainName), 0);
+    EXPECT_EQ(MetadataDeltaFlag(fname), 1);
+    const long long plainSize = FileSize(plainName, "md.0");
+    const long long deltaSize = FileSize(fname, "md.0");
+    EXPECT_GT(deltaSize, 0);
+    EXPECT_LT(deltaSize, plainSize / 2);
+
+    const std::string plain = DescribeMetadata(adios, plainName, "1");
+    EXPECT_FALSE(plain.empty());
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "1"));
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "4"));
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadDeltaIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto local = io.InquireVariable<int32_t>("local");
+            ASSERT_TRUE(local);
+            // a local value reads back as an array with one element per writer
+            std::vector<int32_t> values;
+            reader.Get(local, values, adios2::Mode::Sync);
+            ASSERT_EQ(values.size(), static_cast<size_t>(mpiSize));
+            EXPECT_EQ(values[mpiRank], static_cast<int32_t>(step * mpiSize + mpiRank));
+            if (mpiRank == 0)
+            {
+                auto str = io.InquireVariable<std::string>("str");
+                ASSERT_TRUE(str);
+                std::string text;
+                reader.Get(str, text, adios2::Mode::Sync);
+                EXPECT_EQ(text, "step" + std::to_string(step));
+            }
+            reader.EndStep();
+            ++step;
+        }
+        reader.Close();
+        EXPECT_EQ(step, static_cast<size_t>(20));
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+        CleanupTestFiles(plainName);
+    }
+}
+
+//******************************************************************************
+// Metadata split over several md.<k> files must read back the same as md.0.
+// There is at most one file per writer rank, a serial run writes md.0 only
+//******************************************************************************
+
+TEST_F(BPMetadataOptions, MetadataPartitions)
+{
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPMetadataPartitions_mpi.bp");
+    const std::string plainName("ADIOS2BPMetadataOneFile_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPMetadataPartitions.bp");
+    const std::string plainName("ADIOS2BPMetadataOneFile.bp");
+    adios2::ADIOS adios;
+#endif
+    WriteSteps(adios, plainName, "OneFileIO", "NumMetadataFiles=1", mpiRank, mpiSize);
+    WriteSteps(adios, fname, "PartitionsIO", "NumMetadataFiles=3", mpiRank, mpiSize);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    const int partitions = std::min(3, mpiSize);
+    for (int k = 0; k < partitions; ++k)
+    {
+        EXPECT_GT(FileSize(fname, "md." + std::to_string(k)), 0) << k;
+    }
+    EXPECT_EQ(FileSize(fname, "md." + std::to_string(partitions)), -1);
+    EXPECT_EQ(FileSize(plainName, "md.1"), -1);
+    if (partitions > 1)
+    {
+        // md.0 only has the metadata of the first partition of ranks
+        EXPECT_LT(FileSize(fname, "md.0"), FileSize(plainName, "md.0"));
+    }
+
+    const std::string plain = DescribeMetadata(adios, plainName, "1");
+    EXPECT_FALSE(plain.empty());
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "1"));
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "4"));
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+        CleanupTestFiles(plainName);
+    }
+}
+
+//******************************************************************************
+// Metadata shared by the ranks of a node must read back the same, in random
+// access and in streaming mode. Only a run with several ranks shares it
+//******************************************************************************
+
+TEST_F(BPMetadataOptions, NodeSharedMetadata)
+{
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPNodeSharedMetadata_mpi.bp");
+    const std::string deltaName("ADIOS2BPNodeSharedMetadataDelta_mpi.bp");
+    const std::string partitionsName("ADIOS2BPNodeSharedMetadataPartitions_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPNodeSharedMetadata.bp");
+    const std::string deltaName("ADIOS2BPNodeSharedMetadataDelta.bp");
+    const std::string partitionsName("ADIOS2BPNodeSharedMetadataPartitions.bp");
+    adios2::ADIOS adios;
+#endif
+    WriteSteps(adios, fname, "SharedIO", "", mpiRank, mpiSize);
+    WriteSteps(adios, deltaName, "SharedDeltaIO", "MetadataDeltaKeyframe=4", mpiRank, mpiSize);
+    WriteSteps(adios, partitionsName, "SharedPartitionsIO",
+               "NumMetadataFiles=3,MetadataDeltaKeyframe=4", mpiRank, mpiSize);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    const std::string plain = DescribeMetadata(adios, fname, "1");
+    EXPECT_FALSE(plain.empty());
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "1", "NodeSharedMetadata=true"));
+    EXPECT_EQ(plain, DescribeMetadata(adios, fname, "4", "NodeSharedMetadata=true"));
+    EXPECT_EQ(plain, DescribeMetadata(adios, deltaName, "4", "NodeSharedMetadata=true"));
+    EXPECT_EQ(plain, DescribeMetadata(adios, partitionsName, "1", "NodeSharedMetadata=true"));
+
+    for (const std::string name : {fname, deltaName, partitionsName})
+    {
+        adios2::IO io = adios.DeclareIO("StreamIO" + name);
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("NodeSharedMetadata", "true");
+        adios2::Engine reader = io.Open(name, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto global = io.InquireVariable<double>("global");
+            EXPECT_TRUE(global);
+            std::vector<double> data;
+            reader.Get(global, data, adios2::Mode::Sync);
+            EXPECT_EQ(data.size(), 10 * static_cast<size_t>(mpiSize));
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                EXPECT_EQ(data[i], static_cast<double>(step * 1000 + i));
+            }
+            auto str = io.InquireVariable<std::string>("str");
+            EXPECT_TRUE(str);
+            std::string value;
+            reader.Get(str, value, adios2::Mode::Sync);
+            EXPECT_EQ(value, "step" + std::to_string(step));
+            EXPECT_EQ(static_cast<bool>(io.InquireVariable<float>("scalar")), step % 2 == 1);
+            reader.EndStep();
+            ++step;
+        }
+        reader.Close();
+        EXPECT_EQ(step, 20u) << name;
+        EXPECT_TRUE(io.InquireAttribute<int32_t>("lateAttribute")) << name;
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+        CleanupTestFiles(deltaName);
+        CleanupTestFiles(partitionsName);
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
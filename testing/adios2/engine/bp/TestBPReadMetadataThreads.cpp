@@ -0,0 +1,204 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPReadMetadataThreads : public ::testing::Test
+{
+public:
+    BPReadMetadataThreads() = default;
+};
+
+/* Everything the reader learned from the metadata, as text */
+static std::string DescribeMetadata(adios2::ADIOS &adios, const std::string &fname,
+                                    const std::string &metadataThreads)
+{
+    adios2::IO io = adios.DeclareIO("ReadIO" + metadataThreads);
+    io.SetEngine(engineName);
+    io.SetParameters(engineParameters);
+    io.SetParameter("MetadataThreads", metadataThreads);
+
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    std::ostringstream out;
+    for (const auto &variable : io.AvailableVariables())
+    {
+        out << variable.first << ":";
+        for (const auto &info : variable.second)
+        {
+            out << " " << info.first << "=" << info.second;
+        }
+        out << "\n";
+    }
+    for (const auto &attribute : io.AvailableAttributes())
+    {
+        out << "attribute " << attribute.first << "\n";
+    }
+
+    auto joined = io.InquireVariable<double>("joined");
+    EXPECT_TRUE(joined);
+    for (size_t step = 0; joined && step < joined.Steps(); ++step)
+    {
+        out << "joined step " << step << ":";
+        for (const auto &block : reader.BlocksInfo(joined, step))
+        {
+            out << " " << block.Start[0] << "/" << block.Count[0];
+        }
+        out << "\n";
+    }
+    reader.Close();
+    return out.str();
+}
+
+//******************************************************************************
+// Parsing the metadata with threads must give the same variables as serially
+//******************************************************************************
+
+TEST_F(BPReadMetadataThreads, SameAsSerial)
+{
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 10;
+    const size_t NSteps = 20;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPReadMetadataThreads_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPReadMetadataThreads.bp");
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+
+        auto global = io.DefineVariable<double>("global", {Nx * mpiSize}, {Nx * mpiRank}, {Nx});
+        auto joined = io.DefineVariable<double>("joined", {adios2::JoinedDim, 2}, {}, {1, 2});
+        auto local = io.DefineVariable<int32_t>("local", {adios2::LocalValueDim});
+        auto str = io.DefineVariable<std::string>("str");
+        auto scalar = io.DefineVariable<float>("scalar");
+
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                data[i] = static_cast<double>(step * 1000 + mpiRank * Nx + i);
+            }
+            writer.BeginStep();
+            writer.Put(global, data.data());
+            // a different number of rows every step
+            joined.SetSelection({{}, {1 + step % 3, 2}});
+            writer.Put(joined, data.data());
+            writer.Put(local, static_cast<int32_t>(step * mpiSize + mpiRank));
+            if (mpiRank == 0)
+            {
+                writer.Put(str, "step" + std::to_string(step));
+            }
+            if (step % 2 && mpiRank == 0)
+            {
+                writer.Put(scalar, static_cast<float>(step));
+            }
+            if (step == 7)
+            {
+                auto late = io.DefineVariable<int32_t>("late");
+                writer.Put(late, 7);
+                io.DefineAttribute<int32_t>("lateAttribute", 7);
+            }
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    const std::string serial = DescribeMetadata(adios, fname, "1");
+    const std::string threaded = DescribeMetadata(adios, fname, "4");
+    EXPECT_FALSE(serial.empty());
+    EXPECT_EQ(serial, threaded);
+
+    // and the data is found where the serial parse finds it
+    {
+        adios2::IO io = adios.DeclareIO("ReadDataIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("MetadataThreads", "4");
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto global = io.InquireVariable<double>("global");
+            ASSERT_TRUE(global);
+            global.SetSelection({{Nx * mpiRank}, {Nx}});
+            std::vector<double> in;
+            reader.Get(global, in, adios2::Mode::Sync);
+            reader.EndStep();
+            ASSERT_EQ(in.size(), Nx);
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                EXPECT_EQ(in[i], static_cast<double>(step * 1000 + mpiRank * Nx + i));
+            }
+            ++step;
+        }
+        reader.Close();
+        EXPECT_EQ(step, NSteps);
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -454,6 +454,109 @@ TEST_F(BPSelectionGetTest, SelectionSize)
     }
 }
 
+// Test reading the coarse levels written with LevelsOfDetail
+TEST_F(BPSelectionGetTest, LevelOfDetail)
+{
+    const size_t Ny = 7;
+    const size_t Nx = 10;
+    const std::string fname("BPSelectionGet_LevelOfDetail.bp");
+
+    adios2::ADIOS adios;
+    // Write two blocks split at an odd row, the coarse rows must not overlap
+    {
+        adios2::IO io = adios.DeclareIO("WriteLodIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        if (!engineParameters.empty())
+        {
+            io.SetParameters(engineParameters);
+        }
+        io.SetParameter("LevelsOfDetail", "2");
+        io.SetParameter("LevelOfDetailMethod", "stride");
+
+        auto var = io.DefineVariable<double>("lod", {Ny, Nx}, {0, 0}, {3, Nx});
+        auto plain = io.DefineVariable<int32_t>("plain", {Nx}, {0}, {Nx});
+        io.DefineAttribute<int32_t>("LevelsOfDetail", 0, "plain");
+        // a user variable that only looks like a companion
+        auto lookalike = io.DefineVariable<int32_t>("plain__lod1", {Nx}, {0}, {Nx});
+
+        std::vector<double> data(Ny * Nx);
+        for (size_t i = 0; i < Ny * Nx; ++i)
+        {
+            data[i] = static_cast<double>(i);
+        }
+        std::vector<int32_t> ints(Nx, 1);
+
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        writer.BeginStep();
+        writer.Put(var, data.data(), adios2::Mode::Sync);
+        var.SetSelection({{3, 0}, {Ny - 3, Nx}});
+        writer.Put(var, data.data() + 3 * Nx, adios2::Mode::Sync);
+        writer.Put(plain, ints.data(), adios2::Mode::Sync);
+        writer.Put(lookalike, ints.data(), adios2::Mode::Sync);
+        writer.EndStep();
+        writer.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadLodIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+
+        // the companion variables are hidden, the lookalike without levels is not
+        const auto available = io.AvailableVariables();
+        EXPECT_EQ(available.size(), 3u);
+        EXPECT_EQ(available.count("plain__lod1"), 1u);
+        auto written = io.InquireAttribute<uint32_t>("LevelsOfDetailWritten", "lod");
+        ASSERT_TRUE(written);
+        EXPECT_EQ(written.Data().front(), 2u);
+        EXPECT_FALSE(io.InquireAttribute<uint32_t>("LevelsOfDetailWritten", "plain"));
+
+        auto var = io.InquireVariable<double>("lod");
+        ASSERT_TRUE(var);
+
+        // the box is at full resolution, level 1 keeps rows 2, 4 and columns 2, 4, 6, 8
+        auto sel = adios2::Selection::BoundingBox({1, 2}, {5, 7}).WithLevelOfDetail(1);
+        EXPECT_EQ(var.SelectionSize(sel), 8u);
+        std::vector<double> data;
+        reader.Get(var, data, sel, adios2::Mode::Sync);
+        ASSERT_EQ(data.size(), 8u);
+        for (size_t y = 0; y < 2; ++y)
+        {
+            for (size_t x = 0; x < 4; ++x)
+            {
+                EXPECT_EQ(data[y * 4 + x], static_cast<double>((2 + 2 * y) * Nx + 2 + 2 * x));
+            }
+        }
+
+        // level 2 of the whole array keeps every 4th row and column
+        std::vector<double> all;
+        reader.Get(var, all, adios2::Selection::All().WithLevelOfDetail(2), adios2::Mode::Sync);
+        ASSERT_EQ(all.size(), 2u * 3u);
+        for (size_t y = 0; y < 2; ++y)
+        {
+            for (size_t x = 0; x < 3; ++x)
+            {
+                EXPECT_EQ(all[y * 3 + x], static_cast<double>(4 * y * Nx + 4 * x));
+            }
+        }
+
+        // turned off by the attribute
+        auto plain = io.InquireVariable<int32_t>("plain");
+        std::vector<int32_t> ints;
+        EXPECT_THROW(reader.Get(plain, ints, adios2::Selection::All().WithLevelOfDetail(1),
+                                adios2::Mode::Sync),
+                     std::invalid_argument);
+
+        reader.Close();
+    }
+}
+
 // Test ToString() method
 TEST_F(BPSelectionGetTest, SelectionToString)
 {
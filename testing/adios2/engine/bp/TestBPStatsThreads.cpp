@@ -0,0 +1,168 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPStatsThreads : public ::testing::Test
+{
+public:
+    BPStatsThreads() = default;
+};
+
+//******************************************************************************
+// Min/Max of blocks large enough to be computed by background threads, with
+// the extremes in different slices, for deferred, sync and span Puts
+//******************************************************************************
+
+TEST_F(BPStatsThreads, LargeBlocks)
+{
+    int mpiRank = 0, mpiSize = 1;
+    // not a multiple of the threads, so the last slice is longer
+    const size_t nElems = 3500003;
+    const size_t nSteps = 2;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPStatsThreads_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPStatsThreads.bp");
+    adios2::ADIOS adios;
+#endif
+
+    // block b of a step: values around its number, the min near the end
+    // and the max near the start
+    auto lf_Min = [&](size_t step, size_t b) { return -1.0 * (step * 1000 + b * 10 + mpiRank); };
+    auto lf_Max = [&](size_t step, size_t b) { return 1.0e7 + step * 1000 + b * 10 + mpiRank; };
+    auto lf_Fill = [&](double *data, size_t step, size_t b) {
+        std::iota(data, data + nElems, static_cast<double>(b));
+        data[nElems - 2] = lf_Min(step, b);
+        data[5] = lf_Max(step, b);
+    };
+
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("StatsThreads", "3");
+        auto var = io.DefineVariable<double>("v", {}, {}, {nElems});
+        auto var32 = io.DefineVariable<int32_t>("i", {}, {}, {nElems});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < nSteps; ++step)
+        {
+            std::vector<double> deferred(nElems), sync(nElems);
+            std::vector<int32_t> ints(nElems);
+            lf_Fill(deferred.data(), step, 0);
+            lf_Fill(sync.data(), step, 1);
+            std::iota(ints.begin(), ints.end(), static_cast<int32_t>(step));
+            ints[nElems / 2] = -7;
+
+            writer.BeginStep();
+            writer.Put(var, deferred.data());
+            writer.Put(var, sync.data(), adios2::Mode::Sync);
+            // the sync buffer may be reused right away
+            std::fill(sync.begin(), sync.end(), 0.0);
+            auto span = writer.Put(var);
+            lf_Fill(span.data(), step, 2);
+            writer.Put(var32, ints.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine(engineName);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var = io.InquireVariable<double>("v");
+            ASSERT_TRUE(var);
+            const auto blocks = reader.BlocksInfo(var, step);
+            ASSERT_EQ(blocks.size(), 3 * static_cast<size_t>(mpiSize));
+            for (const auto &info : blocks)
+            {
+                const size_t b = info.BlockID % 3;
+                const int writer = static_cast<int>(info.BlockID / 3);
+                EXPECT_EQ(info.Min, -1.0 * (step * 1000 + b * 10 + writer));
+                EXPECT_EQ(info.Max, 1.0e7 + step * 1000 + b * 10 + writer);
+            }
+
+            auto var32 = io.InquireVariable<int32_t>("i");
+            ASSERT_TRUE(var32);
+            const auto blocks32 = reader.BlocksInfo(var32, step);
+            ASSERT_EQ(blocks32.size(), static_cast<size_t>(mpiSize));
+            for (const auto &info : blocks32)
+            {
+                EXPECT_EQ(info.Min, -7);
+                EXPECT_EQ(info.Max, static_cast<int32_t>(step + nElems - 1));
+            }
+            reader.EndStep();
+            ++step;
+        }
+        reader.Close();
+        EXPECT_EQ(step, nSteps);
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,177 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <cstdint>
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPStepBatchedGets : public ::testing::Test
+{
+public:
+    BPStepBatchedGets() = default;
+};
+
+static double Value(const size_t step, const size_t i)
+{
+    return static_cast<double>(step * 1000 + i);
+}
+
+//******************************************************************************
+// A probe point read over all steps at once, whose reads from the steps are
+// merged, must get the same values with any gap and number of threads
+//******************************************************************************
+
+TEST_F(BPStepBatchedGets, ProbeOverSteps)
+{
+    int mpiRank = 0, mpiSize = 1;
+    const size_t nLocal = 50;
+    const size_t nSteps = 40;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPStepBatchedGets_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPStepBatchedGets.bp");
+    adios2::ADIOS adios;
+#endif
+    const size_t nGlobal = nLocal * mpiSize;
+
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        const size_t first = nLocal * mpiRank;
+        auto var = io.DefineVariable<double>("v", {nGlobal}, {first}, {nLocal});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < nSteps; ++step)
+        {
+            std::vector<double> data(nLocal);
+            for (size_t i = 0; i < nLocal; ++i)
+            {
+                data[i] = Value(step, first + i);
+            }
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    for (const std::string gap : {"0", "1MB"})
+    {
+        for (const std::string threads : {"1", "3"})
+        {
+            adios2::IO io = adios.DeclareIO("ReadIO" + gap + threads);
+            io.SetEngine(engineName);
+            io.SetParameters(engineParameters);
+            io.SetParameter("ReadCoalesceGap", gap);
+            io.SetParameter("Threads", threads);
+            adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+            auto var = io.InquireVariable<double>("v");
+            ASSERT_TRUE(var);
+            EXPECT_EQ(var.Steps(), nSteps);
+
+            // two points in every writer block, and a range crossing two blocks
+            const size_t firstStep = 3;
+            const size_t steps = nSteps - 5;
+            std::vector<std::vector<double>> probes;
+            std::vector<size_t> points;
+            for (size_t w = 0; w < static_cast<size_t>(mpiSize); ++w)
+            {
+                points.push_back(w * nLocal + (mpiRank + 1) % nLocal);
+                points.push_back(w * nLocal + nLocal - 2);
+            }
+            probes.resize(points.size());
+            var.SetStepSelection({firstStep, steps});
+            for (size_t p = 0; p < points.size(); ++p)
+            {
+                var.SetSelection({{points[p]}, {1}});
+                reader.Get(var, probes[p]);
+            }
+            const size_t rangeStart = nLocal - 3;
+            const size_t rangeCount = std::min<size_t>(6, nGlobal - rangeStart);
+            std::vector<double> range;
+            var.SetSelection({{rangeStart}, {rangeCount}});
+            reader.Get(var, range);
+            reader.PerformGets();
+
+            for (size_t p = 0; p < points.size(); ++p)
+            {
+                ASSERT_EQ(probes[p].size(), steps);
+                for (size_t s = 0; s < steps; ++s)
+                {
+                    ASSERT_EQ(probes[p][s], Value(firstStep + s, points[p]));
+                }
+            }
+            ASSERT_EQ(range.size(), steps * rangeCount);
+            for (size_t s = 0; s < steps; ++s)
+            {
+                for (size_t i = 0; i < rangeCount; ++i)
+                {
+                    ASSERT_EQ(range[s * rangeCount + i], Value(firstStep + s, rangeStart + i));
+                }
+            }
+            reader.Close();
+        }
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
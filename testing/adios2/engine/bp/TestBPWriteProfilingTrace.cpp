@@ -0,0 +1,206 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+#include "../TestHelpers.h"
+
+std::string engineName;       // comes from command line
+std::string engineParameters; // comes from command line
+
+class BPWriteProfilingTrace : public ::testing::Test
+{
+public:
+    BPWriteProfilingTrace() = default;
+
+    SmallTestData m_TestData;
+};
+
+struct TraceHeader
+{
+    int Rank = -1;
+    uint64_t Dropped = 0;
+    uint64_t NNames = 0;
+    uint64_t NRecords = 0;
+};
+
+/* Parses the fixed part of a ProfileTraceRecords file, names are skipped */
+static bool ReadTraceHeader(const std::string &traceName, TraceHeader &header)
+{
+    std::ifstream file(traceName, std::ios::binary);
+    if (!file.good())
+    {
+        return false;
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    if (data.size() < 56 || std::memcmp(data.data(), "ADIOS2TR", 8) != 0)
+    {
+        return false;
+    }
+    uint32_t version, recordSize;
+    int32_t rank;
+    std::memcpy(&version, data.data() + 8, 4);
+    std::memcpy(&recordSize, data.data() + 12, 4);
+    std::memcpy(&rank, data.data() + 16, 4);
+    std::memcpy(&header.Dropped, data.data() + 32, 8);
+    std::memcpy(&header.NNames, data.data() + 40, 8);
+    size_t pos = 48;
+    for (uint64_t i = 0; i < header.NNames; ++i)
+    {
+        uint32_t length;
+        std::memcpy(&length, data.data() + pos, 4);
+        pos += 4 + length;
+    }
+    std::memcpy(&header.NRecords, data.data() + pos, 8);
+    pos += 8;
+    header.Rank = rank;
+    return version == 1 && pos + header.NRecords * recordSize == data.size();
+}
+
+static void WriteSteps(adios2::IO &io, const std::string &fname, SmallTestData &testData,
+                       const int mpiRank, const int mpiSize)
+{
+    const size_t Nx = 8;
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+    auto r64 = io.DefineVariable<double>("r64", shape, start, count, adios2::ConstantDims);
+
+    adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < 3; ++step)
+    {
+        SmallTestData currentTestData = generateNewSmallTestData(testData, step, mpiRank, mpiSize);
+        bpWriter.BeginStep();
+        bpWriter.Put<double>(r64, currentTestData.R64.data());
+        bpWriter.EndStep();
+    }
+    bpWriter.Close();
+}
+
+//******************************************************************************
+// Every rank writes its own binary trace next to profiling.json
+//******************************************************************************
+
+TEST_F(BPWriteProfilingTrace, PerRankTrace)
+{
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPWriteProfilingTrace_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPWriteProfilingTrace.bp");
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("ProfileTraceRecords", "1024");
+        WriteSteps(io, fname, m_TestData, mpiRank, mpiSize);
+    }
+
+    TraceHeader header;
+    const std::string traceName(fname + "/profiling." + std::to_string(mpiRank) + ".trace");
+    ASSERT_TRUE(ReadTraceHeader(traceName, header));
+    EXPECT_EQ(header.Rank, mpiRank);
+    EXPECT_EQ(header.Dropped, 0U);
+    EXPECT_GT(header.NNames, 0U);
+    // at least a begin and an end for each BeginStep and EndStep
+    EXPECT_GE(header.NRecords, 12U);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+//******************************************************************************
+// A full ring keeps the newest records and counts the overwritten ones
+//******************************************************************************
+
+TEST_F(BPWriteProfilingTrace, RingOverflow)
+{
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("ADIOS2BPWriteProfilingTraceOverflow_mpi.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("ADIOS2BPWriteProfilingTraceOverflow.bp");
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+        io.SetParameters(engineParameters);
+        io.SetParameter("ProfileTraceRecords", "4");
+        WriteSteps(io, fname, m_TestData, mpiRank, mpiSize);
+    }
+
+    TraceHeader header;
+    const std::string traceName(fname + "/profiling." + std::to_string(mpiRank) + ".trace");
+    ASSERT_TRUE(ReadTraceHeader(traceName, header));
+    EXPECT_GT(header.Dropped, 0U);
+    EXPECT_GE(header.NRecords, 4U);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    int provided;
+
+    // MPI_THREAD_MULTIPLE is only required if you enable the SST MPI_DP
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    if (argc > 2)
+    {
+        engineParameters = std::string(argv[2]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
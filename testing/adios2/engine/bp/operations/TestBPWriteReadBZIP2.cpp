@@ -1007,6 +1007,97 @@ void BZIP2Accuracy3DSel(const std::string accuracy)
     }
 }
 
+void BZIP2DecompressThreads(const std::string &threads)
+{
+    // Each process writes NBlocks blocks of Nx doubles per step, the reader
+    // decompresses them on DecompressThreads threads
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 10000;
+    const size_t NBlocks = 8;
+    const size_t NSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("BPWR_BZIP2_DecompressThreads_" + threads + "_MPI.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("BPWR_BZIP2_DecompressThreads_" + threads + ".bp");
+    adios2::ADIOS adios;
+#endif
+    const size_t rankStart = mpiRank * NBlocks * Nx;
+    auto lf_Value = [&](const size_t step, const size_t i) -> double {
+        return static_cast<double>(step * 1000000 + i);
+    };
+    {
+        adios2::IO io = adios.DeclareIO("TestIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Variable<double> var_r64 = io.DefineVariable<double>(
+            "r64", {NBlocks * Nx * mpiSize}, {rankStart}, {Nx});
+        adios2::Operator BZIP2Op =
+            adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+        var_r64.AddOperation(BZIP2Op, {});
+
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        std::vector<double> r64s(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            bpWriter.BeginStep();
+            for (size_t b = 0; b < NBlocks; ++b)
+            {
+                for (size_t i = 0; i < Nx; ++i)
+                {
+                    r64s[i] = lf_Value(step, rankStart + b * Nx + i);
+                }
+                var_r64.SetSelection({{rankStart + b * Nx}, {Nx}});
+                bpWriter.Put(var_r64, r64s.data(), adios2::Mode::Sync);
+            }
+            bpWriter.EndStep();
+        }
+        bpWriter.Close();
+    }
+
+    for (const std::string readThreads : {"1", "4"})
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO" + readThreads);
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        io.SetParameters({{"Threads", readThreads}, {"DecompressThreads", threads}});
+
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        std::vector<double> decompressedR64s;
+        while (bpReader.BeginStep() == adios2::StepStatus::OK)
+        {
+            auto var_r64 = io.InquireVariable<double>("r64");
+            EXPECT_TRUE(var_r64);
+            // parts of the first and last block, all of the others
+            const size_t start = rankStart + Nx / 2;
+            const size_t count = (NBlocks - 1) * Nx;
+            var_r64.SetSelection({{start}, {count}});
+            bpReader.Get(var_r64, decompressedR64s);
+            bpReader.EndStep();
+
+            ASSERT_EQ(decompressedR64s.size(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                ASSERT_EQ(decompressedR64s[i], lf_Value(step, start + i))
+                    << "step=" << step << " i=" << i << " rank=" << mpiRank
+                    << " Threads=" << readThreads;
+            }
+            ++step;
+        }
+        EXPECT_EQ(step, NSteps);
+        bpReader.Close();
+    }
+}
+
 class BPWriteReadBZIP2 : public ::testing::TestWithParam<std::string>
 {
 public:
@@ -1023,6 +1114,20 @@ TEST_P(BPWriteReadBZIP2, ADIOS2BPWriteReadBZIP21DSel) { BZIP2Accuracy1DSel(GetPa
 TEST_P(BPWriteReadBZIP2, ADIOS2BPWriteReadBZIP22DSel) { BZIP2Accuracy2DSel(GetParam()); }
 TEST_P(BPWriteReadBZIP2, ADIOS2BPWriteReadBZIP23DSel) { BZIP2Accuracy3DSel(GetParam()); }
 
+class BPWriteReadBZIP2DecompressThreads : public ::testing::TestWithParam<std::string>
+{
+public:
+    BPWriteReadBZIP2DecompressThreads() = default;
+};
+
+TEST_P(BPWriteReadBZIP2DecompressThreads, ADIOS2BPWriteReadBZIP2DecompressThreads)
+{
+    BZIP2DecompressThreads(GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(BZIP2DecompressThreads, BPWriteReadBZIP2DecompressThreads,
+                         ::testing::Values("0", "1", "3"));
+
 INSTANTIATE_TEST_SUITE_P(BZIP2Accuracy, BPWriteReadBZIP2,
                          ::testing::Values(adios2::ops::bzip2::value::blockSize100k_1,
                                            adios2::ops::bzip2::value::blockSize100k_2,
@@ -212,6 +212,80 @@ TEST_F(BPWriteReadMGARDMDR, BPWRMGARD1D)
     }
 }
 
+TEST_F(BPWriteReadMGARDMDR, BPWRMGARDProgressive)
+{
+    // Refactor a dataset with MDR, then read the same block
+    // with tighter and tighter accuracies
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 30000; // 100k minimum data size for MDR
+
+    std::vector<double> r64s(Nx);
+    const double value = (2 * 3.141592653589793238462643383279) / double(Nx);
+    for (size_t x = 0; x < Nx; ++x)
+    {
+        r64s[x] = std::cos(value * x);
+    }
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    const std::string fname("BPWRMGARDMDRProgressive_MPI.bp");
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    const std::string fname("BPWRMGARDMDRProgressive.bp");
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        auto var_r64 = io.DefineVariable<double>("r64", {Nx * mpiSize}, {Nx * mpiRank}, {Nx},
+                                                 adios2::ConstantDims);
+        var_r64.AddOperation(adios2::ops::MDR, {{"accuracy_levels", "true"}});
+        adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+        bpWriter.BeginStep();
+        bpWriter.Put(var_r64, r64s.data());
+        bpWriter.EndStep();
+        bpWriter.Close();
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        if (!engineName.empty())
+        {
+            io.SetEngine(engineName);
+        }
+        adios2::Engine bpReader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+        auto var_r64 = io.InquireVariable<double>("r64");
+        ASSERT_TRUE(var_r64);
+        var_r64.SetSelection({{mpiRank * Nx}, {Nx}});
+
+        // each read only fetches the components the previous one did not have
+        for (double error : {0.1, 0.0001, 0.0000001})
+        {
+            std::vector<double> read64s;
+            var_r64.SetAccuracy({error, adios2::Linf_norm, false});
+            bpReader.Get(var_r64, read64s, adios2::Mode::Sync);
+            ASSERT_EQ(read64s.size(), Nx);
+            double maxDiff = 0.0;
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                maxDiff = std::max(maxDiff, std::abs(r64s[i] - read64s[i]));
+            }
+            ASSERT_LE(maxDiff, var_r64.GetAccuracy().error);
+        }
+        bpReader.Close();
+    }
+
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
@@ -857,6 +857,131 @@ void HDF5Steps3D8x2x4(const size_t ghostCells)
     }
 }
 
+void HDF5DeferredQueue(const size_t ghostCells)
+{
+    // Several deferred blocks of one variable, each from its own padded
+    // buffer, go through the write queue: the padded buffers are reused
+    // after PerformPuts and a 2D block is queued after that
+    const std::string fname("HDF5DeferredQueue_" + std::to_string(ghostCells) + ".h5");
+
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 6;
+    const size_t Ny = 3;
+    const size_t NSteps = 2;
+
+#ifdef TEST_HDF5_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#ifdef TEST_HDF5_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    const size_t paddedX = Nx + 2 * ghostCells;
+    const size_t paddedY = Ny + 2 * ghostCells;
+    auto lf_Value1D = [&](size_t step, size_t globalX) {
+        return static_cast<double>(step * 1000 + globalX);
+    };
+    auto lf_Value2D = [&](size_t step, size_t y, size_t globalX) {
+        return static_cast<int32_t>(step * 1000 + y * 100 + globalX);
+    };
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine(engineName);
+
+        auto var_v = io.DefineVariable<double>("v", {2 * Nx * mpiSize}, {0}, {Nx});
+        var_v.SetMemorySelection({{ghostCells}, {paddedX}});
+        auto var_m = io.DefineVariable<int32_t>("m", {Ny, Nx * mpiSize}, {0, Nx * mpiRank},
+                                                {Ny, Nx});
+        var_m.SetMemorySelection({{ghostCells, ghostCells}, {paddedY, paddedX}});
+
+        std::vector<double> block0(paddedX), block1(paddedX);
+        std::vector<int32_t> matrix(paddedY * paddedX);
+
+        adios2::Engine h5Writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            const size_t first = 2 * Nx * mpiRank;
+            std::fill(block0.begin(), block0.end(), -1.);
+            std::fill(block1.begin(), block1.end(), -1.);
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                block0[ghostCells + i] = lf_Value1D(step, first + i);
+                block1[ghostCells + i] = lf_Value1D(step, first + Nx + i);
+            }
+
+            h5Writer.BeginStep();
+            var_v.SetSelection({{first}, {Nx}});
+            h5Writer.Put(var_v, block0.data());
+            var_v.SetSelection({{first + Nx}, {Nx}});
+            h5Writer.Put(var_v, block1.data());
+            h5Writer.PerformPuts();
+
+            // the queue is flushed, the buffers may be reused
+            std::fill(block0.begin(), block0.end(), -2.);
+            std::fill(block1.begin(), block1.end(), -2.);
+
+            std::fill(matrix.begin(), matrix.end(), -1);
+            for (size_t y = 0; y < Ny; ++y)
+            {
+                for (size_t x = 0; x < Nx; ++x)
+                {
+                    matrix[(y + ghostCells) * paddedX + ghostCells + x] =
+                        lf_Value2D(step, y, Nx * mpiRank + x);
+                }
+            }
+            h5Writer.Put(var_m, matrix.data());
+            h5Writer.EndStep();
+        }
+        h5Writer.Close();
+    }
+#ifdef TEST_HDF5_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("ReadIO");
+        io.SetEngine(engineName);
+        adios2::Engine h5Reader = io.Open(fname, adios2::Mode::Read);
+
+        while (h5Reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            const size_t step = h5Reader.CurrentStep();
+            auto var_v = io.InquireVariable<double>("v");
+            auto var_m = io.InquireVariable<int32_t>("m");
+            ASSERT_TRUE(var_v);
+            ASSERT_TRUE(var_m);
+            std::vector<double> v;
+            std::vector<int32_t> m;
+            h5Reader.Get(var_v, v);
+            h5Reader.Get(var_m, m);
+            h5Reader.EndStep();
+
+            ASSERT_EQ(v.size(), 2 * Nx * mpiSize);
+            for (size_t i = 0; i < v.size(); ++i)
+            {
+                EXPECT_EQ(v[i], lf_Value1D(step, i)) << "step " << step << " index " << i;
+            }
+            ASSERT_EQ(m.size(), Ny * Nx * mpiSize);
+            for (size_t y = 0; y < Ny; ++y)
+            {
+                for (size_t x = 0; x < Nx * mpiSize; ++x)
+                {
+                    EXPECT_EQ(m[y * Nx * mpiSize + x], lf_Value2D(step, y, x))
+                        << "step " << step << " y " << y << " x " << x;
+                }
+            }
+        }
+        h5Reader.Close();
+    }
+
+    if (mpiRank == 0)
+    {
+        CleanupTestFiles(fname);
+    }
+}
+
 class HDF5WriteMemSelReadVector : public ::testing::TestWithParam<size_t>
 {
 public:
@@ -871,6 +996,11 @@ TEST_P(HDF5WriteMemSelReadVector, HDF5MemorySelectionSteps2D4x2) { HDF5Steps2D4x
 
 TEST_P(HDF5WriteMemSelReadVector, HDF5MemorySelectionSteps3D4x2x8) { HDF5Steps3D8x2x4(GetParam()); }
 
+TEST_P(HDF5WriteMemSelReadVector, HDF5MemorySelectionDeferredQueue)
+{
+    HDF5DeferredQueue(GetParam());
+}
+
 INSTANTIATE_TEST_SUITE_P(ghostCells, HDF5WriteMemSelReadVector, ::testing::Values(1));
 
 int main(int argc, char **argv)
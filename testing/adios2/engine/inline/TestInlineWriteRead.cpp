@@ -902,7 +902,152 @@ TEST_F(InlineWriteRead, PointerArithmetic)
         EXPECT_EQ(sim_data.data(), global_data);
         EXPECT_EQ(sim_data.data(), local_data);
     }
+
+    // Of two local blocks the last one Put is returned unless a block is
+    // selected
+    std::vector<double> first(N, 1.0), second(N, 2.0);
+    writer.BeginStep();
+    writer.Put(local_array, first.data());
+    writer.Put(local_array, second.data());
+    writer.EndStep();
+    reader.BeginStep();
+    double *local_data = nullptr;
+    reader.Get(local_array, &local_data);
+    EXPECT_EQ(second.data(), local_data);
+    local_array.SetBlockSelection(0);
+    reader.Get(local_array, &local_data);
+    EXPECT_EQ(first.data(), local_data);
+    reader.EndStep();
+}
+
+TEST_F(InlineWriteRead, SelectionAcrossBlocks)
+{
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    adios2::IO io = adios.DeclareIO("TestIO");
+    io.SetEngine("Inline");
+    io.SetParameter("Threads", "2");
+
+    adios2::Engine writer = io.Open("writer", adios2::Mode::Write);
+    adios2::Engine reader = io.Open("reader", adios2::Mode::Read);
+
+    // each rank writes a 4 x 8 slab of a (4 * mpiSize) x 8 array as two 2 x 8 blocks
+    const size_t Nx = 8;
+    const size_t Ny = 4;
+    auto var = io.DefineVariable<int32_t>("a", {Ny * mpiSize, Nx});
+    for (size_t timeStep = 0; timeStep < 2; ++timeStep)
+    {
+        std::vector<int32_t> top(2 * Nx), bottom(2 * Nx);
+        for (size_t i = 0; i < 2 * Nx; ++i)
+        {
+            top[i] = static_cast<int32_t>(timeStep * 1000 + i);
+            bottom[i] = static_cast<int32_t>(timeStep * 1000 + 2 * Nx + i);
+        }
+
+        writer.BeginStep();
+        var.SetSelection({{Ny * mpiRank, 0}, {2, Nx}});
+        writer.Put(var, top.data());
+        var.SetSelection({{Ny * mpiRank + 2, 0}, {2, Nx}});
+        writer.Put(var, bottom.data());
+        writer.EndStep();
+
+        reader.BeginStep();
+        // rows 1..2, columns 2..5 straddle both blocks
+        std::vector<int32_t> hyperslab(2 * 4, -1);
+        var.SetSelection({{Ny * mpiRank + 1, 2}, {2, 4}});
+        reader.Get(var, hyperslab.data());
+        // the selection equals a block, the pointer Get returns it as is
+        var.SetSelection({{Ny * mpiRank + 2, 0}, {2, Nx}});
+        int32_t *blockPtr = nullptr;
+        reader.Get(var, &blockPtr);
+        EXPECT_EQ(blockPtr, bottom.data());
+        std::vector<int32_t> block(2 * Nx, -1);
+        reader.Get(var, block.data(), adios2::Mode::Sync);
+        EXPECT_EQ(block, bottom);
+        reader.EndStep();
+
+        for (size_t r = 0; r < 2; ++r)
+        {
+            for (size_t c = 0; c < 4; ++c)
+            {
+                const size_t row = 1 + r;
+                const size_t col = 2 + c;
+                EXPECT_EQ(hyperslab[r * 4 + c],
+                          static_cast<int32_t>(timeStep * 1000 + row * Nx + col));
+            }
+        }
+    }
+}
+
+TEST_F(InlineWriteRead, MemorySelection)
+{
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    adios2::IO io = adios.DeclareIO("TestIO");
+    io.SetEngine("Inline");
+
+    adios2::Engine writer = io.Open("writer", adios2::Mode::Write);
+    adios2::Engine reader = io.Open("reader", adios2::Mode::Read);
+
+    // each rank writes the 3 x 4 interior of a 5 x 6 buffer with one ghost
+    // cell around it
+    const size_t Nx = 4;
+    const size_t Ny = 3;
+    auto global = io.DefineVariable<int32_t>("g", {Ny * mpiSize, Nx}, {Ny * mpiRank, 0}, {Ny, Nx});
+    global.SetMemorySelection({{1, 1}, {Ny + 2, Nx + 2}});
+    std::vector<int32_t> padded((Ny + 2) * (Nx + 2));
+    std::vector<int32_t> interior(Ny * Nx);
+    for (size_t r = 0; r < Ny + 2; ++r)
+    {
+        for (size_t c = 0; c < Nx + 2; ++c)
+        {
+            const bool ghost = (r == 0 || c == 0 || r == Ny + 1 || c == Nx + 1);
+            padded[r * (Nx + 2) + c] = ghost ? -1 : static_cast<int32_t>(r * 10 + c);
+            if (!ghost)
+            {
+                interior[(r - 1) * Nx + c - 1] = padded[r * (Nx + 2) + c];
+            }
+        }
+    }
+
+    writer.BeginStep();
+    writer.Put(global, padded.data());
+    writer.EndStep();
+
+    reader.BeginStep();
+    // the selection is the block, but the block is not contiguous. Blocks
+    // are numbered per process, this one is block 0
+    std::vector<int32_t> byBox(Ny * Nx, 0);
+    global.SetSelection({{Ny * mpiRank, 0}, {Ny, Nx}});
+    global.SetMemorySelection();
+    reader.Get(global, byBox.data(), adios2::Mode::Sync);
+    EXPECT_EQ(byBox, interior);
+
+    std::vector<int32_t> byBlock(Ny * Nx, 0);
+    global.SetBlockSelection(0);
+    reader.Get(global, byBlock.data(), adios2::Mode::Sync);
+    EXPECT_EQ(byBlock, interior);
+
+    // and into a reader memory selection
+    std::vector<int32_t> padOut((Ny + 2) * (Nx + 2), -1);
+    global.SetMemorySelection({{1, 1}, {Ny + 2, Nx + 2}});
+    reader.Get(global, padOut.data(), adios2::Mode::Sync);
+    EXPECT_EQ(padOut, padded);
+    reader.EndStep();
 }
+
 //******************************************************************************
 // main
 //******************************************************************************
@@ -0,0 +1,137 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+
+#include "TestMhsCommon.h"
+#include <adios2.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <sstream>
+
+using namespace adios2;
+
+class MhsEngineTest : public ::testing::Test
+{
+public:
+    MhsEngineTest() = default;
+};
+
+const size_t NSteps = 5;
+
+void Writer(const Dims &shape, const Dims &start, const Dims &count, const size_t rows,
+            const adios2::Params &engineParams, const std::string &name)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("ms");
+    io.SetEngine("mhs");
+    io.SetParameters(engineParams);
+    io.AddTransport("sirius", {{"variable", "bpFloats"}});
+    io.AddTransport("tier", {{"variable", "bpDoubles"}, {"tier", "2"}});
+    std::vector<int> myInts;
+    std::vector<float> myFloats;
+    std::vector<double> myDoubles;
+    auto bpInts = io.DefineVariable<int>("bpInts", shape, start, count);
+    auto bpFloats = io.DefineVariable<float>("bpFloats", shape, start, count);
+    auto bpDoubles = io.DefineVariable<double>("bpDoubles", shape, start, count);
+    adios2::Engine writerEngine = io.Open(name, adios2::Mode::Write);
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        writerEngine.BeginStep();
+        for (size_t i = 0; i < rows; ++i)
+        {
+            Dims startRow = start;
+            startRow[0] = i;
+            bpInts.SetSelection({startRow, count});
+            bpFloats.SetSelection({startRow, count});
+            bpDoubles.SetSelection({startRow, count});
+            GenData(myInts, step, startRow, count, shape);
+            GenData(myFloats, step, startRow, count, shape);
+            GenData(myDoubles, step, startRow, count, shape);
+            writerEngine.Put(bpInts, myInts.data(), adios2::Mode::Sync);
+            writerEngine.Put(bpFloats, myFloats.data(), adios2::Mode::Sync);
+            writerEngine.Put(bpDoubles, myDoubles.data(), adios2::Mode::Sync);
+        }
+        writerEngine.EndStep();
+    }
+    writerEngine.Close();
+}
+
+void Reader(const Dims &shape, const adios2::Params &engineParams, const std::string &name)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("ms");
+    io.SetEngine("mhs");
+    io.SetParameters(engineParams);
+    adios2::Engine readerEngine = io.Open(name, adios2::Mode::Read);
+    const Dims start(shape.size(), 0);
+    std::vector<int> myInts(std::accumulate(shape.begin(), shape.end(), static_cast<size_t>(1),
+                                            std::multiplies<size_t>()));
+    std::vector<float> myFloats(myInts.size());
+    std::vector<double> myDoubles(myInts.size());
+
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        ASSERT_EQ(readerEngine.BeginStep(), adios2::StepStatus::OK);
+        auto bpInts = io.InquireVariable<int>("bpInts");
+        auto bpFloats = io.InquireVariable<float>("bpFloats");
+        auto bpDoubles = io.InquireVariable<double>("bpDoubles");
+        bpInts.SetSelection({start, shape});
+        bpFloats.SetSelection({start, shape});
+        bpDoubles.SetSelection({start, shape});
+
+        readerEngine.Get(bpInts, myInts.data(), adios2::Mode::Sync);
+        VerifyData(myInts.data(), step, start, shape, shape, "bpInts");
+        readerEngine.Get(bpFloats, myFloats.data(), adios2::Mode::Sync);
+        VerifyData(myFloats.data(), step, start, shape, shape, "bpFloats");
+        readerEngine.Get(bpDoubles, myDoubles.data(), adios2::Mode::Sync);
+        VerifyData(myDoubles.data(), step, start, shape, shape, "bpDoubles");
+        readerEngine.EndStep();
+    }
+    readerEngine.Close();
+}
+
+TEST_F(MhsEngineTest, TestMhsAsyncMigration)
+{
+    std::string filename = "TestMhsAsyncMigration";
+    adios2::Params engineParams = {{"Verbose", "0"}, {"Tiers", "3"}, {"AsyncMigration", "true"}};
+
+    // sirius splits every block in three equal parts
+    size_t rows = 4;
+    Dims shape = {rows, 6, 16};
+    Dims start = {0, 0, 0};
+    Dims count = {1, 6, 16};
+
+    Writer(shape, start, count, rows, engineParams, filename);
+
+    // every step made it to every tier, the routed variable only to tier 2
+    std::ifstream catalogFile(filename + ".catalog");
+    std::stringstream catalog;
+    catalog << catalogFile.rdbuf();
+    EXPECT_NE(catalog.str().find("steps 1 " + std::to_string(NSteps)), std::string::npos);
+    EXPECT_NE(catalog.str().find("steps 2 " + std::to_string(NSteps)), std::string::npos);
+    EXPECT_NE(catalog.str().find("route 2 bpDoubles"), std::string::npos);
+
+    {
+        adios2::ADIOS adios;
+        adios2::IO io = adios.DeclareIO("tier2");
+        adios2::Engine tierReader = io.Open(filename + ".tier2", adios2::Mode::ReadRandomAccess);
+        auto bpDoubles = io.InquireVariable<double>("bpDoubles");
+        ASSERT_TRUE(bpDoubles);
+        EXPECT_EQ(bpDoubles.Steps(), NSteps);
+        EXPECT_FALSE(io.InquireVariable<int>("bpInts"));
+        tierReader.Close();
+    }
+
+    Reader(shape, engineParams, filename);
+}
+
+int main(int argc, char **argv)
+{
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+    return result;
+}
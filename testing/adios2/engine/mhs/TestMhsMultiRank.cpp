@@ -5,6 +5,8 @@
 
 #include "TestMhsCommon.h"
 #include <adios2.h>
+#include <cstdio>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <mpi.h>
 #include <numeric>
@@ -213,6 +215,32 @@ TEST_F(MhsEngineTest, TestMhsMultiRank)
     Dims start = {0, 0, 0};
     Dims count = {1, 8, 16};
 
+    if (mpiRank == 0)
+    {
+        std::remove((filename + ".catalog").c_str());
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    Writer(shape, start, count, rows, engineParams, filename);
+    MPI_Barrier(MPI_COMM_WORLD);
+    // without AsyncMigration or routed variables there is no catalog
+    EXPECT_FALSE(std::ifstream(filename + ".catalog").good());
+
+    Reader(shape, start, count, rows, engineParams, filename);
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST_F(MhsEngineTest, TestMhsMultiRankAsyncMigration)
+{
+    // the slower tiers end their steps in the background, or synchronously
+    // if MPI does not provide MPI_THREAD_MULTIPLE
+    std::string filename = "TestMhsMultiRankAsync";
+    adios2::Params engineParams = {{"Verbose", "0"}, {"Tiers", "4"}, {"AsyncMigration", "true"}};
+
+    size_t rows = 32;
+    Dims shape = {rows, 8, 16};
+    Dims start = {0, 0, 0};
+    Dims count = {1, 8, 16};
+
     Writer(shape, start, count, rows, engineParams, filename);
     MPI_Barrier(MPI_COMM_WORLD);
 
@@ -74,6 +74,7 @@ set (1x1DataWrite_CMD "TestDefSyncWrite --flush --data_size 200 --engine_params
 set (1x1DataWrite_TIMEOUT 360)
 set (1x1.NoPreload_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --rarg=PreloadMode=SstPreloadNone,RENGINE_PARAMS")
 set (1x1.SstRUDP_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --rarg=DataTransport=WAN,WANDataTransport=enet,RENGINE_PARAMS --warg=DataTransport=WAN,WANDataTransport=enet,WENGINE_PARAMS")
+set (1x1.SstShm_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --rarg=DataTransport=shm,RENGINE_PARAMS --warg=DataTransport=shm,WENGINE_PARAMS")
 set (1x1.NoData_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --warg=--no_data --rarg=--no_data")
 set (2x2.NoData_CMD "run_test.py.$<CONFIG> -nw 2 -nr 2 --warg=--no_data --rarg=--no_data")
 set (2x2.HalfNoData_CMD "run_test.py.$<CONFIG> -nw 2 -nr 2 --warg=--no_data --warg=--no_data_node --warg=1 --rarg=--no_data --rarg=--no_data_node --rarg=1" )
@@ -86,6 +87,7 @@ set (2x1ZeroDataR64_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1  -r $<TARGET_FILE:Tes
 set (2x1.NoPreload_CMD "run_test.py.$<CONFIG> -nw 2 -nr 1 --rarg=PreloadMode=SstPreloadNone,RENGINE_PARAMS")
 set (2x3.ForcePreload_CMD "run_test.py.$<CONFIG> -nw 2 -nr 3 --rarg=PreloadMode=SstPreloadOn,RENGINE_PARAMS")
 set (2x3.SstRUDP_CMD "run_test.py.$<CONFIG> -nw 2 -nr 3 --rarg=DataTransport=WAN,WANDataTransport=enet,RENGINE_PARAMS --warg=DataTransport=WAN,WANDataTransport=enet,WENGINE_PARAMS")
+set (2x3.SstShm_CMD "run_test.py.$<CONFIG> -nw 2 -nr 3 --rarg=DataTransport=shm,RENGINE_PARAMS --warg=DataTransport=shm,WENGINE_PARAMS")
 set (1x2_CMD "run_test.py.$<CONFIG> -nw 1 -nr 2")
 set (3x5_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5")
 set (3x5BiDir_CMD "run_test.py.$<CONFIG> -nw 3 -nr 5 -w $<TARGET_FILE:TestBiDir> -r $<TARGET_FILE:TestBiDir> --warg=--writer_first")
@@ -187,6 +189,10 @@ set (LatestReaderHold.1x1_CMD "run_test.py.$<CONFIG> --test_protocol one_client
 
 # A faster writer and a queue policy that will cause timesteps to be discarded
 set (DiscardWriter.1x1_CMD "run_test.py.$<CONFIG> --test_protocol one_client -nw 1 -nr 1 --warg=--engine_params --warg=QueueLimit=1,QueueFullPolicy=discard,WENGINE_PARAMS --warg=--ms_delay --warg=250 --rarg=--discard")
+# Discard with the default QueueLimit of 0 is unlimited, the reader must see every step
+set (DiscardNoLimitWriter.1x1_CMD "run_test.py.$<CONFIG> --test_protocol one_client -nw 1 -nr 1 --warg=--engine_params --warg=QueueFullPolicy=discard,WENGINE_PARAMS --warg=--ms_delay --warg=250")
+set (DropOldestWriter.1x1_CMD "run_test.py.$<CONFIG> --test_protocol one_client -nw 1 -nr 1 --warg=--engine_params --warg=QueueLimit=2,ReserveQueueLimit=1,QueueFullPolicy=DropOldest,WENGINE_PARAMS --warg=--ms_delay --warg=250 --rarg=--discard")
+set (DecimateWriter.1x1_CMD "run_test.py.$<CONFIG> --test_protocol one_client -nw 1 -nr 1 --warg=--engine_params --warg=QueueLimit=1,QueueDecimation=2,QueueMemoryLimit=1Mb,WENGINE_PARAMS --warg=--ms_delay --warg=250 --rarg=--discard")
 
 # Readers using Advancing attributes
 set (CumulativeAttr.1x1_CMD "run_test.py.$<CONFIG> -nw 1 -nr 1 --warg=--advancing_attributes --rarg=--advancing_attributes")
@@ -100,6 +100,65 @@ class TestEngine(unittest.TestCase):
                 self.assertEqual(info[0]["WriterID"], "0")
                 self.assertEqual(info, all_blocks[0])
 
+    def test_get_view_inline(self):
+        adios = Adios()
+        with adios.declare_io("InlineIO") as io:
+            io.set_engine("Inline")
+            left = np.arange(12, dtype=np.float64).reshape(3, 4)
+            right = np.arange(100, 112, dtype=np.float64).reshape(3, 4)
+            grid = io.define_variable("grid", left, [3, 8], [0, 0], [3, 4])
+            writer = io.open("pythontestinline_write", bindings.Mode.Write)
+            reader = io.open("pythontestinline_read", bindings.Mode.Read)
+
+            writer.begin_step()
+            writer.put(grid, left)
+            grid.set_selection([[0, 4], [3, 4]])
+            writer.put(grid, right)
+            writer.end_step()
+
+            reader.begin_step()
+            var = io.inquire_variable("grid")
+            # exactly one writer block: a read-only view on it
+            var.set_selection([[0, 4], [3, 4]])
+            view = reader.get_view(var)
+            self.assertFalse(view.flags.writeable)
+            self.assertEqual(view.ctypes.data, right.ctypes.data)
+            self.assertTrue(np.array_equal(view, right))
+
+            # a box across both blocks is copied
+            var.set_selection([[1, 2], [2, 4]])
+            part = reader.get_view(var)
+            self.assertEqual(part.shape, (2, 4))
+            self.assertNotEqual(part.ctypes.data, left.ctypes.data)
+            whole = np.concatenate((left, right), axis=1)
+            self.assertTrue(np.array_equal(part, whole[1:3, 2:6]))
+
+            # part of a block is copied too
+            var.set_selection([[0, 1], [2, 2]])
+            self.assertTrue(np.array_equal(reader.get_view(var), left[0:2, 1:3]))
+            reader.end_step()
+            reader.close()
+            writer.close()
+
+    def test_get_view_uncovered(self):
+        adios = Adios()
+        with adios.declare_io("BPWriter") as io:
+            temps = io.define_variable(
+                "temps", np.empty([1], dtype=np.int64), shape=[8], start=[0], count=[4]
+            )
+            with io.open("pythontestengine.bp", bindings.Mode.Write) as engine:
+                engine.put(temps, np.array([35, 40, 30, 45], dtype=np.int64))
+
+        with adios.declare_io("BPReader") as reader:
+            with reader.open("pythontestengine.bp", bindings.Mode.Read) as engine:
+                engine.begin_step()
+                temps = reader.inquire_variable("temps")
+                temps.set_selection([[0], [8]])
+                view = engine.get_view(temps)
+                engine.end_step()
+                # no block covers the last four elements
+                self.assertTrue(np.array_equal(view, [35, 40, 30, 45, 0, 0, 0, 0]))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -44,6 +44,21 @@ class TestStream(unittest.TestCase):
                 self.assertEqual(s.read("Coords", block_id=0)[1], -46)
                 self.assertEqual(s.read("humidity", block_id=0).ndim, 2)
 
+                temp = s.read("temp")
+                temp_view = s.read_view("temp")
+                self.assertEqual(temp_view.shape, temp.shape)
+                self.assertTrue(np.array_equal(temp_view, temp))
+
+    def test_read_uncovered(self):
+        with Stream("pythonstreamtest.bp", "w") as s:
+            s.write("temp", np.array([15, 25], dtype=np.int32), shape=[6], start=[2], count=[2])
+
+        with Stream("pythonstreamtest.bp", "r") as s:
+            for _ in s.steps():
+                # only elements 2 and 3 are written, the rest reads as zeros
+                self.assertTrue(np.array_equal(s.read("temp"), [0, 0, 15, 25, 0, 0]))
+                self.assertTrue(np.array_equal(s.read_view("temp"), [0, 0, 15, 25, 0, 0]))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,268 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <adios2/core/ADIOS.h>
+#include <adios2/core/Engine.h>
+#include <adios2/core/IO.h>
+#include <adios2/core/Operator.h>
+#include <adios2/core/Variable.h>
+#include <adios2/helper/adiosFunctions.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace core
+{
+
+namespace
+{
+
+constexpr size_t N = 4096;
+
+/** Stores doubles as byte planes, the most significant byte of every value
+ * first, so that a prefix of the output holds all values with their low
+ * bytes zeroed. A stand-in for a refactoring operator with accuracy levels
+ * that needs no external library. Assumes a little endian host. */
+class BytePlanes : public Operator
+{
+public:
+    static constexpr size_t HeaderSize = 4 + sizeof(uint64_t);
+
+    BytePlanes() : Operator("planes", COMPRESS_NULL, "compress", {}) {}
+
+    size_t Operate(const char *dataIn, const Dims &blockStart, const Dims &blockCount,
+                   const DataType type, char *bufferOut) final
+    {
+        size_t offset = 0;
+        MakeCommonHeader(bufferOut, offset, 1);
+        const uint64_t n = helper::GetTotalSize(blockCount);
+        PutParameter(bufferOut, offset, n);
+        for (size_t p = 0; p < sizeof(double); p++)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                bufferOut[offset++] = dataIn[i * sizeof(double) + sizeof(double) - 1 - p];
+            }
+        }
+
+        const double *values = reinterpret_cast<const double *>(dataIn);
+        m_Levels.clear();
+        for (size_t planes = 1; planes < sizeof(double); planes++)
+        {
+            double error = 0.0;
+            for (size_t i = 0; i < n; i++)
+            {
+                error = std::max(error, std::abs(values[i] - Truncate(values[i], planes)));
+            }
+            m_Levels.emplace_back(error, HeaderSize + planes * n);
+        }
+        return offset;
+    }
+
+    size_t InverseOperate(const char *bufferIn, const size_t sizeIn, char *dataOut) final
+    {
+        size_t offset = 4;
+        const uint64_t n = GetParameter<uint64_t>(bufferIn, offset);
+        // a prefix read for a looser accuracy leaves the low planes out
+        const size_t planes = (sizeIn - HeaderSize) / n;
+        std::memset(dataOut, 0, n * sizeof(double));
+        for (size_t p = 0; p < planes; p++)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                dataOut[i * sizeof(double) + sizeof(double) - 1 - p] = bufferIn[offset++];
+            }
+        }
+        return n * sizeof(double);
+    }
+
+    bool IsDataTypeValid(const DataType type) const final { return type == DataType::Double; }
+
+    bool HasAccuracyLevels() const final { return true; }
+
+    std::vector<std::pair<double, size_t>> GetAccuracyLevels() const final { return m_Levels; }
+
+    /** value with all but its planes most significant bytes zeroed */
+    static double Truncate(const double value, const size_t planes)
+    {
+        char bytes[sizeof(double)];
+        std::memcpy(bytes, &value, sizeof(double));
+        std::memset(bytes, 0, sizeof(double) - planes);
+        double truncated;
+        std::memcpy(&truncated, bytes, sizeof(double));
+        return truncated;
+    }
+
+private:
+    std::vector<std::pair<double, size_t>> m_Levels;
+};
+
+std::vector<double> MakeData()
+{
+    std::vector<double> data(N);
+    for (size_t i = 0; i < N; i++)
+    {
+        data[i] = 1.0 + static_cast<double>(i) / N + 0.5 * std::sin(0.01 * i);
+    }
+    return data;
+}
+
+/** planes the reader needs for an absolute Linf error */
+size_t PlanesFor(const std::vector<double> &data, const double error)
+{
+    for (size_t planes = 1; planes < sizeof(double); planes++)
+    {
+        double maxError = 0.0;
+        for (const double v : data)
+        {
+            maxError = std::max(maxError, std::abs(v - BytePlanes::Truncate(v, planes)));
+        }
+        if (maxError <= error)
+        {
+            return planes;
+        }
+    }
+    return sizeof(double);
+}
+
+size_t PrefixSize(const size_t planes) { return BytePlanes::HeaderSize + planes * N; }
+
+void Write(const std::string &name, const std::vector<double> &data)
+{
+    ADIOS adios("C++");
+    IO &io = adios.DeclareIO("Write");
+    io.SetEngine("BP5");
+    Variable<double> &var = io.DefineVariable<double>("v", {N}, {0}, {N}, true);
+    var.AddOperation(std::make_shared<BytePlanes>());
+    Engine &writer = io.Open(name, Mode::Write);
+    writer.BeginStep();
+    writer.Put(var, data.data(), Mode::Sync);
+    writer.EndStep();
+    writer.Close();
+}
+
+/** data bytes the reader of name read, from the profile it writes on Close */
+size_t DataBytesRead(const std::string &name)
+{
+    std::ostringstream profile;
+    profile << "/tmp/" << name << "_" << std::hex << getpid() << "_profiling.json";
+    std::ifstream file(profile.str());
+    const std::string json((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(profile.str().c_str());
+    const std::string key = "\"databytes\":";
+    const size_t pos = json.find(key);
+    if (pos == std::string::npos)
+    {
+        return 0;
+    }
+    return std::stoull(json.substr(pos + key.size()));
+}
+
+/** reads v from name once per error in order, checks each result and
+ * returns the data bytes read in total */
+size_t ReadAccuracies(const std::string &name, const std::vector<double> &data,
+                      const std::vector<double> &errors, const Mode mode,
+                      const Params &parameters = Params())
+{
+    ADIOS adios("C++");
+    IO &io = adios.DeclareIO("Read");
+    io.SetEngine("BP5");
+    io.SetParameters(parameters);
+    Engine &reader = io.Open(name, mode);
+    if (mode == Mode::Read)
+    {
+        EXPECT_EQ(reader.BeginStep(), StepStatus::OK);
+    }
+    Variable<double> *var = io.InquireVariable<double>("v");
+    EXPECT_NE(var, nullptr);
+    if (var)
+    {
+        var->RemoveOperations();
+        var->AddOperation(std::make_shared<BytePlanes>());
+        for (const double error : errors)
+        {
+            std::vector<double> read(N);
+            var->SetAccuracy({error, Linf_norm, false});
+            reader.Get(*var, read.data(), Mode::Sync);
+            double maxError = 0.0;
+            for (size_t i = 0; i < N; i++)
+            {
+                maxError = std::max(maxError, std::abs(data[i] - read[i]));
+            }
+            EXPECT_LE(maxError, error);
+        }
+    }
+    if (mode == Mode::Read)
+    {
+        reader.EndStep();
+    }
+    reader.Close();
+    return DataBytesRead(name);
+}
+
+} // end anonymous namespace
+
+TEST(BP5AccuracyLevels, Prefix)
+{
+    const std::string name = "TestBP5AccuracyLevelsPrefix.bp";
+    const std::vector<double> data = MakeData();
+    Write(name, data);
+    const size_t coarse = PlanesFor(data, 1e-3);
+    ASSERT_LT(coarse, sizeof(double));
+
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-3}, Mode::Read), PrefixSize(coarse));
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-3}, Mode::ReadRandomAccess), PrefixSize(coarse));
+    // an error of 0 reads the whole block
+    EXPECT_EQ(ReadAccuracies(name, data, {0.0}, Mode::ReadRandomAccess),
+              PrefixSize(sizeof(double)));
+}
+
+TEST(BP5AccuracyLevels, Tighter)
+{
+    const std::string name = "TestBP5AccuracyLevelsTighter.bp";
+    const std::vector<double> data = MakeData();
+    Write(name, data);
+    const size_t coarse = PlanesFor(data, 1e-3);
+    const size_t fine = PlanesFor(data, 1e-9);
+    ASSERT_LT(coarse, fine);
+    ASSERT_LT(fine, sizeof(double));
+
+    // the tighter reads fetch only the planes the coarser ones did not
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-3, 1e-9}, Mode::ReadRandomAccess),
+              PrefixSize(fine));
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-3, 1e-9, 0.0}, Mode::ReadRandomAccess),
+              PrefixSize(sizeof(double)));
+    // a looser read after a tighter one is served from what was read
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-9, 1e-3}, Mode::ReadRandomAccess),
+              PrefixSize(fine) + 1);
+
+    // without a cache every read starts over
+    EXPECT_EQ(ReadAccuracies(name, data, {1e-3, 1e-9}, Mode::ReadRandomAccess,
+                             {{"PrefixCacheSize", "0"}}),
+              PrefixSize(coarse) + PrefixSize(fine));
+}
+
+} // end namespace core
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
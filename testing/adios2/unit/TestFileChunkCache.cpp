@@ -0,0 +1,247 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <adios2/helper/adiosCommDummy.h>
+#include <adios2/toolkit/transport/file/FileChunkCache.h>
+#include <adios2/toolkit/transport/file/FilePOSIX.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace transport
+{
+
+namespace
+{
+
+constexpr size_t ChunkSize = 4096;
+// five whole chunks and a short last one
+constexpr size_t FileSize = 5 * ChunkSize + 100;
+constexpr size_t FileChunks = 6;
+
+std::vector<char> MakeData(const size_t size, const int seed)
+{
+    std::vector<char> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<char>(i * 7 + i / 256 + seed);
+    }
+    return data;
+}
+
+/** writes data to name and moves its modification time by seconds, a
+ * rewrite within the timestamp granularity would look unchanged */
+void WriteFile(const std::string &name, const std::vector<char> &data, const int seconds)
+{
+    std::ofstream file(name, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), data.size());
+    file.close();
+    struct timespec times[2];
+    times[0].tv_sec = 1000000000 + seconds;
+    times[0].tv_nsec = 0;
+    times[1] = times[0];
+    ASSERT_EQ(utimensat(AT_FDCWD, name.c_str(), times, 0), 0);
+}
+
+void RemoveCache(const std::string &directory)
+{
+    std::remove((directory + "/index").c_str());
+    std::remove((directory + "/chunks").c_str());
+    rmdir(directory.c_str());
+}
+
+/** name read through a FilePOSIX wrapped by the cache in directory */
+std::unique_ptr<FileChunkCache> OpenCached(helper::Comm &comm, const std::string &name,
+                                           const std::string &directory)
+{
+    auto posix = std::make_shared<FilePOSIX>(comm);
+    posix->Open(name, Mode::Read);
+    std::unique_ptr<FileChunkCache> cache(new FileChunkCache(comm, posix));
+    cache->SetParameters({{"chunkcache", directory},
+                          {"chunksize", std::to_string(ChunkSize)},
+                          {"chunkcachesize", std::to_string(64 * ChunkSize)}});
+    cache->Open(name, Mode::Read);
+    return cache;
+}
+
+std::vector<char> ReadAll(FileChunkCache &cache)
+{
+    std::vector<char> data(cache.GetSize());
+    cache.Read(data.data(), data.size(), 0);
+    return data;
+}
+
+} // end anonymous namespace
+
+TEST(FileChunkCache, HitMiss)
+{
+    const std::string name = "TestFileChunkCacheHitMiss.bin";
+    const std::string directory = "TestFileChunkCacheHitMiss.cache";
+    RemoveCache(directory);
+    const std::vector<char> data = MakeData(FileSize, 1);
+    WriteFile(name, data, 0);
+    helper::Comm comm = helper::CommDummy();
+
+    {
+        auto cache = OpenCached(comm, name, directory);
+        EXPECT_EQ(ReadAll(*cache), data);
+        EXPECT_EQ(cache->Misses(), FileChunks);
+        EXPECT_EQ(cache->Hits(), 0u);
+
+        // a range within chunks 0 to 2, all cached now
+        std::vector<char> part(2 * ChunkSize);
+        cache->Read(part.data(), part.size(), 100);
+        EXPECT_TRUE(std::equal(part.begin(), part.end(), data.begin() + 100));
+        EXPECT_EQ(cache->Hits(), 3u);
+        EXPECT_EQ(cache->Misses(), FileChunks);
+        cache->Close();
+    }
+
+    // the unchanged file opened again is served from the cache
+    auto cache = OpenCached(comm, name, directory);
+    EXPECT_EQ(ReadAll(*cache), data);
+    EXPECT_EQ(cache->Hits(), FileChunks);
+    EXPECT_EQ(cache->Misses(), 0u);
+    cache->Close();
+
+    std::remove(name.c_str());
+    RemoveCache(directory);
+}
+
+TEST(FileChunkCache, Rewrite)
+{
+    const std::string name = "TestFileChunkCacheRewrite.bin";
+    const std::string directory = "TestFileChunkCacheRewrite.cache";
+    RemoveCache(directory);
+    helper::Comm comm = helper::CommDummy();
+
+    const std::vector<char> before = MakeData(FileSize, 1);
+    WriteFile(name, before, 0);
+    {
+        auto cache = OpenCached(comm, name, directory);
+        EXPECT_EQ(ReadAll(*cache), before);
+        cache->Close();
+    }
+
+    // same size, other contents: only the modification time tells
+    const std::vector<char> after = MakeData(FileSize, 2);
+    WriteFile(name, after, 1);
+    {
+        auto cache = OpenCached(comm, name, directory);
+        EXPECT_EQ(ReadAll(*cache), after);
+        EXPECT_EQ(cache->Hits(), 0u);
+        EXPECT_EQ(cache->Misses(), FileChunks);
+        cache->Close();
+    }
+
+    // same modification time, other size
+    const std::vector<char> shorter = MakeData(FileSize - ChunkSize, 3);
+    WriteFile(name, shorter, 1);
+    {
+        auto cache = OpenCached(comm, name, directory);
+        EXPECT_EQ(ReadAll(*cache), shorter);
+        EXPECT_EQ(cache->Hits(), 0u);
+        EXPECT_EQ(cache->Misses(), FileChunks - 1);
+        cache->Close();
+    }
+
+    // and the new version is cached in turn
+    auto cache = OpenCached(comm, name, directory);
+    EXPECT_EQ(ReadAll(*cache), shorter);
+    EXPECT_EQ(cache->Hits(), FileChunks - 1);
+    EXPECT_EQ(cache->Misses(), 0u);
+    cache->Close();
+
+    std::remove(name.c_str());
+    RemoveCache(directory);
+}
+
+TEST(FileChunkCache, TwoProcesses)
+{
+    const std::string name = "TestFileChunkCacheTwoProcesses.bin";
+    const std::string directory = "TestFileChunkCacheTwoProcesses.cache";
+    RemoveCache(directory);
+    const std::vector<char> data = MakeData(FileSize, 1);
+    WriteFile(name, data, 0);
+
+    // a child process reading the file, it exits with 0 if it read contents
+    // and fetched misses chunks, any number if misses is negative
+    auto lf_Fork = [&](const std::vector<char> &contents, const int misses) {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            int status = 1;
+            try
+            {
+                helper::Comm comm = helper::CommDummy();
+                auto cache = OpenCached(comm, name, directory);
+                if (ReadAll(*cache) == contents &&
+                    (misses < 0 || cache->Misses() == static_cast<size_t>(misses)))
+                {
+                    status = 0;
+                }
+                cache->Close();
+            }
+            catch (...)
+            {
+            }
+            _exit(status);
+        }
+        return pid;
+    };
+    auto lf_Wait = [](const pid_t pid) {
+        int status = -1;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    };
+
+    // the first process fills the cache, the second reads what it left
+    const pid_t first = lf_Fork(data, FileChunks);
+    ASSERT_GT(first, 0);
+    EXPECT_EQ(lf_Wait(first), 0);
+    const pid_t second = lf_Fork(data, 0);
+    ASSERT_GT(second, 0);
+    EXPECT_EQ(lf_Wait(second), 0);
+
+    // both at once on a rewritten file, each may fetch or find any chunk
+    const std::vector<char> after = MakeData(FileSize, 2);
+    WriteFile(name, after, 1);
+    const pid_t one = lf_Fork(after, -1);
+    const pid_t other = lf_Fork(after, -1);
+    ASSERT_GT(one, 0);
+    ASSERT_GT(other, 0);
+    EXPECT_EQ(lf_Wait(one), 0);
+    EXPECT_EQ(lf_Wait(other), 0);
+
+    helper::Comm comm = helper::CommDummy();
+    auto cache = OpenCached(comm, name, directory);
+    EXPECT_EQ(ReadAll(*cache), after);
+    EXPECT_EQ(cache->Misses(), 0u);
+    cache->Close();
+
+    std::remove(name.c_str());
+    RemoveCache(directory);
+}
+
+} // end namespace transport
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
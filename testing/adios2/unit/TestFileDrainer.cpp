@@ -0,0 +1,184 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include "adios2/toolkit/burstbuffer/FileDrainerMultiThread.h"
+#include "adios2/toolkit/burstbuffer/FileDrainerSingleThread.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace burstbuffer
+{
+
+namespace
+{
+
+std::vector<char> MakeData(size_t size, size_t seed)
+{
+    std::vector<char> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<char>((i * 131 + seed * 7) % 251);
+    }
+    return data;
+}
+
+void WriteFile(const std::string &path, const std::vector<char> &data)
+{
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    f.write(data.data(), data.size());
+}
+
+std::vector<char> ReadFile(const std::string &path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+} // end anonymous namespace
+
+class FileDrainerKernelCopy : public ::testing::TestWithParam<std::tuple<bool, bool>>
+{
+};
+
+TEST_P(FileDrainerKernelCopy, CopyInChunks)
+{
+    // copy_file_range, sendfile only, and the read/write fallback must
+    // produce the same target, also across several Copy operations that
+    // rely on the stream positions the previous one left behind
+    const bool copyFileRange = std::get<0>(GetParam());
+    const bool sendfile = std::get<1>(GetParam());
+    const std::string tag = std::to_string(copyFileRange) + std::to_string(sendfile);
+    const std::string from = "FileDrainerKernelCopy" + tag + ".src";
+    const std::string to = "FileDrainerKernelCopy" + tag + ".dst";
+    const size_t chunk = 64 * 1024;
+    const std::vector<char> data = MakeData(5 * chunk + 123, 1);
+    WriteFile(from, data);
+    std::remove(to.c_str());
+
+    {
+        FileDrainerSingleThread drainer;
+        drainer.SetBufferSize(chunk);
+        drainer.SetKernelCopy(copyFileRange, sendfile);
+        drainer.AddOperationOpen(to, Mode::Write);
+        drainer.AddOperationCopy(from, to, 2 * chunk);
+        drainer.AddOperationCopy(from, to, 3 * chunk);
+        drainer.AddOperationCopy(from, to, 123);
+        drainer.Start();
+        drainer.WaitForCompleted(drainer.OperationsAdded());
+        drainer.Finish();
+        drainer.Join();
+    }
+
+    EXPECT_EQ(ReadFile(to), data);
+    std::remove(from.c_str());
+    std::remove(to.c_str());
+}
+
+INSTANTIATE_TEST_SUITE_P(FileDrainer, FileDrainerKernelCopy,
+                         ::testing::Values(std::make_tuple(true, true),
+                                           std::make_tuple(false, true),
+                                           std::make_tuple(false, false)));
+
+TEST(FileDrainer, MultiThread)
+{
+    // data files spread over the streams, the index written from memory
+    // last must wait for all of them
+    const size_t nFiles = 6;
+    const size_t size = 100 * 1000;
+    std::vector<std::vector<char>> data;
+    FileDrainerMultiThread drainer;
+    drainer.SetThreads(3);
+    drainer.SetBufferSize(16 * 1024);
+    for (size_t i = 0; i < nFiles; ++i)
+    {
+        const std::string from = "FileDrainerMultiThread" + std::to_string(i) + ".src";
+        const std::string to = "FileDrainerMultiThread" + std::to_string(i) + ".dst";
+        data.push_back(MakeData(size + i, i));
+        WriteFile(from, data.back());
+        std::remove(to.c_str());
+        drainer.AddOperationOpen(to, Mode::Write);
+        drainer.AddOperationCopy(from, to, size / 2);
+        drainer.AddOperationCopy(from, to, size - size / 2 + i);
+    }
+    const std::string index = "FileDrainerMultiThread.idx";
+    const std::vector<char> indexData = MakeData(1000, 99);
+    std::remove(index.c_str());
+    drainer.AddOperationWrite(index, indexData.size(), indexData.data());
+    EXPECT_EQ(drainer.OperationsAdded(), 3 * nFiles + 1);
+
+    drainer.Start();
+    drainer.Finish();
+    drainer.Join();
+
+    for (size_t i = 0; i < nFiles; ++i)
+    {
+        const std::string from = "FileDrainerMultiThread" + std::to_string(i) + ".src";
+        const std::string to = "FileDrainerMultiThread" + std::to_string(i) + ".dst";
+        EXPECT_EQ(ReadFile(to), data[i]) << to;
+        std::remove(from.c_str());
+        std::remove(to.c_str());
+    }
+    EXPECT_EQ(ReadFile(index), indexData);
+    std::remove(index.c_str());
+}
+
+TEST(FileDrainer, BandwidthLimit)
+{
+    // two streams share one limit: 1 MB over 2 MB/s takes at least the
+    // time of all but the first chunk
+    const size_t chunk = 64 * 1024;
+    const size_t size = 8 * chunk;
+    const size_t bytesPerSecond = 2 * 1024 * 1024;
+    FileDrainerMultiThread drainer;
+    drainer.SetThreads(2);
+    drainer.SetBufferSize(chunk);
+    drainer.SetBandwidthLimit(bytesPerSecond);
+    std::vector<std::vector<char>> data;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const std::string from = "FileDrainerBandwidth" + std::to_string(i) + ".src";
+        const std::string to = "FileDrainerBandwidth" + std::to_string(i) + ".dst";
+        data.push_back(MakeData(size, i));
+        WriteFile(from, data.back());
+        std::remove(to.c_str());
+        drainer.AddOperationOpen(to, Mode::Write);
+        drainer.AddOperationCopy(from, to, size);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    drainer.Start();
+    drainer.Finish();
+    drainer.Join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double expected = static_cast<double>(2 * size - chunk) / bytesPerSecond;
+    EXPECT_GE(elapsed.count(), expected * 0.95);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const std::string from = "FileDrainerBandwidth" + std::to_string(i) + ".src";
+        const std::string to = "FileDrainerBandwidth" + std::to_string(i) + ".dst";
+        EXPECT_EQ(ReadFile(to), data[i]);
+        std::remove(from.c_str());
+        std::remove(to.c_str());
+    }
+}
+
+} // end namespace burstbuffer
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,500 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <adios2/helper/adiosCommDummy.h>
+#include <adios2/toolkit/transport/file/FileHTTP.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace transport
+{
+
+namespace
+{
+
+/** HTTP/1.1 server on the loopback interface serving one file from memory.
+ * It keeps connections alive, answers HEAD and single range GETs and can
+ * be told to cut or drop the response to the next request, to delay its
+ * responses or to serve other contents */
+class LoopbackServer
+{
+public:
+    explicit LoopbackServer(std::vector<char> content) : m_Content(std::move(content))
+    {
+        m_ListenFD = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(m_ListenFD, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(m_ListenFD, (struct sockaddr *)&address, sizeof(address));
+        socklen_t length = sizeof(address);
+        getsockname(m_ListenFD, (struct sockaddr *)&address, &length);
+        m_Port = ntohs(address.sin_port);
+        listen(m_ListenFD, 16);
+        m_Acceptor = std::thread(&LoopbackServer::Accept, this);
+    }
+
+    ~LoopbackServer()
+    {
+        shutdown(m_ListenFD, SHUT_RDWR);
+        m_Acceptor.join();
+        close(m_ListenFD);
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            for (const int fd : m_Open)
+            {
+                shutdown(fd, SHUT_RDWR);
+            }
+        }
+        for (auto &t : m_Handlers)
+        {
+            t.join();
+        }
+    }
+
+    int Port() const { return m_Port; }
+
+    size_t Connections()
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        return m_Connections;
+    }
+
+    size_t Requests()
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        return m_Requests;
+    }
+
+    /** [first, last] of the range GETs so far, in the order served */
+    std::vector<std::pair<size_t, size_t>> Ranges()
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        return m_Ranges;
+    }
+
+    /** the next GET announces its full length, sends only bytes of it and
+     * closes the connection */
+    void ShortenNextResponse(const size_t bytes)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Next = Action::Shorten;
+        m_ShortBytes = bytes;
+    }
+
+    /** the next request is answered by closing the connection */
+    void CloseOnNextRequest()
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Next = Action::Close;
+    }
+
+    /** every GET is answered after milliseconds */
+    void DelayResponses(const int milliseconds)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_DelayMilliseconds = milliseconds;
+    }
+
+    /** the file is rewritten */
+    void SetContent(std::vector<char> content)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Content = std::move(content);
+    }
+
+private:
+    enum class Action
+    {
+        Serve,
+        Shorten,
+        Close
+    };
+
+    std::vector<char> m_Content;
+    int m_ListenFD = -1;
+    int m_Port = 0;
+    std::thread m_Acceptor;
+    std::vector<std::thread> m_Handlers;
+
+    std::mutex m_Mutex;
+    std::set<int> m_Open;
+    size_t m_Connections = 0;
+    size_t m_Requests = 0;
+    std::vector<std::pair<size_t, size_t>> m_Ranges;
+    Action m_Next = Action::Serve;
+    size_t m_ShortBytes = 0;
+    int m_DelayMilliseconds = 0;
+
+    void Accept()
+    {
+        for (;;)
+        {
+            const int fd = accept(m_ListenFD, nullptr, nullptr);
+            if (fd < 0)
+            {
+                return;
+            }
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            m_Open.insert(fd);
+            ++m_Connections;
+            m_Handlers.emplace_back(&LoopbackServer::Serve, this, fd);
+        }
+    }
+
+    void Close(const int fd)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Open.erase(fd);
+        close(fd);
+    }
+
+    static bool Send(const int fd, const char *data, size_t size)
+    {
+        while (size > 0)
+        {
+            const ssize_t n = send(fd, data, size, MSG_NOSIGNAL);
+            if (n <= 0)
+            {
+                return false;
+            }
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    void Serve(const int fd)
+    {
+        std::string pending;
+        char buf[4096];
+        for (;;)
+        {
+            size_t end;
+            while ((end = pending.find("\r\n\r\n")) == std::string::npos)
+            {
+                const ssize_t n = recv(fd, buf, sizeof(buf), 0);
+                if (n <= 0)
+                {
+                    Close(fd);
+                    return;
+                }
+                pending.append(buf, static_cast<size_t>(n));
+            }
+            const std::string request = pending.substr(0, end + 2);
+            pending.erase(0, end + 4);
+
+            Action action;
+            std::vector<char> content;
+            int delay;
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Mutex);
+                ++m_Requests;
+                action = m_Next;
+                m_Next = Action::Serve;
+                content = m_Content;
+                delay = m_DelayMilliseconds;
+            }
+            if (action == Action::Close)
+            {
+                Close(fd);
+                return;
+            }
+
+            if (request.compare(0, 5, "HEAD ") == 0)
+            {
+                const std::string header = "HTTP/1.1 200 OK\r\nContent-Length: " +
+                                           std::to_string(content.size()) + "\r\n\r\n";
+                if (!Send(fd, header.data(), header.size()))
+                {
+                    Close(fd);
+                    return;
+                }
+                continue;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            size_t first = 0;
+            size_t last = content.size() - 1;
+            const size_t range = request.find("\r\nRange: bytes=");
+            if (range != std::string::npos)
+            {
+                unsigned long long a = 0, b = 0;
+                std::sscanf(request.c_str() + range + 15, "%llu-%llu", &a, &b);
+                first = static_cast<size_t>(a);
+                last = std::min(static_cast<size_t>(b), content.size() - 1);
+            }
+            size_t length = last - first + 1;
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Mutex);
+                m_Ranges.emplace_back(first, last);
+            }
+            const std::string header = "HTTP/1.1 206 Partial Content\r\nContent-Length: " +
+                                       std::to_string(length) + "\r\n\r\n";
+            if (action == Action::Shorten)
+            {
+                length = std::min(length, m_ShortBytes);
+            }
+            if (!Send(fd, header.data(), header.size()) ||
+                !Send(fd, content.data() + first, length) || action == Action::Shorten)
+            {
+                Close(fd);
+                return;
+            }
+        }
+    }
+};
+
+std::vector<char> MakeContent(const size_t size)
+{
+    std::vector<char> content(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        content[i] = static_cast<char>((i * 131 + i / 251) % 256);
+    }
+    return content;
+}
+
+std::unique_ptr<FileHTTP> OpenHTTP(helper::Comm &comm, const LoopbackServer &server,
+                                   Params parameters)
+{
+    std::unique_ptr<FileHTTP> file(new FileHTTP(comm));
+    parameters["hostname"] = "127.0.0.1";
+    parameters["port"] = std::to_string(server.Port());
+    file->SetParameters(parameters);
+    file->Open("/data.bp", Mode::Read);
+    return file;
+}
+
+} // end anonymous namespace
+
+TEST(FileHTTP, ConnectionReuse)
+{
+    const std::vector<char> content = MakeContent(100000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {{"connections", "1"}});
+        EXPECT_EQ(file->GetSize(), content.size());
+        for (size_t i = 0; i < 5; ++i)
+        {
+            const size_t start = i * 9000 + 17;
+            std::vector<char> data(1000);
+            file->Read(data.data(), data.size(), start);
+            EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + start)) << i;
+        }
+        file->Close();
+    }
+    // the size and all reads went over the one kept-alive connection
+    EXPECT_EQ(server.Requests(), 6u);
+    EXPECT_EQ(server.Connections(), 1u);
+}
+
+TEST(FileHTTP, SplitRead)
+{
+    const std::vector<char> content = MakeContent(100000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {{"connections", "4"}, {"split_size", "1024"}});
+        const size_t start = 123;
+        std::vector<char> data(8190);
+        file->Read(data.data(), data.size(), start);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + start));
+
+        // four concurrent ranges that tile the read exactly
+        auto ranges = server.Ranges();
+        ASSERT_EQ(ranges.size(), 4u);
+        std::sort(ranges.begin(), ranges.end());
+        size_t next = start;
+        for (const auto &r : ranges)
+        {
+            EXPECT_EQ(r.first, next);
+            EXPECT_GE(r.second - r.first + 1, 1024u);
+            next = r.second + 1;
+        }
+        EXPECT_EQ(next, start + data.size());
+        EXPECT_LE(server.Connections(), 4u);
+
+        // the next split read takes its connections from the pool
+        const size_t connections = server.Connections();
+        file->Read(data.data(), data.size(), 50000);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + 50000));
+        EXPECT_EQ(server.Requests(), 8u);
+        EXPECT_LE(server.Connections(), 4u);
+        EXPECT_GE(server.Connections(), connections);
+        file->Close();
+    }
+}
+
+TEST(FileHTTP, ReadAhead)
+{
+    const std::vector<char> content = MakeContent(100000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {{"readahead", "4096"}});
+        std::vector<char> data(100);
+        for (const size_t start : {0, 1000, 3990, 5000})
+        {
+            file->Read(data.data(), data.size(), start);
+            EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + start)) << start;
+        }
+        // 5000 is outside the window fetched for the first read
+        EXPECT_EQ(server.Requests(), 2u);
+
+        // a window that ends with the file
+        file->Read(data.data(), data.size(), content.size() - data.size());
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.end() - data.size()));
+        EXPECT_THROW(file->Read(data.data(), data.size(), content.size() - 50),
+                     std::ios_base::failure);
+        file->Close();
+    }
+}
+
+TEST(FileHTTP, ReadAheadRewrite)
+{
+    std::vector<char> content = MakeContent(10000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {{"readahead", "4096"}});
+        EXPECT_EQ(file->GetSize(), content.size());
+        std::vector<char> data(100);
+        file->Read(data.data(), data.size(), 0);
+
+        // a byte rewritten in place while the file grows, like the active
+        // flag of md.idx
+        content[39] = static_cast<char>(content[39] + 1);
+        content.resize(12000, 'x');
+        server.SetContent(content);
+        file->Read(data.data(), data.size(), 0);
+        EXPECT_NE(data[39], content[39]);
+        EXPECT_EQ(server.Requests(), 2u);
+
+        // the new size drops the window
+        EXPECT_EQ(file->GetSize(), content.size());
+        file->Read(data.data(), data.size(), 0);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin()));
+        EXPECT_EQ(server.Requests(), 4u);
+
+        // the same size keeps it
+        EXPECT_EQ(file->GetSize(), content.size());
+        file->Read(data.data(), data.size(), 200);
+        EXPECT_EQ(server.Requests(), 5u);
+        file->Close();
+    }
+}
+
+TEST(FileHTTP, ReadAheadThreads)
+{
+    const std::vector<char> content = MakeContent(100000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {{"readahead", "4096"}});
+        const int delay = 300;
+        server.DelayResponses(delay);
+
+        // readers of different windows wait for the server side by side
+        const size_t threads = 4;
+        std::vector<std::vector<char>> data(threads, std::vector<char>(100));
+        const auto begin = std::chrono::steady_clock::now();
+        std::vector<std::thread> readers;
+        for (size_t t = 0; t < threads; ++t)
+        {
+            readers.emplace_back([&, t]() { file->Read(data[t].data(), 100, t * 20000); });
+        }
+        for (auto &r : readers)
+        {
+            r.join();
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now() - begin)
+                                 .count();
+        for (size_t t = 0; t < threads; ++t)
+        {
+            EXPECT_TRUE(std::equal(data[t].begin(), data[t].end(), content.begin() + t * 20000));
+        }
+        EXPECT_LT(elapsed, 2 * delay);
+        file->Close();
+    }
+}
+
+TEST(FileHTTP, ShortResponse)
+{
+    const std::vector<char> content = MakeContent(10000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {});
+        std::vector<char> data(1000);
+        server.ShortenNextResponse(300);
+        EXPECT_THROW(file->Read(data.data(), data.size(), 10), std::ios_base::failure);
+
+        // the cut connection is not pooled, the next read gets a new one
+        file->Read(data.data(), data.size(), 10);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + 10));
+        EXPECT_EQ(server.Connections(), 2u);
+        file->Close();
+    }
+}
+
+TEST(FileHTTP, ClosedConnection)
+{
+    const std::vector<char> content = MakeContent(10000);
+    LoopbackServer server(content);
+    helper::Comm comm = helper::CommDummy();
+    {
+        auto file = OpenHTTP(comm, server, {});
+        std::vector<char> data(1000);
+        file->Read(data.data(), data.size(), 0);
+
+        // an idle kept-alive connection the server drops is retried once
+        server.CloseOnNextRequest();
+        file->Read(data.data(), data.size(), 2000);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin() + 2000));
+        EXPECT_EQ(server.Connections(), 2u);
+        EXPECT_EQ(server.Requests(), 3u);
+        file->Close();
+    }
+    {
+        // a new connection closed without a response is an error
+        auto file = OpenHTTP(comm, server, {});
+        std::vector<char> data(1000);
+        server.CloseOnNextRequest();
+        EXPECT_THROW(file->Read(data.data(), data.size(), 0), std::ios_base::failure);
+        file->Close();
+    }
+}
+
+} // end namespace transport
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
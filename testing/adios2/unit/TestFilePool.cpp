@@ -141,6 +141,96 @@ TEST(FilePool, FileLimit)
     remove_test_files(10, prefix);
 }
 
+static bool IsOpen(FilePool &pool, const std::string &name)
+{
+    for (const auto &transport : pool.ListOfTransports())
+    {
+        if (transport->m_Name == name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST(FilePool, LRUEviction)
+{
+    core::ADIOS adios("C++");
+    core::IO io(adios, "name", false, "C++");
+    helper::Comm comm = adios2::helper::CommDummy();
+
+    adios2::transportman::TransportMan factory(io, comm);
+    std::string prefix = "LRUEviction";
+
+    create_test_files(4, prefix);
+    {
+        FilePool pool(&factory, {{"library", "posix"}}, 3, nullptr);
+        {
+            auto handle0 = pool.Acquire(filename(0, prefix));
+            auto handle1 = pool.Acquire(filename(1, prefix));
+            auto handle2 = pool.Acquire(filename(2, prefix));
+            handle0.reset();
+            handle1.reset();
+            handle2.reset();
+        }
+        // touch file 0, so file 1 is now the least recently used one
+        pool.Acquire(filename(0, prefix));
+        auto handle3 = pool.Acquire(filename(3, prefix));
+        EXPECT_EQ(3, pool.GetOpenCount());
+        EXPECT_TRUE(IsOpen(pool, filename(0, prefix)));
+        EXPECT_FALSE(IsOpen(pool, filename(1, prefix)));
+        EXPECT_TRUE(IsOpen(pool, filename(2, prefix)));
+
+        // files in use are never evicted
+        auto handle0 = pool.Acquire(filename(0, prefix));
+        auto handle2 = pool.Acquire(filename(2, prefix));
+        EXPECT_THROW(pool.Acquire(filename(1, prefix)), std::runtime_error);
+        EXPECT_EQ(3, pool.GetMax());
+    }
+    remove_test_files(4, prefix);
+}
+
+TEST(FilePool, OpenAhead)
+{
+    core::ADIOS adios("C++");
+    core::IO io(adios, "name", false, "C++");
+    helper::Comm comm = adios2::helper::CommDummy();
+
+    adios2::transportman::TransportMan factory(io, comm);
+    std::string prefix = "OpenAhead";
+
+    create_test_files(4, prefix);
+    {
+        FilePool pool(&factory, {{"library", "posix"}}, 10, nullptr);
+        pool.OpenAhead({filename(1, prefix), filename(2, prefix), filename(1, prefix),
+                        "OpenAheadDoesNotExist"});
+        pool.WaitForOpenAhead();
+        EXPECT_EQ(2, pool.GetOpenCount());
+
+        // the opened-ahead transport is reused
+        auto handle1 = pool.Acquire(filename(1, prefix));
+        EXPECT_EQ(2, pool.GetOpenCount());
+        size_t result;
+        handle1->Read((char *)&result, sizeof(size_t), 5 * sizeof(size_t));
+        EXPECT_EQ(1005, result);
+    }
+    {
+        // open-ahead stays under the limit and does not evict anything
+        FilePool pool(&factory, {{"library", "posix"}}, 2, nullptr);
+        auto handle0 = pool.Acquire(filename(0, prefix));
+        pool.OpenAhead({filename(1, prefix), filename(2, prefix), filename(3, prefix)});
+        pool.WaitForOpenAhead();
+        EXPECT_EQ(2, pool.GetOpenCount());
+        EXPECT_TRUE(IsOpen(pool, filename(0, prefix)));
+        EXPECT_TRUE(IsOpen(pool, filename(1, prefix)));
+
+        // but opened-ahead files that are not used can be evicted
+        auto handle3 = pool.Acquire(filename(3, prefix));
+        EXPECT_FALSE(IsOpen(pool, filename(1, prefix)));
+    }
+    remove_test_files(4, prefix);
+}
+
 class FilePoolTest : public ::testing::TestWithParam<std::string>
 {
     // You can add SetUp, TearDown, or shared objects here if needed
@@ -0,0 +1,240 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <algorithm>
+#include <chrono>
+#include <ios>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2/toolkit/transport/file/S3MultipartUpload.h>
+
+#include <gtest/gtest.h>
+
+namespace adios2
+{
+namespace transport
+{
+
+namespace
+{
+
+/** Keeps the requests of one object in memory, like an S3 bucket would */
+class MockS3 : public S3MultipartUpload::Client
+{
+public:
+    std::mutex m_Mutex;
+    std::map<int, std::vector<char>> m_Parts;
+    std::vector<char> m_Object;
+    int m_Creates = 0;
+    int m_Puts = 0;
+    int m_Completes = 0;
+    int m_Aborts = 0;
+    int m_FailPart = 0; // UploadPart of this part fails
+    size_t m_InFlight = 0;
+    size_t m_MaxInFlight = 0;
+
+    std::string CreateMultipartUpload() final
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_Creates;
+        return "upload" + std::to_string(m_Creates);
+    }
+
+    std::string UploadPart(const std::string &uploadId, const int partNumber, const char *data,
+                           const size_t size) final
+    {
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Mutex);
+            EXPECT_EQ(uploadId, "upload" + std::to_string(m_Creates));
+            ++m_InFlight;
+            m_MaxInFlight = std::max(m_MaxInFlight, m_InFlight);
+        }
+        // long enough for the next parts to start meanwhile
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        --m_InFlight;
+        if (partNumber == m_FailPart)
+        {
+            throw std::ios_base::failure("part " + std::to_string(partNumber) + " failed");
+        }
+        m_Parts[partNumber].assign(data, data + size);
+        return "etag" + std::to_string(partNumber);
+    }
+
+    void CompleteMultipartUpload(const std::string &uploadId,
+                                 const std::vector<std::pair<int, std::string>> &parts) final
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_Completes;
+        m_Object.clear();
+        for (size_t i = 0; i < parts.size(); ++i)
+        {
+            EXPECT_EQ(parts[i].first, static_cast<int>(i + 1));
+            EXPECT_EQ(parts[i].second, "etag" + std::to_string(i + 1));
+            const auto &part = m_Parts.at(parts[i].first);
+            m_Object.insert(m_Object.end(), part.begin(), part.end());
+        }
+    }
+
+    void AbortMultipartUpload(const std::string &uploadId) noexcept final
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_Aborts;
+        m_Parts.clear();
+    }
+
+    void PutObject(const char *data, const size_t size) final
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_Puts;
+        m_Object.assign(data, data + size);
+    }
+};
+
+std::vector<char> MakeData(const size_t size)
+{
+    std::vector<char> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<char>(i * 7 + i / 256);
+    }
+    return data;
+}
+
+} // end anonymous namespace
+
+TEST(S3MultipartUpload, SmallObject)
+{
+    // less than a part is written with one PutObject
+    MockS3 s3;
+    const std::vector<char> data = MakeData(70);
+    {
+        S3MultipartUpload upload(s3, "bucket/small", 100, 2);
+        upload.Append(data.data(), 30);
+        upload.Append(data.data() + 30, 40);
+        upload.Finish();
+        EXPECT_EQ(upload.PartsStarted(), 0);
+    }
+    EXPECT_EQ(s3.m_Puts, 1);
+    EXPECT_EQ(s3.m_Creates, 0);
+    EXPECT_EQ(s3.m_Aborts, 0);
+    EXPECT_EQ(s3.m_Object, data);
+}
+
+TEST(S3MultipartUpload, PartBoundaries)
+{
+    // appends that straddle part boundaries, then a short final part
+    MockS3 s3;
+    const std::vector<size_t> appends = {1, 99, 150, 49, 1, 250, 7};
+    const size_t total = std::accumulate(appends.begin(), appends.end(), size_t(0));
+    const std::vector<char> data = MakeData(total);
+    {
+        S3MultipartUpload upload(s3, "bucket/parts", 100, 3);
+        size_t pos = 0;
+        for (const size_t n : appends)
+        {
+            upload.Append(data.data() + pos, n);
+            pos += n;
+        }
+        EXPECT_EQ(upload.PartsStarted(), 5);
+        upload.Finish();
+        EXPECT_EQ(upload.PartsStarted(), 6);
+    }
+    EXPECT_EQ(s3.m_Creates, 1);
+    EXPECT_EQ(s3.m_Completes, 1);
+    EXPECT_EQ(s3.m_Puts, 0);
+    EXPECT_EQ(s3.m_Aborts, 0);
+    ASSERT_EQ(s3.m_Parts.size(), 6u);
+    for (int p = 1; p <= 5; ++p)
+    {
+        EXPECT_EQ(s3.m_Parts[p].size(), 100u) << p;
+    }
+    EXPECT_EQ(s3.m_Parts[6].size(), total - 500);
+    EXPECT_EQ(s3.m_Object, data);
+    EXPECT_GE(s3.m_MaxInFlight, 2u);
+    EXPECT_LE(s3.m_MaxInFlight, 3u);
+}
+
+TEST(S3MultipartUpload, ExactMultiple)
+{
+    // no empty part after a full last one
+    MockS3 s3;
+    const std::vector<char> data = MakeData(300);
+    S3MultipartUpload upload(s3, "bucket/exact", 100, 1);
+    upload.Append(data.data(), data.size());
+    upload.Finish();
+    EXPECT_EQ(upload.PartsStarted(), 3);
+    ASSERT_EQ(s3.m_Parts.size(), 3u);
+    EXPECT_EQ(s3.m_Object, data);
+    EXPECT_EQ(s3.m_MaxInFlight, 1u);
+}
+
+TEST(S3MultipartUpload, AbortOnFailure)
+{
+    // a failed part aborts the upload, nothing is completed or put
+    MockS3 s3;
+    s3.m_FailPart = 2;
+    const std::vector<char> data = MakeData(450);
+    {
+        S3MultipartUpload upload(s3, "bucket/fail", 100, 2);
+        try
+        {
+            upload.Append(data.data(), data.size());
+            upload.Finish();
+            ADD_FAILURE() << "the failed part was not reported";
+        }
+        catch (std::ios_base::failure &)
+        {
+            upload.Abort();
+        }
+        // Close after a failed write does not write a partial object
+        upload.Finish();
+    }
+    EXPECT_EQ(s3.m_Creates, 1);
+    EXPECT_EQ(s3.m_Aborts, 1);
+    EXPECT_EQ(s3.m_Completes, 0);
+    EXPECT_EQ(s3.m_Puts, 0);
+    EXPECT_TRUE(s3.m_Parts.empty());
+}
+
+TEST(S3MultipartUpload, AbortUnfinished)
+{
+    // an upload that is never finished is aborted, not left behind
+    MockS3 s3;
+    const std::vector<char> data = MakeData(250);
+    {
+        S3MultipartUpload upload(s3, "bucket/unfinished", 100, 2);
+        upload.Append(data.data(), data.size());
+    }
+    EXPECT_EQ(s3.m_Creates, 1);
+    EXPECT_EQ(s3.m_Aborts, 1);
+    EXPECT_EQ(s3.m_Completes, 0);
+}
+
+TEST(S3MultipartUpload, TakeBuffered)
+{
+    // before the first part the bytes can be taken back, for staging
+    MockS3 s3;
+    const std::vector<char> data = MakeData(60);
+    S3MultipartUpload upload(s3, "bucket/staged", 100, 2);
+    upload.Append(data.data(), data.size());
+    EXPECT_EQ(upload.TakeBuffered(), data);
+    upload.Append(data.data(), 10);
+    upload.Finish();
+    EXPECT_EQ(s3.m_Object, std::vector<char>(data.begin(), data.begin() + 10));
+}
+
+} // end namespace transport
+} // end namespace adios2
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}